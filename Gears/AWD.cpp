@@ -8,6 +8,7 @@
 #include "Util/MathExt.h"
 #include "Util/Strings.hpp"
 #include "Util/UIUtils.h"
+#include "Util/NativeCache.h"
 
 #include "Memory/Offsets.hpp"
 #include "Memory/VehicleExtensions.hpp"
@@ -100,7 +101,7 @@ void AWD::Update() {
         return;
     }
 
-    if (VExt::GetNumWheels(g_playerVehicle) != 4) {
+    if (NativeCache::GetNumWheels(g_playerVehicle) != 4) {
         if (g_settings.Debug.DisplayInfo) {
             UI::ShowText(dbgX, dbgY, 0.5f, "Unsupported (need 4 wheels)");
         }
@@ -128,7 +129,7 @@ void AWD::Update() {
 
 
     if (g_settings().DriveAssists.AWD.UseOversteer || g_settings().DriveAssists.AWD.UseUndersteer) {
-        DrivingAssists::ESPData espData = DrivingAssists::GetESP();
+        const auto& espData = DrivingAssists::GetESP();
         if (g_settings().DriveAssists.AWD.UseOversteer) {
             transferInfos[1] = GetOversteerTransfer(driveBiasF, biasMax, espData);
         }
@@ -5,11 +5,17 @@
 #include "Input/CarControls.hpp"
 #include "Util/MathExt.h"
 #include "Util/UIUtils.h"
+#include "Util/NativeCache.h"
+#include "Util/LeadTracker.h"
 
 #include <fmt/format.h>
 #include <inc/enums.h>
 #include <inc/natives.h>
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 extern CarControls g_controls;
 extern ScriptSettings g_settings;
 extern Vehicle g_playerVehicle;
@@ -18,17 +24,47 @@ extern VehicleGearboxStates g_gearStates;
 
 using VExt = VehicleExtensions;
 
-struct SRayResult {
-    BOOL Hit;
-    Vector3 HitCoord;
-    Entity HitEntity;
-    float Distance;
-};
-
 namespace {
     bool active = false;
     float cruiseThrottle = 0.0f;
     bool adaptiveActive = false;
+
+    constexpr uint32_t numProbeRays = 9;
+
+    // Fan of rays from the front of the vehicle, started with the non-blocking
+    // shape test natives. Results are usually ready the next frame.
+    class ShapeTestRays : public Cruise::RaySource {
+    public:
+        // Fan layout for this frame.
+        void Prepare(Vehicle vehicle);
+        int Start(uint32_t ray) override;
+        EStatus Poll(int handle, Cruise::ProbeResult& result) override;
+        // Drops the origins of rays that will never be polled.
+        void Reset() { mOrigins.clear(); }
+
+    private:
+        struct Origin {
+            int Handle;
+            Vector3 Coord;
+        };
+
+        Vehicle mVehicle = 0;
+        Hash mModel = 0;
+        std::array<Vector3, numProbeRays> mOffsets{};
+        float mLateral = 0.0f;
+        std::vector<Origin> mOrigins;
+    };
+
+    ShapeTestRays probeRays;
+    Cruise::ProbeScheduler probeScheduler(probeRays, numProbeRays);
+    Cruise::LeadTracker leadTracker;
+    std::vector<Cruise::ProbeResult> probeResults;
+
+    void resetAdaptive() {
+        probeRays.Reset();
+        probeScheduler.Reset();
+        leadTracker.Reset();
+    }
 }
 
 void UpdateAdaptive(float& targetSetpoint, float& brakeValue);
@@ -47,132 +83,88 @@ bool CruiseControl::GetAdaptiveActive() {
     return adaptiveActive;
 }
 
-SRayResult RayCast(Vehicle vehicle, Vector3 startOffset, Vector3 endOffset) {
-    auto rayOrg = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(vehicle, startOffset);
-    auto rayEnd = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(vehicle, endOffset);
+void ShapeTestRays::Prepare(Vehicle vehicle) {
+    mVehicle = vehicle;
+
+    Hash model = ENTITY::GET_ENTITY_MODEL(vehicle);
+    if (model != mModel) {
+        mModel = model;
+        Vector3 dimMax, dimMin;
+        MISC::GET_MODEL_DIMENSIONS(model, &dimMin, &dimMax);
+        mOffsets = {
+            Vector3 { 0.0f,             dimMax.y, 0.0f },               // centercenter
+            Vector3 { 0.0f,             dimMax.y, dimMax.z / 2.0f },    // centertop / 2
+            Vector3 { 0.0f,             dimMax.y, dimMax.z },           // centertop
+            Vector3 { 0.0f,             dimMax.y, dimMin.z / 2.0f },    // centerbot / 2
+            Vector3 { 0.0f,             dimMax.y, dimMin.z },           // centerbot
+            Vector3 { dimMin.x / 2.0f,  dimMax.y, 0.0f },               // leftcenter / 2
+            Vector3 { dimMin.x,         dimMax.y, 0.0f },               // leftcenter
+            Vector3 { dimMax.x / 2.0f,  dimMax.y, 0.0f },               // rightcenter / 2
+            Vector3 { dimMax.x,         dimMax.y, 0.0f },               // rightcenter
+        };
+    }
 
-    // or START_SHAPE_TEST_LOS_PROBE
-    int ray = SHAPETEST::START_EXPENSIVE_SYNCHRONOUS_SHAPE_TEST_LOS_PROBE(
-        rayOrg, rayEnd,
-        10, vehicle, 7);
+    // Aim into the turn
+    Vector3 vel = NativeCache::GetEntitySpeedVector(vehicle, true);
+    Vector3 rotVel = ENTITY::GET_ENTITY_ROTATION_VELOCITY(vehicle);
+    mLateral = (vel.x + 120.0f * -sin(rotVel.z)) * 0.5f;
+}
 
-    BOOL hit = false;
-    Vector3 hitCoord, surfaceNormal;
-    Entity hitEntity;
-    int rayResult = SHAPETEST::GET_SHAPE_TEST_RESULT(ray, &hit, &hitCoord, &surfaceNormal, &hitEntity);
-    float distance = Distance(rayOrg, hitCoord);
+int ShapeTestRays::Start(uint32_t ray) {
+    const Vector3& offset = mOffsets[ray];
+    Vector3 endOffset = offset;
+    endOffset.x += mLateral;
+    endOffset.y += 120.0f;
+
+    auto rayOrg = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(mVehicle, offset);
+    auto rayEnd = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(mVehicle, endOffset);
+    int handle = SHAPETEST::START_SHAPE_TEST_LOS_PROBE(rayOrg, rayEnd, 10, mVehicle, 7);
+    if (handle == 0)
+        return 0;
 
     if (g_settings.Debug.DisplayInfo) {
-        GRAPHICS::DRAW_LINE(rayOrg,
-                            rayEnd,
-                            hit ? 255 : 71,
-                            hit ? 255 : 71,
-                            hit ? 255 : 71,
-                            255);
-
-        if (hit) {
-            UI::DrawSphere(hitCoord, 0.10f, Util::ColorsI::SolidWhite);
-        }
+        GRAPHICS::DRAW_LINE(rayOrg, rayEnd, 71, 71, 71, 255);
     }
 
-    return {
-        hit, hitCoord, hitEntity, distance
-    };
+    mOrigins.push_back({ handle, rayOrg });
+    return handle;
 }
 
-// Casts an array of 9, returns closest result.
-SRayResult MultiCast(Vehicle vehicle, float range) {
-    Vector3 dimMax, dimMin;
-    MISC::GET_MODEL_DIMENSIONS(ENTITY::GET_ENTITY_MODEL(vehicle), &dimMin, &dimMax);
-    Vector3 vel = ENTITY::GET_ENTITY_SPEED_VECTOR(vehicle, true);
-
-    Vector3 rotVel = ENTITY::GET_ENTITY_ROTATION_VELOCITY(g_playerVehicle);
-    Vector3 rotRelative{
-        120.0f * -sin(rotVel.z),
-        120.0f * cos(rotVel.z),
-        0
-    };
-
-    float avgAngle = VExt::GetWheelAverageAngle(g_playerVehicle);
-    Vector3 vecNextRot = (vel + rotRelative) * 0.5f;
-
-    std::vector<Vector3> offsets{
-        // centercenter
-        Vector3 {
-            0.0f,
-            dimMax.y,
-            0.0f,
-        },
-        // centertop / 2
-        Vector3 {
-            0.0f,
-            dimMax.y,
-            dimMax.z / 2.0f,
-        },
-        // centertop
-        Vector3 {
-            0.0f,
-            dimMax.y,
-            dimMax.z,
-        },
-        // centerbot / 2
-        Vector3 {
-            0.0f,
-            dimMax.y,
-            dimMin.z / 2.0f,
-        },
-        // centerbot
-        Vector3 {
-            0.0f,
-            dimMax.y,
-            dimMin.z,
-        },
-        // leftcenter / 2
-        Vector3 {
-            dimMin.x / 2.0f,
-            dimMax.y,
-            0.0f,
-        },
-        // leftcenter
-        Vector3 {
-            dimMin.x,
-            dimMax.y,
-            0.0f,
-        },
-        // rightcenter / 2
-        Vector3 {
-            dimMax.x / 2.0f,
-            dimMax.y,
-            0.0f,
-        },
-        // rightcenter
-        Vector3 {
-            dimMax.x,
-            dimMax.y,
-            0.0f,
-        },
-    };
-
-    SRayResult minResult{};
-    for (const auto& offset : offsets) {
-        Vector3 offVel = offset;
-        offVel.x += vecNextRot.x;
-        offVel.y += 120.0f;
-        auto result = RayCast(g_playerVehicle, offset, offVel);
+Cruise::RaySource::EStatus ShapeTestRays::Poll(int handle, Cruise::ProbeResult& result) {
+    auto origin = std::find_if(mOrigins.begin(), mOrigins.end(),
+        [handle](const Origin& o) { return o.Handle == handle; });
+    if (origin == mOrigins.end())
+        return EStatus::Failed;
 
-        if (result.Hit &&
-            (minResult.HitEntity == 0 || result.Distance < minResult.Distance)) {
-            minResult = result;
-        }
+    BOOL hit = false;
+    Vector3 hitCoord, surfaceNormal;
+    Entity hitEntity = 0;
+    // 0: failed/unknown handle, 1: pending, 2: ready
+    int status = SHAPETEST::GET_SHAPE_TEST_RESULT(handle, &hit, &hitCoord, &surfaceNormal, &hitEntity);
+    if (status == 1)
+        return EStatus::Pending;
+
+    Vector3 rayOrg = origin->Coord;
+    mOrigins.erase(origin);
+    if (status != 2)
+        return EStatus::Failed;
+
+    result.Hit = hit;
+    result.Entity = hitEntity;
+    result.Distance = Distance(rayOrg, hitCoord);
+
+    if (g_settings.Debug.DisplayInfo && hit) {
+        GRAPHICS::DRAW_LINE(rayOrg, hitCoord, 255, 255, 255, 255);
+        UI::DrawSphere(hitCoord, 0.10f, Util::ColorsI::SolidWhite);
     }
-
-    return minResult;
+    return EStatus::Ready;
 }
 
 void CruiseControl::Update(float& throttle, float& brake, float& clutch) {
     if (!active) {
         adaptiveActive = false;
         cruiseThrottle = 0.0f;
+        resetAdaptive();
         return;
     }
 
@@ -182,6 +174,10 @@ void CruiseControl::Update(float& throttle, float& brake, float& clutch) {
     if (g_settings().DriveAssists.CruiseControl.Adaptive) {
         UpdateAdaptive(targetSetpoint, brakeValue);
     }
+    else {
+        adaptiveActive = false;
+        resetAdaptive();
+    }
 
     float delta = g_vehData.mVelocity.y - targetSetpoint;
 
@@ -205,7 +201,7 @@ void CruiseControl::Update(float& throttle, float& brake, float& clutch) {
         // By LieutenantDan
         float targetAcceleration = std::clamp((targetSetpoint - g_vehData.mVelocity.y) * cruiseTgtAccFactor, -cruiseMaxAcceleration, cruiseMaxAcceleration);
         if (!g_gearStates.Shifting)
-            cruiseThrottle = std::clamp(cruiseThrottle + (targetAcceleration - g_vehData.mAcceleration.y) * cruiseAccCorrFactor * MISC::GET_FRAME_TIME(), 0.0f, 1.0f);
+            cruiseThrottle = std::clamp(cruiseThrottle + (targetAcceleration - g_vehData.mAcceleration.y) * cruiseAccCorrFactor * NativeCache::GetFrameTime(), 0.0f, 1.0f);
 
         throttle = std::clamp(throttle + cruiseThrottle, 0.0f, 1.0f);
     }
@@ -215,19 +211,26 @@ void CruiseControl::Update(float& throttle, float& brake, float& clutch) {
 }
 
 void UpdateAdaptive(float& targetSetpoint, float& brakeValue) {
-    // 120m to 150m detection range
-    const float maxCastDist = 200.0f;
-
     // When speed is zero, drive up to here
     const float minFollowDistance = g_settings().DriveAssists.CruiseControl.MinFollowDistance;
 
     // Start to match speed here
     const float maxFollowDistance = g_settings().DriveAssists.CruiseControl.MaxFollowDistance;
 
-    auto result = MultiCast(g_playerVehicle, maxCastDist);
-    bool hit = result.Hit;
-    Vector3 hitCoord = result.HitCoord;
-    Entity hitEntity = result.HitEntity;
+    static Vehicle probeVehicle = 0;
+    if (probeVehicle != g_playerVehicle) {
+        probeVehicle = g_playerVehicle;
+        resetAdaptive();
+    }
+
+    // Spread the probes over frames, the tracker carries the target in between.
+    uint32_t budget = static_cast<uint32_t>(std::clamp(
+        g_settings().DriveAssists.CruiseControl.RaysPerFrame.Value(), 1, static_cast<int>(numProbeRays)));
+    probeRays.Prepare(g_playerVehicle);
+    probeResults.clear();
+    probeScheduler.Update(budget, probeResults);
+    const Cruise::LeadTarget& lead = leadTracker.Update(NativeCache::GetFrameTime(), g_vehData.mVelocity.y, probeResults);
+    bool hit = lead.Valid;
 
     // Distances need to scale with vehicles' own speed.
     // min: Distance where it should match speed
@@ -239,7 +242,6 @@ void UpdateAdaptive(float& targetSetpoint, float& brakeValue) {
 
     if (hit) {
         adaptiveActive = true;
-        //UI::DrawSphere(hitCoord, 0.10f, Util::ColorsI::SolidPink);
 
         const float distMinSpdMult = g_settings().DriveAssists.CruiseControl.MinDistanceSpeedMult;
         const float distMaxSpdMult = g_settings().DriveAssists.CruiseControl.MaxDistanceSpeedMult;
@@ -247,9 +249,9 @@ void UpdateAdaptive(float& targetSetpoint, float& brakeValue) {
         float distMin = std::max(g_vehData.mDimMax.y + minFollowDistance, g_vehData.mVelocity.y * distMinSpdMult);
         float distMax = std::clamp(distMin + g_vehData.mVelocity.y * distMaxSpdMult, distMin, maxFollowDistance);
 
-        auto vehPos = ENTITY::GET_ENTITY_COORDS(g_playerVehicle, true);
-        float distance = Distance(vehPos, hitCoord);
-        float otherSpeed = ENTITY::GET_ENTITY_SPEED_VECTOR(hitEntity, true).y;
+        // Rays start at the front, distances below are from the vehicle origin.
+        float distance = g_vehData.mDimMax.y + lead.Distance;
+        float otherSpeed = lead.Speed;
         float deltaSpeed = g_vehData.mVelocity.y - otherSpeed;
 
         if (distance < distMax) {
@@ -278,9 +280,13 @@ void UpdateAdaptive(float& targetSetpoint, float& brakeValue) {
         }
 
         if (g_settings.Debug.DisplayInfo) {
-            auto entityCoords = ENTITY::GET_ENTITY_COORDS(hitEntity, true);
+            auto entityCoords = NativeCache::GetEntityCoords(lead.Entity);
             entityCoords.z += 2.0f;
-            UI::ShowText3D(entityCoords, { "Adaptive CC Target", std::format("Distance: {:.0f}", result.Distance) });
+            UI::ShowText3D(entityCoords, {
+                "Adaptive CC Target",
+                std::format("Distance: {:.0f}", lead.Distance),
+                std::format("Speed: {:.1f}", lead.Speed),
+            });
             UI::DrawSphere(entityCoords, 0.25f, Util::ColorsI::SolidWhite);
         }
     }
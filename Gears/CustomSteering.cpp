@@ -2,9 +2,12 @@
 
 #include "SteeringAnim.h"
 #include "ScriptSettings.hpp"
+#include "VehicleData.hpp"
+#include "VehicleModelCache.h"
 #include "Util/MathExt.h"
 #include "Util/UIUtils.h"
 #include "Util/ScriptUtils.h"
+#include "Util/NativeCache.h"
 #include "Memory/VehicleExtensions.hpp"
 #include "Memory/VehicleBone.h"
 
@@ -20,6 +23,7 @@ extern Vehicle g_playerVehicle;
 extern Ped g_playerPed;
 extern ScriptSettings g_settings;
 extern CarControls g_controls;
+extern VehicleData g_vehData;
 
 namespace {
     float steerPrev = 0.0f;
@@ -47,7 +51,7 @@ float CustomSteering::calculateReduction() {
     Vehicle mVehicle = g_playerVehicle;
     float mult = 1;
     Vector3 vel = ENTITY::GET_ENTITY_VELOCITY(mVehicle);
-    Vector3 pos = ENTITY::GET_ENTITY_COORDS(mVehicle, 1);
+    Vector3 pos = NativeCache::GetEntityCoords(mVehicle);
     Vector3 motion = ENTITY::GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS(mVehicle, pos + vel);
     if (motion.y > 3) {
         mult = 0.15f + powf(0.9f, abs(motion.y) - 7.2f);
@@ -63,7 +67,7 @@ float CustomSteering::calculateDesiredHeading(float steeringMax, float desiredHe
     // Scale input with both reduction and steering limit
     float correction;
 
-    Vector3 speedVector = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
+    Vector3 speedVector = NativeCache::GetEntitySpeedVector(g_playerVehicle, true);
     if (abs(speedVector.y) > 3.0f) {
         Vector3 target = Normalize(speedVector);
         float travelDir = atan2(target.y, target.x) - static_cast<float>(M_PI) / 2.0f;
@@ -100,8 +104,8 @@ float CustomSteering::calculateDesiredHeading(float steeringMax, float desiredHe
 void CustomSteering::DrawDebug() {
     float steeringAngle = VExt::GetSteeringAngle(g_playerVehicle);
 
-    Vector3 speedVector = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
-    Vector3 positionWorld = ENTITY::GET_ENTITY_COORDS(g_playerVehicle, 1);
+    Vector3 speedVector = NativeCache::GetEntitySpeedVector(g_playerVehicle, true);
+    Vector3 positionWorld = NativeCache::GetEntityCoords(g_playerVehicle);
     Vector3 travelRelative = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle, speedVector);
 
     float steeringAngleRelX = ENTITY::GET_ENTITY_SPEED(g_playerVehicle) * -sin(steeringAngle);
@@ -137,14 +141,7 @@ void disableControls() {
     // 7: Amphibious bike
     int modelType = VExt::GetModelType(g_playerVehicle);
     bool isFrog = modelType == 5 || modelType == 6 || modelType == 7;//*(int*)(modelInfo + 0x340) == 6 || *(int*)(modelInfo + 0x340) == 7;
-    bool hasFork = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "forks") != -1;
-    bool hasTow = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "tow_arm") != -1;
-    bool hasScoop = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "scoop") != -1;
-    bool hasFrame1 = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "frame_1") != -1;
-    bool hasFrame2 = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "frame_2") != -1;
-    bool hasFrame = hasFrame1 && hasFrame2;
-
-    bool hasEquipment = hasFork || hasTow || hasScoop || hasFrame;
+    bool hasEquipment = g_vehData.mModelInfo && g_vehData.mModelInfo->HasEquipment;
 
     float hoverRatio = VExt::GetHoverTransformRatio(g_playerVehicle);
 
@@ -264,11 +261,13 @@ void CustomSteering::Update() {
 
     VExt::SetSteeringInputAngle(g_playerVehicle, desiredHeading * (1.0f / limitRadians));
 
-    if (!VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle))
+    if (!NativeCache::GetIsVehicleEngineRunning(g_playerVehicle))
         VExt::SetSteeringAngle(g_playerVehicle, desiredHeading);
 
-    auto boneIdx = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "steeringwheel");
-    if (boneIdx != -1 && g_settings().Steering.CustomSteering.UseCustomLock) {
+    if (g_vehData.mModelInfo && g_vehData.mModelInfo->SteeringWheel.Valid() &&
+        g_settings().Steering.CustomSteering.UseCustomLock) {
+        const auto& steeringWheel = g_vehData.mModelInfo->SteeringWheel;
+
         Vector3 rotAxis{};
         rotAxis.y = 1.0f;
 
@@ -282,8 +281,8 @@ void CustomSteering::Update() {
             scale.z = 0.0f;
         }
 
-        VehicleBones::RotateAxisAbsolute(g_playerVehicle, boneIdx, rotAxis, rotRad);
-        VehicleBones::Scale(g_playerVehicle, boneIdx, scale);
+        VehicleBones::RotateAxisAbsolute(g_playerVehicle, steeringWheel.Index, steeringWheel.Original, rotAxis, rotRad);
+        VehicleBones::Scale(g_playerVehicle, steeringWheel.Index, scale);
         SteeringAnimation::SetRotation(rotRad);
     }
 }
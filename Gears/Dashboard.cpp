@@ -3,11 +3,13 @@
 #include "ScriptHUD.h"
 #include "ScriptSettings.hpp"
 #include "VehicleData.hpp"
+#include "VehicleModelCache.h"
 #include "Memory/VehicleBone.h"
 
 #include "Input/CarControls.hpp"
 #include "Util/MathExt.h"
 #include "Util/ScriptUtils.h"
+#include "Util/NativeCache.h"
 
 #include <GTAVDashHook/DashHook/DashHook.h>
 
@@ -29,7 +31,7 @@ void Dashboard::Update() {
     if (!g_settings.Misc.DashExtensions)
         return;
 
-    if (!Util::VehicleAvailable(g_playerVehicle, g_playerPed))
+    if (!Util::VehicleAvailable(g_playerVehicle, g_playerPed) || !g_vehData.mModelInfo)
         return;
 
     VehicleDashboardData data{};
@@ -59,32 +61,33 @@ void Dashboard::Update() {
             data.oilPressure = lerp(
                 data.oilPressure,
                 AWD::GetTransferValue(),
-                1.0f - pow(0.0001f, MISC::GET_FRAME_TIME()));
+                1.0f - pow(0.0001f, NativeCache::GetFrameTime()));
             // https://www.gta5-mods.com/vehicles/nissan-skyline-gt-r-bnr32
             // oil pressure gauge uses data.temp
             // battery voltage uses data.temp
         }
         else if (g_settings().DriveAssists.AWD.SpecialFlags & AWD::AWD_REMAP_DIAL_WANTED188_R32) {
-            auto boneIdx = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "needle_torque");
-            if (boneIdx != -1) {
+            const auto& needleTorque = g_vehData.mModelInfo->NeedleTorque;
+            if (needleTorque.Valid()) {
                 Vector3 rotAxis{};
                 rotAxis.y = 1.0f;
 
                 AWD::GetDisplayValue() = lerp(
                     AWD::GetDisplayValue(), AWD::GetTransferValue(),
-                    1.0f - pow(0.0001f, MISC::GET_FRAME_TIME()));
+                    1.0f - pow(0.0001f, NativeCache::GetFrameTime()));
 
-                VehicleBones::RotateAxisAbsolute(g_playerVehicle, boneIdx, rotAxis, AWD::GetDisplayValue());
+                VehicleBones::RotateAxisAbsolute(g_playerVehicle, needleTorque.Index, needleTorque.Original,
+                    rotAxis, AWD::GetDisplayValue());
             }
 
-            boneIdx = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "needle_speedo");
-            if (boneIdx != -1) {
+            const auto& needleSpeedo = g_vehData.mModelInfo->NeedleSpeedo;
+            if (needleSpeedo.Valid()) {
                 Vector3 rotAxis{};
                 rotAxis.y = 1.0f;
 
                 float rotation = map(abs(g_vehData.mDiffSpeed), 0.0f, 51.0f, 0.0f, deg2rad(240.0f));
 
-                float maxDelta = MISC::GET_FRAME_TIME() * 1.0f;
+                float maxDelta = NativeCache::GetFrameTime() * 1.0f;
 
                 if (abs(rotation - lastSpeedoRotation) > maxDelta)
                     rotation = lastSpeedoRotation + maxDelta * sgn(rotation - lastSpeedoRotation);
@@ -93,7 +96,8 @@ void Dashboard::Update() {
 
                 rotation = std::clamp(lastSpeedoRotation, 0.0f, deg2rad(240.0f));
 
-                VehicleBones::RotateAxisAbsolute(g_playerVehicle, boneIdx, rotAxis, rotation);
+                VehicleBones::RotateAxisAbsolute(g_playerVehicle, needleSpeedo.Index, needleSpeedo.Original,
+                    rotAxis, rotation);
             }
         }
     }
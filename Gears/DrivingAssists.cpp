@@ -8,9 +8,13 @@
 
 #include "Util/MathExt.h"
 #include "Util/UIUtils.h"
+#include "Util/NativeCache.h"
+#include "Util/LazyValue.h"
+#include "Util/Scheduler.h"
 
 #include <inc/natives.h>
 #include <fmt/format.h>
+#include <algorithm>
 
 using VExt = VehicleExtensions;
 
@@ -19,7 +23,86 @@ extern Vehicle g_playerVehicle;
 extern VehicleData g_vehData;
 extern CarControls g_controls;
 
-DrivingAssists::ABSData DrivingAssists::GetABS() {
+using namespace DrivingAssists;
+
+namespace {
+    struct WheelLayout {
+        Vehicle Vehicle = 0;
+        uint8_t NumWheels = 0;
+        uint8_t NumAxles = 0;
+        uint8_t FrontAxles = 0;
+        uint8_t RearAxles = 0;
+        // Axle index per wheel, front to rear
+        std::array<uint8_t, MaxWheels> Axle{};
+        // -1: left, 1: right, 0: centered (bikes, trikes)
+        std::array<int8_t, MaxWheels> Side{};
+        // Ahead of the center, uses the front brake bias
+        WheelBools Front{};
+        std::array<bool, MaxAxles> AxleFront{};
+        // Left and right wheels at both ends, so ESP can brake one side
+        bool Lateral = false;
+    };
+
+    // Wheels closer than this along the vehicle share an axle (twin rear wheels, tandem bogies don't)
+    constexpr float axleTolerance = 0.3f;
+    // Wheels closer than this to the center line have no side
+    constexpr float sideTolerance = 0.05f;
+
+    WheelLayout wheelLayout;
+
+    // Wheels don't move around, so this only changes with the vehicle.
+    const WheelLayout& getLayout() {
+        uint8_t numWheels = std::min(g_vehData.mWheelCount, MaxWheels);
+        if (wheelLayout.Vehicle == g_playerVehicle && wheelLayout.NumWheels == numWheels)
+            return wheelLayout;
+
+        WheelLayout layout;
+        layout.Vehicle = g_playerVehicle;
+        layout.NumWheels = numWheels;
+
+        const auto offsets = VExt::GetWheelOffsets(g_playerVehicle);
+        numWheels = std::min(numWheels, static_cast<uint8_t>(offsets.size()));
+        layout.NumWheels = numWheels;
+
+        std::array<uint8_t, MaxWheels> order{};
+        for (uint8_t i = 0; i < numWheels; ++i) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.begin() + numWheels, [&offsets](uint8_t a, uint8_t b) {
+            return offsets[a].y > offsets[b].y;
+        });
+
+        float axleY = 0.0f;
+        bool sides[2][2]{}; // [rear][right]
+        for (uint8_t n = 0; n < numWheels; ++n) {
+            uint8_t i = order[n];
+            if (n == 0 || (axleY - offsets[i].y > axleTolerance && layout.NumAxles < MaxAxles)) {
+                axleY = offsets[i].y;
+                layout.AxleFront[layout.NumAxles] = offsets[i].y > 0.0f;
+                ++layout.NumAxles;
+            }
+
+            layout.Axle[i] = layout.NumAxles - 1;
+            layout.Front[i] = offsets[i].y > 0.0f;
+            layout.Side[i] = offsets[i].x < -sideTolerance ? -1 : offsets[i].x > sideTolerance ? 1 : 0;
+            if (layout.Side[i] != 0)
+                sides[layout.Front[i] ? 0 : 1][layout.Side[i] > 0 ? 1 : 0] = true;
+        }
+
+        for (uint8_t a = 0; a < layout.NumAxles; ++a) {
+            if (layout.AxleFront[a])
+                ++layout.FrontAxles;
+            else
+                ++layout.RearAxles;
+        }
+        layout.Lateral = sides[0][0] && sides[0][1] && sides[1][0] && sides[1][1];
+
+        wheelLayout = layout;
+        return wheelLayout;
+    }
+}
+
+ABSData calculateABS() {
     bool lockedUp = false;
     auto brakePressures = VExt::GetWheelBrakePressure(g_playerVehicle);
     for (int i = 0; i < g_vehData.mWheelCount; i++) {
@@ -37,8 +120,9 @@ DrivingAssists::ABSData DrivingAssists::GetABS() {
     return { false };
 }
 
-DrivingAssists::TCSData DrivingAssists::GetTCS() {
-    std::vector<float> slips(g_vehData.mWheelCount);
+TCSData calculateTCS() {
+    WheelFloats slips{};
+    const uint8_t numWheels = getLayout().NumWheels;
     bool tractionLoss = false;
     float averageLoss = 0.0f;
     float maxWheelSpeed = 0.0f;
@@ -46,20 +130,17 @@ DrivingAssists::TCSData DrivingAssists::GetTCS() {
     float minLoss = std::min(g_settings().DriveAssists.TCS.SlipMin, g_settings().DriveAssists.LaunchControl.SlipMin);
     auto pows = VExt::GetWheelPower(g_playerVehicle);
 
-    auto posWorld = ENTITY::GET_ENTITY_COORDS(g_playerVehicle, 0);
-    auto boneVels = VExt::GetWheelBoneVelocity(g_playerVehicle);
+    auto boneVelsRel = TransformDirections(g_vehData.GetWorldToLocal(),
+        VExt::GetWheelBoneVelocity(g_playerVehicle));
     auto steeringAngles = VExt::GetWheelSteeringAngles(g_playerVehicle);
 
-    for (int i = 0; i < g_vehData.mWheelCount; i++) {
+    for (uint8_t i = 0; i < numWheels; i++) {
         if (!g_vehData.mWheelsDriven[i] ||
             g_vehData.mSuspensionTravel[i] == 0.0f ||
             pows[i] < 0.01f)
             continue;
 
-        auto boneVelProjection = posWorld + boneVels[i];
-        auto boneVelRel = ENTITY::GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS(g_playerVehicle, boneVelProjection);
-
-        float rotatedY = boneVelRel.y / cos(steeringAngles[i]);
+        float rotatedY = boneVelsRel[i].y / cos(steeringAngles[i]);
         slips[i] = g_vehData.mWheelTyreSpeeds[i] / rotatedY;
 
         if (slips[i] > g_settings().DriveAssists.TCS.SlipMin) {
@@ -90,10 +171,10 @@ DrivingAssists::TCSData DrivingAssists::GetTCS() {
     };
 }
 
-DrivingAssists::ESPData DrivingAssists::GetESP() {
+ESPData calculateESP() {
     ESPData espData{};
     float speed = ENTITY::GET_ENTITY_SPEED(g_playerVehicle);
-    Vector3 vecNextSpd = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
+    Vector3 vecNextSpd = NativeCache::GetEntitySpeedVector(g_playerVehicle, true);
     Vector3 rotVel = ENTITY::GET_ENTITY_ROTATION_VELOCITY(g_playerVehicle);
     Vector3 rotRelative{
         speed * -sin(rotVel.z),
@@ -105,7 +186,7 @@ DrivingAssists::ESPData DrivingAssists::GetESP() {
 
     // understeer
     {
-        auto slipInfos = WheelInput::CalculateSlipInfo();
+        const auto& slipInfos = WheelInput::GetSlipInfo();
 
         Vector3 vecNextRot = (vecNextSpd + rotRelative) * 0.5f;
         Vector3 vecPredStr{
@@ -168,7 +249,7 @@ DrivingAssists::ESPData DrivingAssists::GetESP() {
     for (bool value : g_vehData.mWheelsOnGround) {
         anyWheelOnGround |= value;
     }
-    if (g_settings().DriveAssists.ESP.Enable && g_vehData.mWheelCount == 4 && anyWheelOnGround) {
+    if (g_settings().DriveAssists.ESP.Enable && getLayout().Lateral && anyWheelOnGround) {
         if (espData.Oversteer || espData.Understeer) {
             espData.Use = true;
         }
@@ -177,174 +258,241 @@ DrivingAssists::ESPData DrivingAssists::GetESP() {
     return espData;
 }
 
-DrivingAssists::LSDData DrivingAssists::GetLSD() {
+LSDData calculateLSD() {
     LSDData lsdData{};
+    const auto& layout = getLayout();
+    lsdData.NumAxles = layout.NumAxles;
 
     if (g_settings().DriveAssists.LSD.Enable &&
-        g_vehData.mWheelCount == 4 &&
         g_vehData.mDiffSpeed > 0.0f &&
         !VExt::GetHandbrake(g_playerVehicle) &&
         !VEHICLE::IS_VEHICLE_IN_BURNOUT(g_playerVehicle)) {
         auto angularVelocities = VExt::GetWheelRotationSpeeds(g_playerVehicle);
-        float WheelSpeedLF = angularVelocities[0];
-        float WheelSpeedRF = angularVelocities[1];
-        float WheelSpeedLR = angularVelocities[2];
-        float WheelSpeedRR = angularVelocities[3];
 
         float visc = g_settings().DriveAssists.LSD.Viscosity;
         float dbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fDriveBiasFront);
         float dbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fDriveBiasRear);
         float clutch = std::clamp(g_vehData.mClutch, 0.0f, 1.0f);
 
-        // pos: neg brake left, neg throttle right
-        float frontDiffDiff = (WheelSpeedLF - WheelSpeedRF) / (WheelSpeedLF + WheelSpeedRF);
-        if (WheelSpeedLF == 0.0f || WheelSpeedRF == 0.0f)
-            frontDiffDiff = 0.0f;
-        lsdData.BrakeLF = frontDiffDiff / 2.0f * dbalF * visc * g_vehData.mThrottle * clutch;
-        lsdData.BrakeRF = -frontDiffDiff / 2.0f * dbalF * visc * g_vehData.mThrottle * clutch;
-        lsdData.FDD = frontDiffDiff;
-
-        float rearDiffDiff = (WheelSpeedLR - WheelSpeedRR) / (WheelSpeedLR + WheelSpeedRR);
-        if (WheelSpeedLR == 0.0f || WheelSpeedRR == 0.0f)
-            rearDiffDiff = 0.0f;
-        lsdData.BrakeLR = rearDiffDiff / 2.0f * dbalR * visc * g_vehData.mThrottle * clutch;
-        lsdData.BrakeRR = -rearDiffDiff / 2.0f * dbalR * visc * g_vehData.mThrottle * clutch;
-        lsdData.RDD = rearDiffDiff;
-
-        if (lsdData.BrakeLF > 0.0f) { lsdData.BrakeLF = 0.0f; }
-        if (lsdData.BrakeRF > 0.0f) { lsdData.BrakeRF = 0.0f; }
-        if (lsdData.BrakeLR > 0.0f) { lsdData.BrakeLR = 0.0f; }
-        if (lsdData.BrakeRR > 0.0f) { lsdData.BrakeRR = 0.0f; }
-
-        auto unBrakes = {
-            lsdData.BrakeLF,
-            lsdData.BrakeRF,
-            lsdData.BrakeLR,
-            lsdData.BrakeRR
-        };
+        // Average per side, for axles with twin wheels
+        std::array<float, MaxAxles> speedLeft{};
+        std::array<float, MaxAxles> speedRight{};
+        std::array<uint8_t, MaxAxles> numLeft{};
+        std::array<uint8_t, MaxAxles> numRight{};
+        for (uint8_t i = 0; i < layout.NumWheels && i < angularVelocities.size(); ++i) {
+            uint8_t axle = layout.Axle[i];
+            if (layout.Side[i] < 0) {
+                speedLeft[axle] += angularVelocities[i];
+                ++numLeft[axle];
+            }
+            else if (layout.Side[i] > 0) {
+                speedRight[axle] += angularVelocities[i];
+                ++numRight[axle];
+            }
+        }
+
+        float minBrake = 0.0f;
+        for (uint8_t a = 0; a < layout.NumAxles; ++a) {
+            if (numLeft[a] == 0 || numRight[a] == 0)
+                continue;
+
+            float wheelSpeedL = speedLeft[a] / static_cast<float>(numLeft[a]);
+            float wheelSpeedR = speedRight[a] / static_cast<float>(numRight[a]);
+            float dbal = layout.AxleFront[a] ? dbalF : dbalR;
+
+            // pos: neg brake left, neg throttle right
+            float diffDiff = (wheelSpeedL - wheelSpeedR) / (wheelSpeedL + wheelSpeedR);
+            if (wheelSpeedL == 0.0f || wheelSpeedR == 0.0f)
+                diffDiff = 0.0f;
+
+            auto& axle = lsdData.Axles[a];
+            axle.SpeedDiff = diffDiff;
+            axle.BrakeLeft = std::min(diffDiff / 2.0f * dbal * visc * g_vehData.mThrottle * clutch, 0.0f);
+            axle.BrakeRight = std::min(-diffDiff / 2.0f * dbal * visc * g_vehData.mThrottle * clutch, 0.0f);
+            minBrake = std::min({ minBrake, axle.BrakeLeft, axle.BrakeRight });
+        }
 
-        if (*std::min_element(unBrakes.begin(), unBrakes.end()) < -0.05f) {
+        if (minBrake < -0.05f) {
             lsdData.Use = true;
+            for (uint8_t i = 0; i < layout.NumWheels; ++i) {
+                const auto& axle = lsdData.Axles[layout.Axle[i]];
+                if (layout.Side[i] < 0)
+                    lsdData.Brake[i] = axle.BrakeLeft;
+                else if (layout.Side[i] > 0)
+                    lsdData.Brake[i] = axle.BrakeRight;
+            }
         }
         else {
             lsdData.Use = false;
-            lsdData.BrakeLR = 0.0f;
-            lsdData.BrakeRR = 0.0f;
-            lsdData.BrakeLF = 0.0f;
-            lsdData.BrakeRF = 0.0f;
+            for (auto& axle : lsdData.Axles) {
+                axle.BrakeLeft = 0.0f;
+                axle.BrakeRight = 0.0f;
+            }
         }
     }
     return lsdData;
 }
 
-std::vector<float> DrivingAssists::GetESPBrakes(ESPData espData) {
-    std::vector<float> brakeVals(g_vehData.mWheelCount); // only works for 4 wheels but ok
-
-    if (g_vehData.mWheelCount != 4 ||
-        ENTITY::GET_ENTITY_SPEED(g_playerVehicle) < 1.0f) {
-        const float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
-        const float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
-        const auto offsets = VExt::GetWheelOffsets(g_playerVehicle);
-        const float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-        float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
-        for (uint8_t i = 0; i < g_vehData.mWheelCount; i++) {
-            float bbal = offsets[i].y > 0.0f ? bbalF : bbalR;
-
-            brakeVals[i] = inpBrakeForce * bbal;
-        }
-
-        return brakeVals;
-    }
+namespace {
+    LazyValue<ABSData> absValue("ABS", calculateABS);
+    LazyValue<TCSData> tcsValue("TCS", calculateTCS);
+    LazyValue<ESPData> espValue("ESP", calculateESP);
+    LazyValue<LSDData> lsdValue("LSD", calculateLSD);
 
-    float steerMult = g_settings().Steering.CustomSteering.SteeringMult;
-    if (g_controls.PrevInput == CarControls::InputDevices::Wheel)
-        steerMult = g_settings().Steering.Wheel.SteeringMult;
-    float avgAngle = VExt::GetWheelAverageAngle(g_playerVehicle) * steerMult;
-
-    float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-    float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
-    float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
-    float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
+    // Wheel speeds and slip don't change meaningfully faster than this.
+    Scheduler::Task assistTask("Assists", 60.0f);
+}
 
-    for (auto i = 0; i < g_vehData.mWheelCount; ++i) {
-        g_vehData.mWheelsAbs[i] = false;
+void DrivingAssists::Update() {
+    // Between steps, brake patching keeps acting on the last results.
+    if (assistTask.Advance(NativeCache::GetFrameTime()) == 0) {
+        absValue.Hold();
+        tcsValue.Hold();
+        espValue.Hold();
+        lsdValue.Hold();
     }
-    float avgAngle_ = -avgAngle;
-    if (espData.OppositeLock) {
-        avgAngle_ = avgAngle;
-    }
-    float oversteerAngleDeg = abs(rad2deg(espData.OversteerAngle));
-    float overMin = g_settings().DriveAssists.ESP.OverMin;
-    float overMax = g_settings().DriveAssists.ESP.OverMax;
-    float overMinComp = g_settings().DriveAssists.ESP.OverMinComp;
-    float overMaxComp = g_settings().DriveAssists.ESP.OverMaxComp;
-    float oversteerComp = map(oversteerAngleDeg,
-        overMin, overMax,
-        overMinComp, overMaxComp);
-
-    float oversteerAdd = handlingBrakeForce * oversteerComp;
-
-
-    float oversteerRearAdd = handlingBrakeForce * map(
-        oversteerAngleDeg, overMax, overMax * 2.0f,
-        overMinComp, overMaxComp);
-    oversteerRearAdd = std::clamp(oversteerRearAdd, 0.0f, overMaxComp);
+}
 
-    float understeerAngleDeg(abs(rad2deg(espData.UndersteerAngle)));
+void DrivingAssists::Reset() {
+    assistTask.Reset();
+    absValue.Invalidate();
+    tcsValue.Invalidate();
+    espValue.Invalidate();
+    lsdValue.Invalidate();
+}
 
-    float underMin = g_settings().DriveAssists.ESP.UnderMin;
-    float underMax = g_settings().DriveAssists.ESP.UnderMax;
-    float underMinComp = g_settings().DriveAssists.ESP.UnderMinComp;
-    float underMaxComp = g_settings().DriveAssists.ESP.UnderMaxComp;
+const DrivingAssists::ABSData& DrivingAssists::GetABS() {
+    return absValue.Get();
+}
 
-    float understeerComp = map(understeerAngleDeg,
-        underMin, underMax,
-        underMinComp, underMaxComp);
+const DrivingAssists::TCSData& DrivingAssists::GetTCS() {
+    return tcsValue.Get();
+}
 
-    float understeerAdd = handlingBrakeForce * understeerComp;
+const DrivingAssists::ESPData& DrivingAssists::GetESP() {
+    return espValue.Get();
+}
 
-    float brkFBase = inpBrakeForce * bbalF;
-    brakeVals[0] = brkFBase + (avgAngle_ < 0.0f && espData.Oversteer ? oversteerAdd : 0.0f);
-    brakeVals[1] = brkFBase + (avgAngle_ > 0.0f && espData.Oversteer ? oversteerAdd : 0.0f);
+const DrivingAssists::LSDData& DrivingAssists::GetLSD() {
+    return lsdValue.Get();
+}
 
-    float brkRBase = inpBrakeForce * bbalR;
-    float brkRUnderL = (avgAngle > 0.0f && espData.Understeer ? understeerAdd : 0.0f);
-    float brkRUnderR = (avgAngle < 0.0f && espData.Understeer ? understeerAdd : 0.0f);
+bool DrivingAssists::GetBrakes(const ABSData& absData, const TCSData& tcsData, const ESPData& espData,
+                               const LSDData& lsdData, BrakeOutput& output) {
+    const auto& layout = getLayout();
 
-    float brkROverL = (avgAngle_ < 0.0f && espData.Oversteer ? oversteerRearAdd : 0.0f);
-    float brkROverR = (avgAngle_ > 0.0f && espData.Oversteer ? oversteerRearAdd : 0.0f);
+    bool handbrake = g_controls.UseAnalogHandbrake && g_controls.HandbrakeVal > 0.01f;
+    bool tcsBrakes = tcsData.Use && g_settings().DriveAssists.TCS.Mode == 0;
+    bool assists = handbrake || espData.Use || tcsBrakes || absData.Use;
+    // Only use LSD if no other assists are working, as LSD would just reduce brake force.
+    bool lsdOnly = lsdData.Use && !espData.Use && !tcsData.Use && !absData.Use;
 
-    brakeVals[2] = brkRBase + brkRUnderL + brkROverL;
-    brakeVals[3] = brkRBase + brkRUnderR + brkROverR;
+    if (!assists && !lsdOnly)
+        return false;
 
-    g_vehData.mWheelsEspO[0] = avgAngle_ < 0.0f && espData.Oversteer ? true : false;
-    g_vehData.mWheelsEspO[1] = avgAngle_ > 0.0f && espData.Oversteer ? true : false;
-    g_vehData.mWheelsEspU[2] = avgAngle > 0.0f && espData.Understeer ? true : false;
-    g_vehData.mWheelsEspU[3] = avgAngle < 0.0f && espData.Understeer ? true : false;
+    const float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
+    const float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
+    const float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
+    const float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
 
-    g_vehData.mWheelsEspO[2] = avgAngle_ < 0.0f && oversteerRearAdd > 0.0f ? true : false;
-    g_vehData.mWheelsEspO[3] = avgAngle_ > 0.0f && oversteerRearAdd > 0.0f ? true : false;
+    output.NumWheels = layout.NumWheels;
+    output.Handbrake.fill(false);
 
-    return brakeVals;
-}
+    if (!assists) {
+        for (uint8_t i = 0; i < layout.NumWheels; ++i) {
+            float bbal = layout.Front[i] ? bbalF : bbalR;
+            output.Pressure[i] = lsdData.Brake[i] + inpBrakeForce * bbal;
+        }
+        return true;
+    }
 
-std::vector<float> DrivingAssists::GetTCSBrakes(TCSData tcsData) {
-    std::vector<float> brakeVals(g_vehData.mWheelCount);
-    const auto offsets = VExt::GetWheelOffsets(g_playerVehicle);
+    const float handlingHandbrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fHandBrakeForce);
+    const float handbrakeForce = handlingHandbrakeForce * g_controls.HandbrakeVal;
+
+    // ESP: extra brake force per side ([0]: left, [1]: right), spread over the axles at each end.
+    // A regular car gets the full correction on each wheel.
+    float espFrontAdd[2]{};
+    float espRearAdd[2]{};
+    bool espOver[2]{};
+    bool espRearUnder[2]{};
+    bool espRearOver[2]{};
+    bool espActive = layout.Lateral && ENTITY::GET_ENTITY_SPEED(g_playerVehicle) >= 1.0f;
+    if (espActive) {
+        float steerMult = g_settings().Steering.CustomSteering.SteeringMult;
+        if (g_controls.PrevInput == CarControls::InputDevices::Wheel)
+            steerMult = g_settings().Steering.Wheel.SteeringMult;
+        float avgAngle = VExt::GetWheelAverageAngle(g_playerVehicle) * steerMult;
+
+        float avgAngle_ = -avgAngle;
+        if (espData.OppositeLock) {
+            avgAngle_ = avgAngle;
+        }
+        float oversteerAngleDeg = abs(rad2deg(espData.OversteerAngle));
+        float overMin = g_settings().DriveAssists.ESP.OverMin;
+        float overMax = g_settings().DriveAssists.ESP.OverMax;
+        float overMinComp = g_settings().DriveAssists.ESP.OverMinComp;
+        float overMaxComp = g_settings().DriveAssists.ESP.OverMaxComp;
+        float oversteerComp = map(oversteerAngleDeg,
+            overMin, overMax,
+            overMinComp, overMaxComp);
+
+        float oversteerAdd = handlingBrakeForce * oversteerComp;
+
+        float oversteerRearAdd = handlingBrakeForce * map(
+            oversteerAngleDeg, overMax, overMax * 2.0f,
+            overMinComp, overMaxComp);
+        oversteerRearAdd = std::clamp(oversteerRearAdd, 0.0f, overMaxComp);
+
+        float understeerAngleDeg(abs(rad2deg(espData.UndersteerAngle)));
+
+        float underMin = g_settings().DriveAssists.ESP.UnderMin;
+        float underMax = g_settings().DriveAssists.ESP.UnderMax;
+        float underMinComp = g_settings().DriveAssists.ESP.UnderMinComp;
+        float underMaxComp = g_settings().DriveAssists.ESP.UnderMaxComp;
+
+        float understeerComp = map(understeerAngleDeg,
+            underMin, underMax,
+            underMinComp, underMaxComp);
+
+        float understeerAdd = handlingBrakeForce * understeerComp;
+
+        espOver[0] = avgAngle_ < 0.0f && espData.Oversteer;
+        espOver[1] = avgAngle_ > 0.0f && espData.Oversteer;
+        espRearUnder[0] = avgAngle > 0.0f && espData.Understeer;
+        espRearUnder[1] = avgAngle < 0.0f && espData.Understeer;
+        espRearOver[0] = avgAngle_ < 0.0f && oversteerRearAdd > 0.0f;
+        espRearOver[1] = avgAngle_ > 0.0f && oversteerRearAdd > 0.0f;
+
+        for (int side = 0; side < 2; ++side) {
+            // Oversteer brakes the same side front and rear, the rear only once well past the limit.
+            float rearOver = espOver[side] ? oversteerRearAdd : 0.0f;
+            float rearUnder = espRearUnder[side] ? understeerAdd : 0.0f;
+            espFrontAdd[side] = (espOver[side] ? oversteerAdd : 0.0f) / static_cast<float>(std::max(layout.FrontAxles, uint8_t(1)));
+            espRearAdd[side] = (rearUnder + rearOver) / static_cast<float>(std::max(layout.RearAxles, uint8_t(1)));
+        }
+    }
 
-    const float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-    const float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
-    const float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
+    const float fullBrakePower = handlingBrakeForce * g_settings().DriveAssists.TCS.BrakeMult;
+    const float tcsSlipMin = g_settings().DriveAssists.TCS.SlipMin;
+    const float tcsSlipMax = g_settings().DriveAssists.TCS.SlipMax;
 
-    float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
-    float fullBrakePower = handlingBrakeForce * g_settings().DriveAssists.TCS.BrakeMult;
+    for (uint8_t i = 0; i < layout.NumWheels; ++i) {
+        const bool front = layout.Front[i];
+        const float bbal = front ? bbalF : bbalR;
+        const float inputBrake = inpBrakeForce * bbal;
+        const int side = layout.Side[i] < 0 ? 0 : 1;
 
-    float tcsSlipMin = g_settings().DriveAssists.TCS.SlipMin;
-    float tcsSlipMax = g_settings().DriveAssists.TCS.SlipMax;
+        float espBrake = inputBrake;
+        if (espActive) {
+            bool sided = layout.Side[i] != 0;
+            if (sided)
+                espBrake += front ? espFrontAdd[side] : espRearAdd[side];
 
-    for (int i = 0; i < g_vehData.mWheelCount; i++) {
-        float bbal = offsets[i].y > 0.0f ? bbalF : bbalR;
+            g_vehData.mWheelsEspO[i] = sided && (front ? espOver[side] : espRearOver[side]);
+            g_vehData.mWheelsEspU[i] = sided && !front && espRearUnder[side];
+        }
 
+        float tcsBrake = inputBrake;
         if (tcsData.LinearSlipRatio[i] > tcsSlipMin &&
             g_vehData.mWheelTyreSpeeds[i] > 10.0f &&
             g_vehData.mSuspensionTravel[i] > 0.0f) {
@@ -353,68 +501,37 @@ std::vector<float> DrivingAssists::GetTCSBrakes(TCSData tcsData) {
                 tcsSlipMin, tcsSlipMax,
                 0.0f, fullBrakePower);
             mappedVal = std::clamp(mappedVal, 0.0f, fullBrakePower);
-
-            brakeVals[i] = std::max(inpBrakeForce * bbal, mappedVal * bbal);
+            tcsBrake = std::max(inputBrake, mappedVal * bbal);
         }
-        else {
-            brakeVals[i] = inpBrakeForce * bbal;
-        }
-    }
-
-    return brakeVals;
-}
-
-std::vector<float> DrivingAssists::GetABSBrakes(ABSData absData) {
-    std::vector<float> brakeVals(g_vehData.mWheelCount);
-    const auto offsets = VExt::GetWheelOffsets(g_playerVehicle);
-
-    const float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-    const float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
-    const float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
-
-    float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
 
-    for (uint8_t i = 0; i < g_vehData.mWheelsLockedUp.size(); i++) {
-        float bbal = offsets[i].y > 0.0f ? bbalF : bbalR;
+        // ABS releases locked wheels entirely
+        g_vehData.mWheelsAbs[i] = g_vehData.mWheelsLockedUp[i];
+        bool absWheel = absData.Use && g_vehData.mWheelsAbs[i];
 
-        if (g_vehData.mWheelsLockedUp[i]) {
-            brakeVals[i] = 0.0f;
-            g_vehData.mWheelsAbs[i] = true;
+        float brakeVal = 0.0f;
+        if (espData.Use) {
+            brakeVal = espBrake;
         }
-        else {
-            brakeVals[i] = inpBrakeForce * bbal;
-            g_vehData.mWheelsAbs[i] = false;
+        if (tcsBrakes) {
+            brakeVal = std::max(brakeVal, tcsBrake);
+        }
+        if (absWheel) {
+            brakeVal = std::min(brakeVal, 0.0f);
         }
-    }
-
-    return brakeVals;
-}
-
-std::vector<float> DrivingAssists::GetLSDBrakes(LSDData lsdData) {
-    std::vector<float> brakeVals(g_vehData.mWheelCount); // only works for 4 wheels but ok
-
-    if (g_vehData.mWheelCount != 4) {
-        const float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
-        const float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
-        const auto offsets = VExt::GetWheelOffsets(g_playerVehicle);
-        const float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-        float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
-        for (uint8_t i = 0; i < g_vehData.mWheelCount; i++) {
-            float bbal = offsets[i].y > 0.0f ? bbalF : bbalR;
 
-            brakeVals[i] = inpBrakeForce * bbal;
+        // Analog handbrake acts on the rear wheels only
+        float handbrakeVal = front ? 0.0f : handbrakeForce;
+        if (handbrakeVal > 0.0f) {
+            brakeVal = brakeVal + handbrakeVal;
+            output.Handbrake[i] = true;
+        }
+        // aka only use analog handbrake
+        if (!espData.Use && !tcsBrakes && !absWheel) {
+            brakeVal += inputBrake;
         }
 
-        return brakeVals;
+        output.Pressure[i] = brakeVal;
     }
 
-    float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-    float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
-    float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
-    brakeVals[0] = lsdData.BrakeLF + g_controls.BrakeVal * bbalF * handlingBrakeForce;
-    brakeVals[1] = lsdData.BrakeRF + g_controls.BrakeVal * bbalF * handlingBrakeForce;
-    brakeVals[2] = lsdData.BrakeLR + g_controls.BrakeVal * bbalR * handlingBrakeForce;
-    brakeVals[3] = lsdData.BrakeRR + g_controls.BrakeVal * bbalR * handlingBrakeForce;
-
-    return brakeVals;
+    return true;
 }
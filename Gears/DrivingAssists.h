@@ -1,7 +1,15 @@
 #pragma once
-#include <vector>
+#include <array>
+#include <cstdint>
 
 namespace DrivingAssists {
+    // Wheels and axles the assists handle. Covers everything up to 10-wheel trucks.
+    constexpr uint8_t MaxWheels = 10;
+    constexpr uint8_t MaxAxles = MaxWheels / 2;
+
+    using WheelFloats = std::array<float, MaxWheels>;
+    using WheelBools = std::array<bool, MaxWheels>;
+
     struct ABSData {
         bool Use;
     };
@@ -9,7 +17,7 @@ namespace DrivingAssists {
     struct TCSData {
         bool Use;
         // How much it spins faster/slower than the suspension component. Ratio.
-        std::vector<float> LinearSlipRatio;
+        WheelFloats LinearSlipRatio;
         float AverageSlipRatio;
 
         float MaxWheelSpeed;
@@ -29,26 +37,46 @@ namespace DrivingAssists {
         bool OppositeLock;
     };
 
+    struct LSDAxle {
+        float BrakeLeft;
+        float BrakeRight;
+        float SpeedDiff; // debug, (left - right) / (left + right)
+    };
+
     struct LSDData {
         bool Use;
-        float BrakeLF;
-        float BrakeRF;
-        float BrakeLR;
-        float BrakeRR;
-        float FDD; // debug, front diff speeddiff
-        float RDD; // debug, rear  diff speeddiff
+        // Negative brake per wheel, to simulate power transfer to the other side.
+        WheelFloats Brake;
+        // Front to rear
+        std::array<LSDAxle, MaxAxles> Axles;
+        uint8_t NumAxles;
     };
 
-    ABSData GetABS();
-    TCSData GetTCS();
-    ESPData GetESP();
+    struct BrakeOutput {
+        uint8_t NumWheels;
+        WheelFloats Pressure;
+        // Analog handbrake acts on this wheel, native ABS should be off.
+        WheelBools Handbrake;
+    };
+
+    // Steps the assists at their fixed rate. Call once per tick, after LazyGraph::NewTick().
+    void Update();
+    // Drops results held for another vehicle, they're computed again on next use.
+    void Reset();
+
+    // Computed on first use each assist step, later calls return the same data.
+    const ABSData& GetABS();
+    const TCSData& GetTCS();
+    const ESPData& GetESP();
 
     // Technically not an assist since the ESP-ish "braked wheel sends power to the other side"
     // doesn't apply, but putting it here anyway since we negative-brake to simulate power transfer.
-    LSDData GetLSD();
+    const LSDData& GetLSD();
 
-    std::vector<float> GetESPBrakes(ESPData espData);
-    std::vector<float> GetTCSBrakes(TCSData tcsData);
-    std::vector<float> GetABSBrakes(ABSData absData);
-    std::vector<float> GetLSDBrakes(LSDData lsdData);
+    // Brake pressure per wheel with the input brake, the analog handbrake and the assists
+    // combined in one pass. Wheels are grouped into axles by position, so ESP and LSD also
+    // work for 6-, 8- and 10-wheel vehicles.
+    // Returns false if nothing overrides the game's brakes. Updates the ABS and ESP wheel flags.
+    bool GetBrakes(const ABSData& absData, const TCSData& tcsData, const ESPData& espData,
+                   const LSDData& lsdData, BrakeOutput& output);
 }
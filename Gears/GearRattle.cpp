@@ -4,6 +4,7 @@
 
 #include "Input/CarControls.hpp"
 #include "Util/GameSound.h"
+#include "Util/NativeCache.h"
 
 #include <inc/natives.h>
 
@@ -53,7 +54,7 @@ void GearRattle::Update() {
             // Stop when engine is off
             // Stop when clutch is pressed
             if (g_controls.IsHShifterJustNeutral() ||
-                !VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle) ||
+                !NativeCache::GetIsVehicleEngineRunning(g_playerVehicle) ||
                 g_controls.IsClutchPressed()) {
                 GearRattle::Stop();
             }
@@ -0,0 +1,43 @@
+#include "GearboxDescriptor.h"
+
+#include <algorithm>
+
+namespace {
+    float calculatePowerIntersectionRpm(const std::vector<float>& ratios, uint8_t topGear, uint8_t gear) {
+        if (topGear == gear) return 1.0f;
+        float currRatio = ratios[gear];
+        float currRetardedRatio = currRatio * 0.6f;
+        float nextRatio = ratios[gear + 1];
+        if (currRetardedRatio > nextRatio) return 0.99f;
+        float currGap = currRatio - currRetardedRatio;
+        float nextOffset = nextRatio - currRetardedRatio;
+        float goldenRatio = nextOffset / currGap;
+        return 0.8f + (0.2f * (1.0f - goldenRatio));
+    }
+}
+
+bool GearboxDescriptor::Update(uint8_t topGear, float driveMaxFlatVel, const float* ratios) {
+    size_t numRatios = ratios == nullptr ? 0 : static_cast<size_t>(topGear) + 1;
+
+    if (Revision != 0 &&
+        topGear == TopGear &&
+        driveMaxFlatVel == DriveMaxFlatVel &&
+        numRatios == Ratios.size() &&
+        std::equal(Ratios.begin(), Ratios.end(), ratios)) {
+        return false;
+    }
+
+    TopGear = topGear;
+    DriveMaxFlatVel = driveMaxFlatVel;
+    Ratios.assign(ratios, ratios + numRatios);
+
+    TopSpeeds.resize(numRatios);
+    PowerIntersectionRpm.resize(numRatios);
+    for (uint8_t gear = 0; gear < numRatios; ++gear) {
+        TopSpeeds[gear] = DriveMaxFlatVel / Ratios[gear];
+        PowerIntersectionRpm[gear] = calculatePowerIntersectionRpm(Ratios, TopGear, gear);
+    }
+
+    ++Revision;
+    return true;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// Gearbox data derived from handling and the current gear setup.
+// Only rebuilt when the ratios, top gear or drive max flat vel change.
+struct GearboxDescriptor {
+    uint8_t TopGear = 0;
+    float DriveMaxFlatVel = 0.0f;
+
+    // Index is gear, 0 is reverse.
+    std::vector<float> Ratios;
+
+    // Speed at max RPM in each gear, m/s (DriveMaxFlatVel / ratio).
+    std::vector<float> TopSpeeds;
+
+    // Fraction of max RPM where the next gear makes more power (ATCU).
+    std::vector<float> PowerIntersectionRpm;
+
+    // Bumped on every rebuild.
+    uint32_t Revision = 0;
+
+    // ratios must hold topGear + 1 values, or be nullptr when unavailable.
+    // Returns true when the descriptor was rebuilt.
+    bool Update(uint8_t topGear, float driveMaxFlatVel, const float* ratios);
+};
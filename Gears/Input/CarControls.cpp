@@ -5,6 +5,7 @@
 #include "../Util/MathExt.h"
 #include "../Util/Strings.hpp"
 #include "../Util/GUID.h"
+#include "../Util/SysUtils.h"
 #include "keyboard.h"
 #include <Windows.h>
 
@@ -41,9 +42,16 @@ namespace {
     }
 }
 
+CarControls::SWheelToKey::SWheelToKey(const std::string& keyName, GUID guid, int button)
+    : SInput<int>(keyName, guid, button, "", "")
+    , KeyCode(static_cast<int>(GetKeyFromName(keyName))) {
+}
+
 CarControls::CarControls()
     : PrevInput(Keyboard)
-    , mXInputController(1) {
+    , mXInputController(1)
+    , mKeyboard([](int key) { return (GetAsyncKeyState(key) & 0x8000) != 0; },
+                SysUtil::IsWindowFocused) {
     std::fill(ControlXboxBlocks.begin(), ControlXboxBlocks.end(), -1);
 }
 
@@ -241,21 +249,25 @@ CarControls::InputDevices CarControls::GetLastInputDevice(InputDevices previousI
  * Keyboard section
  */
 
-bool CarControls::IsKeyPressed(int key) {
-    return IsKeyDown(key);
+void CarControls::UpdateKeyboardSnapshot() {
+    mKeyboard.Update();
 }
 
-bool CarControls::IsKeyJustPressed(int key, KeyboardControlType control) {
-    KBControlCurr[static_cast<int>(control)] = IsKeyPressed(key);
-
-    // raising edge
-    if (KBControlCurr[static_cast<int>(control)] && !KBControlPrev[static_cast<int>(control)]) {
-        KBControlPrev[static_cast<int>(control)] = KBControlCurr[static_cast<int>(control)];
-        return true;
+void CarControls::UpdateKeyboardBindings() {
+    KeyboardSnapshot::KeySet keys;
+    for (const auto& input : KBControl) {
+        if (KeyboardSnapshot::ValidKey(input.Control))
+            keys.set(input.Control);
     }
+    mKeyboard.SetKeys(keys);
+}
 
-    KBControlPrev[static_cast<int>(control)] = KBControlCurr[static_cast<int>(control)];
-    return false;
+bool CarControls::IsKeyPressed(int key) {
+    return mKeyboard.IsDown(key);
+}
+
+bool CarControls::IsKeyJustPressed(int key, KeyboardControlType control) {
+    return mKeyboard.JustPressed(static_cast<size_t>(control), key);
 }
 
 bool CarControls::ButtonJustPressed(KeyboardControlType control) {
@@ -389,7 +401,7 @@ void CarControls::CheckCustomButtons() {
     }
 
     for (const auto& input : WheelToKey) {
-        updateKeyInputEvents(input.Guid, input.Control, GetKeyFromName(input.ConfigTag));
+        updateKeyInputEvents(input.Guid, input.Control, input.KeyCode);
     }
 }
 
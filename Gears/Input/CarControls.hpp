@@ -5,6 +5,7 @@
 #include "XInputController.hpp"
 #include "WheelDirectInput.hpp"
 #include "NativeController.h"
+#include "KeyboardSnapshot.h"
 
 struct Device {
     Device(std::string name, GUID guid)
@@ -186,6 +187,14 @@ public:
     InputDevices GetLastInputDevice(InputDevices previousInput, bool enableWheel = true);
 
     // Keyboard controls	
+    // Reads the keyboard for this tick. Call once per tick, before any keyboard query.
+    void UpdateKeyboardSnapshot();
+    // Limits the snapshot to the keys in KBControl. Call after changing bindings.
+    void UpdateKeyboardBindings();
+    const KeyboardSnapshot& GetKeyboardSnapshot() const {
+        return mKeyboard;
+    }
+
     bool ButtonJustPressed(KeyboardControlType control);
     bool IsKeyPressed(int key);
     bool IsKeyJustPressed(int key, KeyboardControlType control);
@@ -249,8 +258,12 @@ public:
 
     std::array<SInput<int>, static_cast<int>(WheelControlType::SIZEOF_WheelControlType)> WheelButton = {};
 
-    // ConfTag = Keyboard str
-    std::vector<SInput<int>> WheelToKey = {};
+    // ConfTag = Keyboard str, resolved to KeyCode on load
+    struct SWheelToKey : SInput<int> {
+        SWheelToKey(const std::string& keyName, GUID guid, int button);
+        int KeyCode;
+    };
+    std::vector<SWheelToKey> WheelToKey = {};
 
     std::vector<Device> FreeDevices{};
 
@@ -262,9 +275,7 @@ private:
     WheelDirectInput mWheelInput;
     NativeController mNativeController;
     XInputController mXInputController;
-
-    bool KBControlCurr[static_cast<int>(KeyboardControlType::SIZEOF_KeyboardControlType)] = {};
-    bool KBControlPrev[static_cast<int>(KeyboardControlType::SIZEOF_KeyboardControlType)] = {};
+    KeyboardSnapshot mKeyboard;
 
     void updateKeyInputEvents(GUID guid, int button, int keyCode);
 };
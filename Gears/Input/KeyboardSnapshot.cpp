@@ -0,0 +1,40 @@
+#include "KeyboardSnapshot.h"
+
+#include <utility>
+
+KeyboardSnapshot::KeyboardSnapshot(std::function<bool(int key)> isKeyDown, std::function<bool()> isFocused)
+    : mIsKeyDown(std::move(isKeyDown))
+    , mIsFocused(std::move(isFocused)) {
+}
+
+void KeyboardSnapshot::SetKeys(const KeySet& keys) {
+    mKeys = keys;
+    // Unbound keys shouldn't linger as held.
+    mCurr &= mKeys;
+}
+
+void KeyboardSnapshot::Update() {
+    mCurr.reset();
+    mFocused = mIsFocused();
+    if (!mFocused)
+        return;
+
+    for (size_t key = 0; key < NumKeys; ++key) {
+        if (mKeys[key] && mIsKeyDown(static_cast<int>(key)))
+            mCurr.set(key);
+    }
+}
+
+bool KeyboardSnapshot::IsDown(int key) const {
+    return ValidKey(key) && mCurr[key];
+}
+
+bool KeyboardSnapshot::JustPressed(size_t slot, int key) {
+    if (slot >= mSlotPrev.size())
+        mSlotPrev.resize(slot + 1, false);
+
+    bool down = IsDown(key);
+    bool wasDown = mSlotPrev[slot];
+    mSlotPrev[slot] = down;
+    return down && !wasDown;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <bitset>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// Keyboard state read once per tick.
+// Update() checks focus once and reads only the keys in the key set, so
+// queries during the tick are bitset lookups. Without focus every key reads
+// as released.
+// Key codes are Windows virtual-key codes, anything outside 0-255 is never down.
+class KeyboardSnapshot {
+public:
+    static constexpr size_t NumKeys = 256;
+    using KeySet = std::bitset<NumKeys>;
+
+    KeyboardSnapshot(std::function<bool(int key)> isKeyDown, std::function<bool()> isFocused);
+
+    // Keys read by Update(), e.g. all keys bound in the settings.
+    void SetKeys(const KeySet& keys);
+    static bool ValidKey(int key) { return key >= 0 && key < static_cast<int>(NumKeys); }
+
+    void Update();
+
+    bool Focused() const { return mFocused; }
+    bool IsDown(int key) const;
+
+    // Rising edge since the previous call for the same slot (e.g. a control).
+    // Consumed on read: a second call in the same tick returns false.
+    bool JustPressed(size_t slot, int key);
+
+private:
+    std::function<bool(int)> mIsKeyDown;
+    std::function<bool()> mIsFocused;
+
+    KeySet mKeys;
+    KeySet mCurr;
+    std::vector<bool> mSlotPrev;
+    bool mFocused = false;
+};
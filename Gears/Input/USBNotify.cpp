@@ -7,7 +7,7 @@
 #include "../Util/Strings.hpp"
 #include "../Util/Logger.hpp"
 
-#include <windows.h>
+#include <Windows.h>
 #include <winuser.h>
 #include <Dbt.h>
 
@@ -5,6 +5,7 @@
 #include "Input/CarControls.hpp"
 #include "Util/MathExt.h"
 #include "Util/UIUtils.h"
+#include "Util/NativeCache.h"
 
 #include <inc/enums.h>
 #include <inc/natives.h>
@@ -21,7 +22,7 @@ namespace {
 void LaunchControl::Update(float& clutchVal) {
     if (g_settings().DriveAssists.LaunchControl.Enable &&
         g_vehData.mGearCurr == 1 &&
-        VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+        NativeCache::GetIsVehicleEngineRunning(g_playerVehicle)) {
         switch (launchState) {
             case ELCState::Inactive: {
                 //(g_gearStates.FakeNeutral || clutch >= 1.0f || VExt::GetHandbrake(g_playerVehicle)) && )
@@ -0,0 +1,105 @@
+#include "MatrixKernels.h"
+#include <cmath>
+
+#if NATIVE_MATRIX_SIMD
+#include <xmmintrin.h>
+#endif
+
+using namespace MatrixKernels;
+
+Rotation3x3 MatrixKernels::Rotation(float x, float y, float z, float angle) {
+    float cos_ = cos(angle);
+    float sin_ = sin(angle);
+    float xx = x * x;
+    float yy = y * y;
+    float zz = z * z;
+    float xy = x * y;
+    float xz = x * z;
+    float yz = y * z;
+
+    Rotation3x3 r;
+    r.M[0][0] = xx + (cos_ * (1.0f - xx));
+    r.M[0][1] = (xy - (cos_ * xy)) + (sin_ * z);
+    r.M[0][2] = (xz - (cos_ * xz)) - (sin_ * y);
+    r.M[1][0] = (xy - (cos_ * xy)) - (sin_ * z);
+    r.M[1][1] = yy + (cos_ * (1.0f - yy));
+    r.M[1][2] = (yz - (cos_ * yz)) + (sin_ * x);
+    r.M[2][0] = (xz - (cos_ * xz)) + (sin_ * y);
+    r.M[2][1] = (yz - (cos_ * yz)) - (sin_ * x);
+    r.M[2][2] = zz + (cos_ * (1.0f - zz));
+    return r;
+}
+
+void Scalar::Multiply(const float* l, const float* r, float* out) {
+    float temp[16];
+    for (int i = 0; i < 16; i += 4) {
+        for (int j = 0; j < 4; ++j) {
+            temp[i + j] = (l[i] * r[j]) + (l[i + 1] * r[4 + j]) + (l[i + 2] * r[8 + j]) + (l[i + 3] * r[12 + j]);
+        }
+    }
+    for (int i = 0; i < 16; ++i) {
+        out[i] = temp[i];
+    }
+}
+
+void Scalar::RotateApply(const Rotation3x3& rot, const float* o, float* out) {
+    float row[12];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            row[4 * i + j] = (rot.M[i][0] * o[j]) + (rot.M[i][1] * o[4 + j]) + (rot.M[i][2] * o[8 + j]);
+        }
+    }
+    for (int j = 0; j < 4; ++j) {
+        out[12 + j] = o[12 + j];
+    }
+    for (int j = 0; j < 12; ++j) {
+        out[j] = row[j];
+    }
+}
+
+void Scalar::ScaleApply(float x, float y, float z, const float* m, float* out) {
+    const float s[4] = { x, y, z, 1.0f };
+    for (int i = 0; i < 16; ++i) {
+        out[i] = s[i / 4] * m[i];
+    }
+}
+
+#if NATIVE_MATRIX_SIMD
+// Each output row is a linear combination of the rows of r, so every row of l
+// only needs four broadcasts. Row i of l is read before row i of out is stored,
+// so out may alias l.
+void Sse::Multiply(const float* l, const float* r, float* out) {
+    __m128 r0 = _mm_loadu_ps(r + 0);
+    __m128 r1 = _mm_loadu_ps(r + 4);
+    __m128 r2 = _mm_loadu_ps(r + 8);
+    __m128 r3 = _mm_loadu_ps(r + 12);
+
+    for (int i = 0; i < 16; i += 4) {
+        __m128 a = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(l[i + 0]), r0), _mm_mul_ps(_mm_set1_ps(l[i + 1]), r1));
+        __m128 b = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(l[i + 2]), r2), _mm_mul_ps(_mm_set1_ps(l[i + 3]), r3));
+        _mm_storeu_ps(out + i, _mm_add_ps(a, b));
+    }
+}
+
+void Sse::RotateApply(const Rotation3x3& rot, const float* o, float* out) {
+    __m128 o0 = _mm_loadu_ps(o + 0);
+    __m128 o1 = _mm_loadu_ps(o + 4);
+    __m128 o2 = _mm_loadu_ps(o + 8);
+    __m128 o3 = _mm_loadu_ps(o + 12);
+
+    for (int i = 0; i < 3; ++i) {
+        __m128 row = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_set1_ps(rot.M[i][0]), o0), _mm_mul_ps(_mm_set1_ps(rot.M[i][1]), o1)),
+            _mm_mul_ps(_mm_set1_ps(rot.M[i][2]), o2));
+        _mm_storeu_ps(out + 4 * i, row);
+    }
+    _mm_storeu_ps(out + 12, o3);
+}
+
+void Sse::ScaleApply(float x, float y, float z, const float* m, float* out) {
+    _mm_storeu_ps(out + 0, _mm_mul_ps(_mm_set1_ps(x), _mm_loadu_ps(m + 0)));
+    _mm_storeu_ps(out + 4, _mm_mul_ps(_mm_set1_ps(y), _mm_loadu_ps(m + 4)));
+    _mm_storeu_ps(out + 8, _mm_mul_ps(_mm_set1_ps(z), _mm_loadu_ps(m + 8)));
+    _mm_storeu_ps(out + 12, _mm_loadu_ps(m + 12));
+}
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+/*
+ * The 4x4 kernels behind NativeMatrix, on 16 floats stored row by row
+ * (M11, M12, ... M44). No game or Windows types, so they build anywhere.
+ * MatrixKernels::Multiply etc. are the SSE versions on x86/x64 and the scalar
+ * versions otherwise. Define MT_NO_SIMD to use the scalar versions on x86/x64 too.
+ */
+#if !defined(MT_NO_SIMD) && (defined(_M_X64) || defined(__SSE2__))
+#define NATIVE_MATRIX_SIMD 1
+#else
+#define NATIVE_MATRIX_SIMD 0
+#endif
+
+namespace MatrixKernels {
+    // Upper 3x3 of RotationAxis. The rest of that matrix is identity.
+    struct Rotation3x3 {
+        float M[3][3];
+    };
+
+    Rotation3x3 Rotation(float x, float y, float z, float angle);
+
+    // Scalar versions are always built, to check the SSE ones against.
+    namespace Scalar {
+        // out = l * r. out may alias l.
+        void Multiply(const float* l, const float* r, float* out);
+        // out = rotation * o, rotation as a full 4x4. out may alias o.
+        void RotateApply(const Rotation3x3& rot, const float* o, float* out);
+        // out = Scaling(x, y, z) * m
+        void ScaleApply(float x, float y, float z, const float* m, float* out);
+    }
+
+#if NATIVE_MATRIX_SIMD
+    namespace Sse {
+        void Multiply(const float* l, const float* r, float* out);
+        void RotateApply(const Rotation3x3& rot, const float* o, float* out);
+        void ScaleApply(float x, float y, float z, const float* m, float* out);
+    }
+
+    using Sse::Multiply;
+    using Sse::RotateApply;
+    using Sse::ScaleApply;
+#else
+    using Scalar::Multiply;
+    using Scalar::RotateApply;
+    using Scalar::ScaleApply;
+#endif
+}
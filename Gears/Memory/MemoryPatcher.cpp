@@ -2,10 +2,14 @@
 
 #include "Versions.h"
 #include "../Util/Logger.hpp"
+#include "../Util/TaskPool.h"
 
 #include "PatternInfo.h"
 #include "Patcher.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace MemoryPatcher {
 const int NumGearboxPatches = 5;
 int NumGearboxPatched = 0;
@@ -64,6 +68,42 @@ Patcher SteeringControlPatcher("Steer: Steering input", steeringControl, true);
 PatternInfo throttleControl;
 Patcher ThrottleControlPatcher("Throttle: Throttle control", throttleControl);
 
+// Clutch, shift and throttle lift patches are only useful together.
+const std::vector<Patcher*> gearboxPatchers {
+    &ClutchLowRPMPatcher,
+    &ClutchRevLimPatcher,
+    &ShiftDownPatcher,
+    &ShiftUpPatcher,
+    &ThrottleLiftPatcher,
+};
+
+BatchStats lastBatchStats;
+
+namespace {
+float usSince(std::chrono::steady_clock::time_point start) {
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<float>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / 1000.0f;
+}
+
+int countPatched(const std::vector<Patcher*>& patchers) {
+    return static_cast<int>(std::count_if(patchers.begin(), patchers.end(),
+        [](const Patcher* patcher) { return patcher->Patched(); }));
+}
+
+void markFailed(const std::vector<Patcher*>& patchers) {
+    for (Patcher* patcher : patchers)
+        patcher->MarkFailed();
+}
+
+void logBatch(const char* action, bool success) {
+    const auto& tx = lastBatchStats.Transaction;
+    logger.Write(success ? DEBUG : ERROR,
+        "[Patch] Batch %s %s: %u patches, %u pages, %u protection changes, resolve %.1f us, commit %.1f us%s",
+        action, success ? "success" : "failed", lastBatchStats.Patchers, tx.Pages, tx.ProtectCalls,
+        lastBatchStats.ResolveUs, tx.CommitUs, tx.RolledBack ? " (rolled back)" : "");
+}
+}
+
 void SetPatterns(int version) {
     // Valid for 877 to 1290
     shiftUp = PatternInfo("\x66\x89\x13\xB8\x05\x00\x00\x00", "xxxxxxxx", 
@@ -158,54 +198,133 @@ void SetPatterns(int version) {
 }
 
 bool Test() {
+    const Patcher* patchers[] = {
+        &ShiftUpPatcher,
+        &ShiftDownPatcher,
+        &ClutchLowRPMPatcher,
+        &ClutchRevLimPatcher,
+        &ThrottleLiftPatcher,
+        &ThrottlePatcher,
+        &BrakePatcher,
+        &SteeringAssistPatcher,
+        &SteeringControlPatcher,
+        &ThrottleControlPatcher,
+        &AbsPatcher,
+    };
+
+    // Each test scans the whole module on its own, so they run side by side.
+    std::vector<TaskPool::Handle<uintptr_t>> scans;
+    for (const Patcher* patcher : patchers) {
+        scans.push_back(TaskPool::Submit(TaskPool::Priority::High, [patcher] { return patcher->Test(); }));
+    }
+
     bool success = true;
-    success &= 0 != ShiftUpPatcher.Test();
-    success &= 0 != ShiftDownPatcher.Test();
-    success &= 0 != ClutchLowRPMPatcher.Test();
-    success &= 0 != ClutchRevLimPatcher.Test();
-    success &= 0 != ThrottleLiftPatcher.Test();
-    success &= 0 != ThrottlePatcher.Test();
-    success &= 0 != BrakePatcher.Test();
-    success &= 0 != SteeringAssistPatcher.Test();
-    success &= 0 != SteeringControlPatcher.Test();
-    success &= 0 != ThrottleControlPatcher.Test();
-    success &= 0 != AbsPatcher.Test();
+    for (auto& scan : scans) {
+        try {
+            success &= 0 != scan.Get();
+        }
+        catch (const TaskPool::Cancelled&) {
+            success = false;
+        }
+    }
     return success;
 }
 
-bool ApplyGearboxPatches() {
-    if (gearboxAttempts > maxAttempts) {
-        return false;
+bool PatchAll(const std::vector<Patcher*>& patchers, MemoryAccess& memory) {
+    auto start = std::chrono::steady_clock::now();
+    lastBatchStats = {};
+
+    std::vector<Patcher*> pending;
+    for (Patcher* patcher : patchers) {
+        if (patcher->Patched())
+            continue;
+        // Like Patch(), stop trying once a patcher has failed too often.
+        if (patcher->AttemptsExceeded())
+            return false;
+        pending.push_back(patcher);
     }
+    lastBatchStats.Patchers = static_cast<uint32_t>(pending.size());
 
-    logger.Write(DEBUG, "[Patch] [Gears] Patching");
-
-    if (NumGearboxPatches == NumGearboxPatched) {
-        logger.Write(DEBUG, "[Patch] [Gears] Already patched");
+    if (pending.empty())
         return true;
+
+    std::vector<uintptr_t> addresses;
+    PatchTransaction transaction(memory);
+    for (Patcher* patcher : pending) {
+        uintptr_t address = patcher->Resolve();
+        if (!address) {
+            lastBatchStats.ResolveUs = usSince(start);
+            logger.Write(ERROR, "[Patch] Batch: [%s] unresolved, nothing patched", patcher->Name().c_str());
+            markFailed(pending);
+            return false;
+        }
+
+        std::vector<uint8_t> original(patcher->Size());
+        memory.Read(address, original.data(), original.size());
+        transaction.Add(address, patcher->PatchedBytes(original));
+        addresses.push_back(address);
     }
+    lastBatchStats.ResolveUs = usSince(start);
 
-    if (ClutchLowRPMPatcher.Patch()) {
-        NumGearboxPatched++;
+    bool success = transaction.Commit();
+    lastBatchStats.Transaction = transaction.Stats();
+    if (success) {
+        for (size_t i = 0; i < pending.size(); ++i)
+            pending[i]->MarkPatched(addresses[i], transaction.Original(i));
+    }
+    else {
+        markFailed(pending);
     }
+    logBatch("patch", success);
+    return success;
+}
+
+bool RestoreAll(const std::vector<Patcher*>& patchers, MemoryAccess& memory) {
+    lastBatchStats = {};
 
-    if (ClutchRevLimPatcher.Patch()) {
-        NumGearboxPatched++;
+    std::vector<Patcher*> pending;
+    PatchTransaction transaction(memory);
+    for (Patcher* patcher : patchers) {
+        if (!patcher->Patched())
+            continue;
+        transaction.Add(patcher->Address(), patcher->OriginalBytes());
+        pending.push_back(patcher);
     }
+    lastBatchStats.Patchers = static_cast<uint32_t>(pending.size());
 
-    if (ShiftDownPatcher.Patch()) {
-        NumGearboxPatched++;
+    if (pending.empty())
+        return true;
+
+    bool success = transaction.Commit();
+    lastBatchStats.Transaction = transaction.Stats();
+    if (success) {
+        for (Patcher* patcher : pending)
+            patcher->MarkRestored();
     }
+    logBatch("restore", success);
+    return success;
+}
 
-    if (ShiftUpPatcher.Patch()) {
-        NumGearboxPatched++;
+const BatchStats& GetLastBatchStats() {
+    return lastBatchStats;
+}
+
+bool ApplyGearboxPatches() {
+    if (gearboxAttempts > maxAttempts) {
+        return false;
     }
 
-    if (ThrottleLiftPatcher.Patch()) {
-        NumGearboxPatched++;
+    logger.Write(DEBUG, "[Patch] [Gears] Patching");
+
+    if (NumGearboxPatches == NumGearboxPatched) {
+        logger.Write(DEBUG, "[Patch] [Gears] Already patched");
+        return true;
     }
 
-    if (NumGearboxPatched == NumGearboxPatches) {
+    bool success = PatchAll(gearboxPatchers);
+    NumGearboxPatched = countPatched(gearboxPatchers);
+
+    if (success) {
         logger.Write(DEBUG, "[Patch] [Gears] Patch success");
         gearboxAttempts = 0;
         return true;
@@ -228,27 +347,10 @@ bool RevertGearboxPatches() {
         return true;
     }
 
-    if (ClutchLowRPMPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
-
-    if (ClutchRevLimPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
-
-    if (ShiftDownPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
-
-    if (ShiftUpPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
+    bool success = RestoreAll(gearboxPatchers);
+    NumGearboxPatched = countPatched(gearboxPatchers);
 
-    if (ThrottleLiftPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
-
-    if (NumGearboxPatched == 0) {
+    if (success) {
         logger.Write(DEBUG, "[Patch] [Gears] Restore success");
         gearboxAttempts = 0;
         return true;
@@ -1,10 +1,28 @@
 #pragma once
 #include "Patcher.h"
+#include "PatchTransaction.h"
+#include <vector>
 
 namespace MemoryPatcher {
 void SetPatterns(int version);
 bool Test();
 
+struct BatchStats {
+    uint32_t Patchers = 0;
+    float ResolveUs = 0.0f;
+    TransactionStats Transaction;
+};
+
+/*
+ * Patch or restore several patchers at once. All patterns are resolved first,
+ * then every write goes through one PatchTransaction: either all patchers
+ * change state or none do. A failed batch counts toward the attempt limit of
+ * each patcher in it.
+ */
+bool PatchAll(const std::vector<Patcher*>& patchers, MemoryAccess& memory = ProcessMemory());
+bool RestoreAll(const std::vector<Patcher*>& patchers, MemoryAccess& memory = ProcessMemory());
+const BatchStats& GetLastBatchStats();
+
 /*
  * Patch clutch and gearbox behavior so they can be script-controlled
  * Changes multiple things.
@@ -4,7 +4,18 @@
  */
 
 #include "NativeMatrix.h"
-#include <cmath>
+#include "MatrixKernels.h"
+#include <cstddef>
+
+namespace {
+    const float* data(const NativeMatrix4x4& matrix) {
+        return &matrix.M11;
+    }
+
+    float* data(NativeMatrix4x4& matrix) {
+        return &matrix.M11;
+    }
+}
 
 NativeMatrix4x4 Scaling(Vector3 scale) {
     // identity
@@ -29,52 +40,107 @@ NativeMatrix4x4 RotationAxis(Vector3 axis, float angle) {
         0, 0, 1, 0,
         0, 0, 0, 1
     };
-    float x = axis.x;
-    float y = axis.y;
-    float z = axis.z;
-
-    float cos_ = cos(angle);
-    float sin_ = sin(angle);
-    float xx = x * x;
-    float yy = y * y;
-    float zz = z * z;
-    float xy = x * y;
-    float xz = x * z;
-    float yz = y * z;
-
-    result.M11 = xx + (cos_ * (1.0f - xx));
-    result.M12 = (xy - (cos_ * xy)) + (sin_ * z);
-    result.M13 = (xz - (cos_ * xz)) - (sin_ * y);
-    result.M21 = (xy - (cos_ * xy)) - (sin_ * z);
-    result.M22 = yy + (cos_ * (1.0f - yy));
-    result.M23 = (yz - (cos_ * yz)) + (sin_ * x);
-    result.M31 = (xz - (cos_ * xz)) + (sin_ * y);
-    result.M32 = (yz - (cos_ * yz)) - (sin_ * x);
-    result.M33 = zz + (cos_ * (1.0f - zz));
+    MatrixKernels::Rotation3x3 r = MatrixKernels::Rotation(axis.x, axis.y, axis.z, angle);
+    result.M11 = r.M[0][0];
+    result.M12 = r.M[0][1];
+    result.M13 = r.M[0][2];
+    result.M21 = r.M[1][0];
+    result.M22 = r.M[1][1];
+    result.M23 = r.M[1][2];
+    result.M31 = r.M[2][0];
+    result.M32 = r.M[2][1];
+    result.M33 = r.M[2][2];
     return result;
 }
 
 NativeMatrix4x4 Multiply(const NativeMatrix4x4& left, const NativeMatrix4x4& right) {
     NativeMatrix4x4 temp;
-    temp.M11 = (left.M11 * right.M11) + (left.M12 * right.M21) + (left.M13 * right.M31) + (left.M14 * right.M41);
-    temp.M12 = (left.M11 * right.M12) + (left.M12 * right.M22) + (left.M13 * right.M32) + (left.M14 * right.M42);
-    temp.M13 = (left.M11 * right.M13) + (left.M12 * right.M23) + (left.M13 * right.M33) + (left.M14 * right.M43);
-    temp.M14 = (left.M11 * right.M14) + (left.M12 * right.M24) + (left.M13 * right.M34) + (left.M14 * right.M44);
-    temp.M21 = (left.M21 * right.M11) + (left.M22 * right.M21) + (left.M23 * right.M31) + (left.M24 * right.M41);
-    temp.M22 = (left.M21 * right.M12) + (left.M22 * right.M22) + (left.M23 * right.M32) + (left.M24 * right.M42);
-    temp.M23 = (left.M21 * right.M13) + (left.M22 * right.M23) + (left.M23 * right.M33) + (left.M24 * right.M43);
-    temp.M24 = (left.M21 * right.M14) + (left.M22 * right.M24) + (left.M23 * right.M34) + (left.M24 * right.M44);
-    temp.M31 = (left.M31 * right.M11) + (left.M32 * right.M21) + (left.M33 * right.M31) + (left.M34 * right.M41);
-    temp.M32 = (left.M31 * right.M12) + (left.M32 * right.M22) + (left.M33 * right.M32) + (left.M34 * right.M42);
-    temp.M33 = (left.M31 * right.M13) + (left.M32 * right.M23) + (left.M33 * right.M33) + (left.M34 * right.M43);
-    temp.M34 = (left.M31 * right.M14) + (left.M32 * right.M24) + (left.M33 * right.M34) + (left.M34 * right.M44);
-    temp.M41 = (left.M41 * right.M11) + (left.M42 * right.M21) + (left.M43 * right.M31) + (left.M44 * right.M41);
-    temp.M42 = (left.M41 * right.M12) + (left.M42 * right.M22) + (left.M43 * right.M32) + (left.M44 * right.M42);
-    temp.M43 = (left.M41 * right.M13) + (left.M42 * right.M23) + (left.M43 * right.M33) + (left.M44 * right.M43);
-    temp.M44 = (left.M41 * right.M14) + (left.M42 * right.M24) + (left.M43 * right.M34) + (left.M44 * right.M44);
+    MatrixKernels::Multiply(data(left), data(right), data(temp));
     return temp;
 }
 
+NativeMatrix4x4 RotateAxisApply(Vector3 axis, float angle, const NativeMatrix4x4& original) {
+    NativeMatrix4x4 result;
+    MatrixKernels::RotateApply(MatrixKernels::Rotation(axis.x, axis.y, axis.z, angle), data(original), data(result));
+    return result;
+}
+
+NativeMatrix4x4 ScaleApply(Vector3 scale, const NativeMatrix4x4& matrix) {
+    NativeMatrix4x4 result;
+    MatrixKernels::ScaleApply(scale.x, scale.y, scale.z, data(matrix), data(result));
+    return result;
+}
+
 NativeMatrix4x4 operator*(const NativeMatrix4x4& left, const NativeMatrix4x4& right) {
     return Multiply(left, right);
 }
+
+NativeMatrix4x4 EntityMatrix(Vector3 right, Vector3 forward, Vector3 up, Vector3 position) {
+    return {
+        right.x,    right.y,    right.z,    0,
+        forward.x,  forward.y,  forward.z,  0,
+        up.x,       up.y,       up.z,       0,
+        position.x, position.y, position.z, 1
+    };
+}
+
+NativeMatrix4x4 InvertAffine(const NativeMatrix4x4& m) {
+    // Cofactors of the upper 3x3
+    float c11 = m.M22 * m.M33 - m.M23 * m.M32;
+    float c12 = m.M23 * m.M31 - m.M21 * m.M33;
+    float c13 = m.M21 * m.M32 - m.M22 * m.M31;
+    float det = m.M11 * c11 + m.M12 * c12 + m.M13 * c13;
+    if (det == 0.0f) {
+        return Scaling({ 1.0f, 1.0f, 1.0f });
+    }
+    float invDet = 1.0f / det;
+
+    NativeMatrix4x4 result{};
+    result.M11 = c11 * invDet;
+    result.M12 = (m.M13 * m.M32 - m.M12 * m.M33) * invDet;
+    result.M13 = (m.M12 * m.M23 - m.M13 * m.M22) * invDet;
+    result.M21 = c12 * invDet;
+    result.M22 = (m.M11 * m.M33 - m.M13 * m.M31) * invDet;
+    result.M23 = (m.M13 * m.M21 - m.M11 * m.M23) * invDet;
+    result.M31 = c13 * invDet;
+    result.M32 = (m.M12 * m.M31 - m.M11 * m.M32) * invDet;
+    result.M33 = (m.M11 * m.M22 - m.M12 * m.M21) * invDet;
+
+    result.M41 = -(m.M41 * result.M11 + m.M42 * result.M21 + m.M43 * result.M31);
+    result.M42 = -(m.M41 * result.M12 + m.M42 * result.M22 + m.M43 * result.M32);
+    result.M43 = -(m.M41 * result.M13 + m.M42 * result.M23 + m.M43 * result.M33);
+    result.M44 = 1.0f;
+    return result;
+}
+
+Vector3 TransformPoint(const NativeMatrix4x4& m, Vector3 p) {
+    Vector3 result{};
+    result.x = p.x * m.M11 + p.y * m.M21 + p.z * m.M31 + m.M41;
+    result.y = p.x * m.M12 + p.y * m.M22 + p.z * m.M32 + m.M42;
+    result.z = p.x * m.M13 + p.y * m.M23 + p.z * m.M33 + m.M43;
+    return result;
+}
+
+Vector3 TransformDirection(const NativeMatrix4x4& m, Vector3 d) {
+    Vector3 result{};
+    result.x = d.x * m.M11 + d.y * m.M21 + d.z * m.M31;
+    result.y = d.x * m.M12 + d.y * m.M22 + d.z * m.M32;
+    result.z = d.x * m.M13 + d.y * m.M23 + d.z * m.M33;
+    return result;
+}
+
+std::vector<Vector3> TransformPoints(const NativeMatrix4x4& matrix, const std::vector<Vector3>& points) {
+    std::vector<Vector3> result(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        result[i] = TransformPoint(matrix, points[i]);
+    }
+    return result;
+}
+
+std::vector<Vector3> TransformDirections(const NativeMatrix4x4& matrix, const std::vector<Vector3>& directions) {
+    std::vector<Vector3> result(directions.size());
+    for (size_t i = 0; i < directions.size(); ++i) {
+        result[i] = TransformDirection(matrix, directions[i]);
+    }
+    return result;
+}
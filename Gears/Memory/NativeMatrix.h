@@ -5,6 +5,7 @@
 
 #pragma once
 #include "NativeVectors.h"
+#include <vector>
 
 #pragma pack(push, 1)
 struct NativeMatrix4x4
@@ -36,7 +37,32 @@ struct NativeMatrix4x4
 };
 #pragma pack(pop)
 
+static_assert(sizeof(NativeMatrix4x4) == 16 * sizeof(float), "NativeMatrix4x4 must be 16 packed floats");
+
+// Multiply, RotateAxisApply and ScaleApply run on the kernels in MatrixKernels.h.
 NativeMatrix4x4 Scaling(Vector3 scale);
 NativeMatrix4x4 RotationAxis(Vector3 axis, float angle);
 NativeMatrix4x4 Multiply(const NativeMatrix4x4& left, const NativeMatrix4x4& right);
 NativeMatrix4x4 operator *(const NativeMatrix4x4& left, const NativeMatrix4x4& right);
+
+// RotationAxis(axis, angle) * original, without building the rotation matrix.
+NativeMatrix4x4 RotateAxisApply(Vector3 axis, float angle, const NativeMatrix4x4& original);
+
+// Scaling(scale) * matrix
+NativeMatrix4x4 ScaleApply(Vector3 scale, const NativeMatrix4x4& matrix);
+
+// Row-vector convention like the rest of this file: p' = p * M, translation in M41-M43.
+
+// Entity matrix as returned by GET_ENTITY_MATRIX. Rows: right, forward, up, position.
+NativeMatrix4x4 EntityMatrix(Vector3 right, Vector3 forward, Vector3 up, Vector3 position);
+
+// Inverse of a matrix without projection (4th column 0, 0, 0, 1), e.g. entity matrices.
+NativeMatrix4x4 InvertAffine(const NativeMatrix4x4& matrix);
+
+// Position: rotated, scaled and translated.
+Vector3 TransformPoint(const NativeMatrix4x4& matrix, Vector3 point);
+// Direction (velocities, axes): rotated and scaled, not translated.
+Vector3 TransformDirection(const NativeMatrix4x4& matrix, Vector3 direction);
+
+std::vector<Vector3> TransformPoints(const NativeMatrix4x4& matrix, const std::vector<Vector3>& points);
+std::vector<Vector3> TransformDirections(const NativeMatrix4x4& matrix, const std::vector<Vector3>& directions);
@@ -1,6 +1,6 @@
 #pragma once
 #include <cstdint>
-#include <windows.h>
+#include <Windows.h>
 
 struct vec3Offset {
     int X;
@@ -0,0 +1,269 @@
+#include "PatchTransaction.h"
+
+#include "../Util/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <numeric>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cstdio>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace MemoryPatcher {
+namespace {
+#ifdef _WIN32
+    class WindowsMemory : public MemoryAccess {
+    public:
+        size_t PageSize() const override {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return info.dwPageSize;
+        }
+
+        bool Query(uintptr_t address, uint32_t& protection, size_t& size) const override {
+            MEMORY_BASIC_INFORMATION info;
+            if (VirtualQuery(reinterpret_cast<void*>(address), &info, sizeof(info)) == 0)
+                return false;
+            protection = info.Protect;
+            size = reinterpret_cast<uintptr_t>(info.BaseAddress) + info.RegionSize - address;
+            return true;
+        }
+
+        bool Unprotect(uintptr_t address, size_t size, uint32_t& oldProtection) override {
+            DWORD old = 0;
+            if (!VirtualProtect(reinterpret_cast<void*>(address), size, PAGE_EXECUTE_READWRITE, &old))
+                return false;
+            oldProtection = old;
+            return true;
+        }
+
+        bool Protect(uintptr_t address, size_t size, uint32_t protection) override {
+            DWORD old = 0;
+            return VirtualProtect(reinterpret_cast<void*>(address), size, protection, &old) != FALSE;
+        }
+
+        bool Write(uintptr_t address, const uint8_t* data, size_t size) override {
+            memcpy(reinterpret_cast<void*>(address), data, size);
+            return true;
+        }
+
+        void Read(uintptr_t address, uint8_t* data, size_t size) const override {
+            memcpy(data, reinterpret_cast<const void*>(address), size);
+        }
+
+        void FlushInstructions(uintptr_t address, size_t size) override {
+            FlushInstructionCache(GetCurrentProcess(), reinterpret_cast<void*>(address), size);
+        }
+    };
+#else
+    class PosixMemory : public MemoryAccess {
+    public:
+        size_t PageSize() const override {
+            return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+
+        bool Query(uintptr_t address, uint32_t& protection, size_t& size) const override {
+            int current = 0;
+            uintptr_t end = 0;
+            if (!queryMapping(address, current, end))
+                return false;
+            protection = static_cast<uint32_t>(current);
+            size = end - address;
+            return true;
+        }
+
+        // mprotect doesn't report the previous protection, so look it up in /proc/self/maps.
+        // Like VirtualProtect, this reports the protection of the first page.
+        bool Unprotect(uintptr_t address, size_t size, uint32_t& oldProtection) override {
+            uint32_t current = 0;
+            size_t mapped = 0;
+            if (!Query(address, current, mapped))
+                return false;
+            if (mprotect(reinterpret_cast<void*>(address), size, static_cast<int>(current) | PROT_READ | PROT_WRITE) != 0)
+                return false;
+            oldProtection = current;
+            return true;
+        }
+
+        bool Protect(uintptr_t address, size_t size, uint32_t protection) override {
+            return mprotect(reinterpret_cast<void*>(address), size, static_cast<int>(protection)) == 0;
+        }
+
+        bool Write(uintptr_t address, const uint8_t* data, size_t size) override {
+            memcpy(reinterpret_cast<void*>(address), data, size);
+            return true;
+        }
+
+        void Read(uintptr_t address, uint8_t* data, size_t size) const override {
+            memcpy(data, reinterpret_cast<const void*>(address), size);
+        }
+
+        void FlushInstructions(uintptr_t address, size_t size) override {
+            char* begin = reinterpret_cast<char*>(address);
+            __builtin___clear_cache(begin, begin + size);
+        }
+
+    private:
+        // Protection and end of the mapping that holds address.
+        static bool queryMapping(uintptr_t address, int& protection, uintptr_t& mappingEnd) {
+            FILE* maps = fopen("/proc/self/maps", "r");
+            if (!maps)
+                return false;
+
+            bool found = false;
+            char line[512];
+            while (fgets(line, sizeof(line), maps)) {
+                unsigned long long begin = 0, end = 0;
+                char perms[5]{};
+                if (sscanf(line, "%llx-%llx %4s", &begin, &end, perms) != 3)
+                    continue;
+                if (address < begin || address >= end)
+                    continue;
+
+                protection = PROT_NONE;
+                if (perms[0] == 'r') protection |= PROT_READ;
+                if (perms[1] == 'w') protection |= PROT_WRITE;
+                if (perms[2] == 'x') protection |= PROT_EXEC;
+                mappingEnd = static_cast<uintptr_t>(end);
+                found = true;
+                break;
+            }
+            fclose(maps);
+            return found;
+        }
+    };
+#endif
+
+    struct PageRun {
+        uintptr_t Begin;
+        uintptr_t End;
+        uint32_t OldProtection;
+    };
+}
+
+MemoryAccess& ProcessMemory() {
+#ifdef _WIN32
+    static WindowsMemory memory;
+#else
+    static PosixMemory memory;
+#endif
+    return memory;
+}
+
+PatchTransaction::PatchTransaction(MemoryAccess& memory)
+    : mMemory(memory) {
+}
+
+void PatchTransaction::Add(uintptr_t address, std::vector<uint8_t> bytes) {
+    mWrites.push_back({ address, std::move(bytes), {} });
+}
+
+bool PatchTransaction::Commit() {
+    auto start = std::chrono::steady_clock::now();
+    mStats = {};
+    mStats.Writes = static_cast<uint32_t>(mWrites.size());
+    if (mWrites.empty())
+        return true;
+
+    std::vector<size_t> order(mWrites.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return mWrites[a].Address < mWrites[b].Address;
+    });
+
+    for (size_t i = 1; i < order.size(); ++i) {
+        const auto& prev = mWrites[order[i - 1]];
+        if (prev.Address + prev.Bytes.size() > mWrites[order[i]].Address) {
+            logger.Write(ERROR, "[Patch] Transaction: overlapping writes at 0x%p", mWrites[order[i]].Address);
+            return false;
+        }
+    }
+
+    const uintptr_t pageSize = mMemory.PageSize();
+    std::vector<PageRun> runs;
+    for (size_t idx : order) {
+        const auto& write = mWrites[idx];
+        uintptr_t begin = write.Address & ~(pageSize - 1);
+        uintptr_t end = (write.Address + write.Bytes.size() + pageSize - 1) & ~(pageSize - 1);
+        if (!runs.empty() && begin <= runs.back().End)
+            runs.back().End = std::max(runs.back().End, end);
+        else
+            runs.push_back({ begin, end, 0 });
+    }
+    for (const auto& run : runs)
+        mStats.Pages += static_cast<uint32_t>((run.End - run.Begin) / pageSize);
+
+    // Unprotect only reports the protection of the first page, so split runs where
+    // it changes and restore each part to its own.
+    std::vector<PageRun> uniformRuns;
+    for (const auto& run : runs) {
+        for (uintptr_t begin = run.Begin; begin < run.End;) {
+            uint32_t protection = 0;
+            size_t size = 0;
+            if (!mMemory.Query(begin, protection, size) || size == 0) {
+                logger.Write(ERROR, "[Patch] Transaction: failed to query 0x%p", begin);
+                return false;
+            }
+            uintptr_t end = std::min(run.End, (begin + size + pageSize - 1) & ~(pageSize - 1));
+            uniformRuns.push_back({ begin, end, protection });
+            begin = end;
+        }
+    }
+    runs = std::move(uniformRuns);
+
+    size_t unprotected = 0;
+    for (auto& run : runs) {
+        ++mStats.ProtectCalls;
+        if (!mMemory.Unprotect(run.Begin, run.End - run.Begin, run.OldProtection)) {
+            logger.Write(ERROR, "[Patch] Transaction: failed to unprotect 0x%p", run.Begin);
+            break;
+        }
+        ++unprotected;
+    }
+
+    bool success = unprotected == runs.size();
+    if (success) {
+        size_t written = 0;
+        for (size_t idx : order) {
+            auto& write = mWrites[idx];
+            write.Original.resize(write.Bytes.size());
+            mMemory.Read(write.Address, write.Original.data(), write.Original.size());
+            if (!mMemory.Write(write.Address, write.Bytes.data(), write.Bytes.size())) {
+                logger.Write(ERROR, "[Patch] Transaction: failed to write 0x%p", write.Address);
+                success = false;
+                break;
+            }
+            ++written;
+        }
+
+        if (!success) {
+            for (size_t i = written; i-- > 0;) {
+                const auto& write = mWrites[order[i]];
+                mMemory.Write(write.Address, write.Original.data(), write.Original.size());
+            }
+            mStats.RolledBack = true;
+        }
+
+        for (size_t i = 0; i < written; ++i) {
+            const auto& write = mWrites[order[i]];
+            mMemory.FlushInstructions(write.Address, write.Bytes.size());
+        }
+    }
+
+    for (size_t i = 0; i < unprotected; ++i) {
+        ++mStats.ProtectCalls;
+        if (!mMemory.Protect(runs[i].Begin, runs[i].End - runs[i].Begin, runs[i].OldProtection))
+            logger.Write(WARN, "[Patch] Transaction: failed to restore protection of 0x%p", runs[i].Begin);
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    mStats.CommitUs = static_cast<float>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / 1000.0f;
+    return success;
+}
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace MemoryPatcher {
+/*
+ * Protection changes and raw writes. The transaction only talks to memory
+ * through this, so it runs the same against the game or a test buffer.
+ */
+class MemoryAccess {
+public:
+    virtual ~MemoryAccess() = default;
+
+    virtual size_t PageSize() const = 0;
+
+    // Protection of the page at address, and how many bytes from address on have the same.
+    virtual bool Query(uintptr_t address, uint32_t& protection, size_t& size) const = 0;
+
+    // Makes [address, address + size) writable.
+    // oldProtection receives the value Protect() needs to undo it, for the first page.
+    virtual bool Unprotect(uintptr_t address, size_t size, uint32_t& oldProtection) = 0;
+    virtual bool Protect(uintptr_t address, size_t size, uint32_t protection) = 0;
+
+    virtual bool Write(uintptr_t address, const uint8_t* data, size_t size) = 0;
+    virtual void Read(uintptr_t address, uint8_t* data, size_t size) const = 0;
+
+    virtual void FlushInstructions(uintptr_t /*address*/, size_t /*size*/) { }
+};
+
+// Our own process: VirtualProtect on Windows, mprotect elsewhere.
+MemoryAccess& ProcessMemory();
+
+struct TransactionStats {
+    uint32_t Writes = 0;
+    uint32_t Pages = 0;
+    uint32_t ProtectCalls = 0; // Unprotect and Protect
+    bool RolledBack = false;
+    float CommitUs = 0.0f;
+};
+
+/*
+ * All-or-nothing set of writes.
+ * Writes are grouped by page, and each run of adjacent pages with the same
+ * protection is unprotected and re-protected once for the whole set. If any page
+ * can't be unprotected, nothing is written. If a write fails, the writes before
+ * it are reverted.
+ */
+class PatchTransaction {
+public:
+    explicit PatchTransaction(MemoryAccess& memory);
+
+    void Add(uintptr_t address, std::vector<uint8_t> bytes);
+    bool Commit();
+
+    // Bytes at the index-th added address before Commit() wrote to it.
+    const std::vector<uint8_t>& Original(size_t index) const {
+        return mWrites[index].Original;
+    }
+
+    size_t Size() const {
+        return mWrites.size();
+    }
+
+    const TransactionStats& Stats() const {
+        return mStats;
+    }
+
+private:
+    struct PendingWrite {
+        uintptr_t Address;
+        std::vector<uint8_t> Bytes;
+        std::vector<uint8_t> Original;
+    };
+
+    MemoryAccess& mMemory;
+    std::vector<PendingWrite> mWrites;
+    TransactionStats mStats;
+};
+}
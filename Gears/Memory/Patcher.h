@@ -3,8 +3,10 @@
 #include "PatternInfo.h"
 #include "../Util/Logger.hpp"
 #include "../Util/Strings.hpp"
+#include <cstring>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace MemoryPatcher {
 // simple NOP patcher
@@ -104,6 +106,72 @@ public:
         return mPatched;
     }
 
+    // Address to patch. Only scans for the pattern until it's been found once.
+    uintptr_t Resolve() {
+        if (mTemp != NULL)
+            return mTemp;
+
+        uintptr_t address = mem::FindPattern(mPattern.Pattern, mPattern.Mask);
+        if (address) {
+            address += mPattern.Offset;
+            logger.Write(DEBUG, "[Patch] [%s] found at 0x%p", mName.c_str(), address);
+        }
+        else {
+            logger.Write(ERROR, "[Patch] [%s] not found", mName.c_str());
+        }
+        mTemp = address;
+        return address;
+    }
+
+    // What to write over the original instruction bytes.
+    virtual std::vector<uint8_t> PatchedBytes(const std::vector<uint8_t>& original) const {
+        return std::vector<uint8_t>(original.size(), 0x90);
+    }
+
+    // For batches (MemoryPatcher::PatchAll/RestoreAll), which do the writes themselves.
+    size_t Size() const {
+        return mPattern.Data.size();
+    }
+
+    uintptr_t Address() const {
+        return mAddress;
+    }
+
+    const std::vector<uint8_t>& OriginalBytes() const {
+        return mPattern.Data;
+    }
+
+    const std::string& Name() const {
+        return mName;
+    }
+
+    void MarkPatched(uintptr_t address, const std::vector<uint8_t>& original) {
+        mPattern.Data = original;
+        mAddress = address;
+        mPatched = true;
+        mAttempts = 0;
+    }
+
+    void MarkRestored() {
+        mAddress = 0;
+        mPatched = false;
+        mAttempts = 0;
+    }
+
+    // A batch with this patcher failed. Counts toward the attempt limit like Patch().
+    void MarkFailed() {
+        mAttempts++;
+
+        if (mAttempts > mMaxAttempts) {
+            logger.Write(ERROR, "[Patch] [%s] Patch attempt limit exceeded", mName.c_str());
+            logger.Write(ERROR, "[Patch] [%s] Patching disabled", mName.c_str());
+        }
+    }
+
+    bool AttemptsExceeded() const {
+        return mAttempts > mMaxAttempts;
+    }
+
 protected:
     const std::string mName;
     PatternInfo& mPattern;
@@ -116,24 +184,11 @@ protected:
     uintptr_t mTemp;
 
     virtual uintptr_t Apply() {
-        uintptr_t address;
-        if (mTemp != NULL) {
-            address = mTemp;
-        }
-        else {
-            address = mem::FindPattern(mPattern.Pattern, mPattern.Mask);
-            if (address) {
-                address += mPattern.Offset;
-                logger.Write(DEBUG, "[Patch] [%s] found at 0x%p", mName.c_str(), address);
-            }
-            else {
-                logger.Write(ERROR, "[Patch] [%s] not found", mName.c_str());
-            }
-        }
-
+        uintptr_t address = Resolve();
         if (address) {
             memcpy(mPattern.Data.data(), (void*)address, mPattern.Data.size());
-            memset(reinterpret_cast<void *>(address), 0x90, mPattern.Data.size());
+            std::vector<uint8_t> bytes = PatchedBytes(mPattern.Data);
+            memcpy((void*)address, bytes.data(), bytes.size());
         }
         return address;
     }
@@ -148,37 +203,12 @@ public:
     PatcherJmp(const std::string& name, PatternInfo& pattern)
         : Patcher(name, pattern) {}
 
-protected:
-    uintptr_t Apply() override {
-        uintptr_t address;
-        if (mTemp != NULL) {
-            address = mTemp;
-        }
-        else {
-            address = mem::FindPattern(mPattern.Pattern, mPattern.Mask);
-            if (address) {
-                address += mPattern.Offset;
-                logger.Write(DEBUG, "[Patch] [%s] found at 0x%p", mName.c_str(), address);
-            }
-            else {
-                logger.Write(ERROR, "[Patch] [%s] not found", mName.c_str());
-            }
-        }
-
-        if (address) {
-            uint8_t instrArr[6] =
-            { 0xE9, 0x00, 0x00, 0x00, 0x00, 0x90 };               // make preliminary instruction: JMP to <adrr>
-            uint8_t origSteerInstrDest[4] = { 0x00, 0x00, 0x00, 0x00 };
-
-            memcpy(mPattern.Data.data(), (void*)address, 6); // save whole orig instruction
-            memcpy(origSteerInstrDest, (void*)(address + 2), 4);    // save the address it writes to
-            origSteerInstrDest[0] += 1;                             // Increment first byte by 1
-            memcpy(instrArr + 1, origSteerInstrDest, 4);            // use saved address in new instruction
-            memcpy((void*)address, instrArr, 6);                    // patch with new fixed instruction
-
-            return address;
-        }
-        return 0;
+    std::vector<uint8_t> PatchedBytes(const std::vector<uint8_t>& original) const override {
+        std::vector<uint8_t> instr =
+            { 0xE9, 0x00, 0x00, 0x00, 0x00, 0x90 };                 // make preliminary instruction: JMP to <adrr>
+        memcpy(instr.data() + 1, original.data() + 2, 4);           // use the address the original writes to
+        instr[1] += 1;                                              // Increment first byte by 1
+        return instr;
     }
 };
 }
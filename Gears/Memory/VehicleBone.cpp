@@ -6,70 +6,33 @@
 #include "VehicleBone.h"
 #include "VehicleExtensions.hpp"
 #include <inc/natives.h>
-#include <map>
 
 using VExt = VehicleExtensions;
 
 namespace {
-    std::map<std::pair<Hash, int>, NativeMatrix4x4> matrixCache;
-}
+    NativeMatrix4x4* objectMatrix(Vehicle vehicle, int index) {
+        auto address = VExt::GetAddress(vehicle);
+        auto fragInstGtaPtr = *reinterpret_cast<uint64_t*>(address + 0x30);
+        auto inst = reinterpret_cast<VehicleBones::fragInstGta*>(fragInstGtaPtr);
 
-void VehicleBones::RotateAxisAbsolute(Vehicle vehicle, int index, Vector3 axis, float radians) {
-    auto model = ENTITY::GET_ENTITY_MODEL(vehicle);
-    auto originalMatrix = matrixCache.find(std::make_pair(model, index));
-    if (originalMatrix == matrixCache.end()) {
-        return;
+        return &(inst->CacheEntry->Skeleton->ObjectMatrices[index]);
     }
+}
 
-    auto address = VExt::GetAddress(vehicle);
-    auto fragInstGtaPtr = *reinterpret_cast<uint64_t*>(address + 0x30);
-    auto inst = reinterpret_cast<fragInstGta*>(fragInstGtaPtr);
-
-    NativeMatrix4x4* matrix = &(inst->CacheEntry->Skeleton->ObjectMatrices[index]);
-    NativeMatrix4x4 o = originalMatrix->second;
-    Vector3 scalar { 1.0f, 1.0f, 1.0f };
-    o = Scaling(scalar) * RotationAxis(axis, radians) * o;
-
-    *matrix = o;
+void VehicleBones::RotateAxisAbsolute(Vehicle vehicle, int index, const NativeMatrix4x4& original, Vector3 axis, float radians) {
+    *objectMatrix(vehicle, index) = RotateAxisApply(axis, radians, original);
 }
 
 void VehicleBones::RotateAxis(Vehicle vehicle, int index, Vector3 axis, float radians) {
-    auto address = VExt::GetAddress(vehicle);
-    auto fragInstGtaPtr = *reinterpret_cast<uint64_t*>(address + 0x30);
-    auto inst = reinterpret_cast<fragInstGta*>(fragInstGtaPtr);
-
-    NativeMatrix4x4* matrix = &(inst->CacheEntry->Skeleton->ObjectMatrices[index]);
-    Vector3 scalar { 1.0f, 1.0f, 1.0f };
-    NativeMatrix4x4 newMatrix = Scaling(scalar) * RotationAxis(axis, radians) * (*matrix);
-    *matrix = newMatrix;
+    NativeMatrix4x4* matrix = objectMatrix(vehicle, index);
+    *matrix = RotateAxisApply(axis, radians, *matrix);
 }
 
 void VehicleBones::Scale(Vehicle vehicle, int boneIndex, Vector3 scalar) {
-    auto address = VExt::GetAddress(vehicle);
-    auto fragInstGtaPtr = *reinterpret_cast<uint64_t*>(address + 0x30);
-    auto inst = reinterpret_cast<fragInstGta*>(fragInstGtaPtr);
-
-    NativeMatrix4x4* matrix = &(inst->CacheEntry->Skeleton->ObjectMatrices[boneIndex]);
-    NativeMatrix4x4 newMatrix = Scaling(scalar) * (*matrix);
-    *matrix = newMatrix;
+    NativeMatrix4x4* matrix = objectMatrix(vehicle, boneIndex);
+    *matrix = ScaleApply(scalar, *matrix);
 }
 
-void VehicleBones::RegisterMatrix(Vehicle vehicle, const char* boneName) {
-    auto boneIdx = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(vehicle, boneName);
-    if (boneIdx != -1)
-        VehicleBones::RegisterMatrix(vehicle, boneIdx);
-}
-
-void VehicleBones::RegisterMatrix(Vehicle vehicle, int boneIndex) {
-    auto model = ENTITY::GET_ENTITY_MODEL(vehicle);
-
-    if (matrixCache.find(std::make_pair(model, boneIndex)) == matrixCache.end()) {
-        auto address = VExt::GetAddress(vehicle);
-        auto fragInstGtaPtr = *reinterpret_cast<uint64_t*>(address + 0x30);
-        auto inst = reinterpret_cast<VehicleBones::fragInstGta*>(fragInstGtaPtr);
-
-        NativeMatrix4x4* matrix = &(inst->CacheEntry->Skeleton->ObjectMatrices[boneIndex]);
-
-        matrixCache[std::make_pair(model, boneIndex)] = *matrix;
-    }
+NativeMatrix4x4 VehicleBones::GetObjectMatrix(Vehicle vehicle, int boneIndex) {
+    return *objectMatrix(vehicle, boneIndex);
 }
@@ -98,10 +98,10 @@ struct CVehicle {
 #pragma pack(pop)
 static_assert(offsetof(CVehicle, Inst) == 0x30, "bad alignment");
 
-void RotateAxisAbsolute(Vehicle vehicle, int index, Vector3 axis, float radians);
+// Sets the bone to original, rotated. See ModelCache::BoneInfo for the original matrix.
+void RotateAxisAbsolute(Vehicle vehicle, int index, const NativeMatrix4x4& original, Vector3 axis, float radians);
 void RotateAxis(Vehicle vehicle, int index, Vector3 axis, float radians);
 void Scale(Vehicle vehicle, int boneIndex, Vector3 scalar);
 
-void RegisterMatrix(Vehicle vehicle, const char* boneName);
-void RegisterMatrix(Vehicle vehicle, int boneIndex);
+NativeMatrix4x4 GetObjectMatrix(Vehicle vehicle, int boneIndex);
 }
@@ -10,6 +10,7 @@
 
 #include <inc/main.h>
 
+#include <array>
 #include <vector>
 #include <functional>
 
@@ -86,6 +87,73 @@ namespace {
     int wheelMatTyreDragOffset = 0;
     int wheelMatTopSpeedMultOffset = 0;
     int wheelMatTypeOffset = 0;
+
+    // Per-tick memory view
+    bool tickOpen = false;
+    VehicleExtensions::TickStats tickStats{};
+    VehicleExtensions::TickStats lastTickStats{};
+
+    struct AddressEntry {
+        Vehicle Handle = 0;
+        BYTE* Address = nullptr;
+    };
+    // The player vehicle, and occasionally one other.
+    std::array<AddressEntry, 4> addressCache{};
+    size_t nextAddressEntry = 0;
+
+    struct StagedFloat {
+        bool Pending = false;
+        float Value = 0.0f;
+    };
+
+    struct StagedWrites {
+        Vehicle Handle = 0;
+        StagedFloat RPM;
+        StagedFloat Clutch;
+        StagedFloat Throttle;
+    } staged;
+
+    BYTE* resolveAddress(Vehicle handle) {
+        return reinterpret_cast<BYTE*>(mem::GetAddressOfEntity(handle));
+    }
+
+    void storeStaged(BYTE* address, int offset, StagedFloat& value) {
+        if (value.Pending && address != nullptr && offset != 0) {
+            *reinterpret_cast<float*>(address + offset) = value.Value;
+            ++tickStats.MemoryWrites;
+        }
+        value.Pending = false;
+    }
+
+    void flushStaged() {
+        if (staged.Handle == 0)
+            return;
+
+        BYTE* address = VehicleExtensions::GetAddress(staged.Handle);
+        storeStaged(address, currentRPMOffset, staged.RPM);
+        storeStaged(address, clutchOffset, staged.Clutch);
+        storeStaged(address, throttleOffset, staged.Throttle);
+        staged.Handle = 0;
+    }
+
+    // Returns the staging slot for handle, or nullptr when writes go straight to memory.
+    StagedFloat* stage(Vehicle handle, StagedFloat StagedWrites::* field) {
+        if (!tickOpen)
+            return nullptr;
+
+        if (staged.Handle != handle) {
+            flushStaged();
+            staged.Handle = handle;
+        }
+        ++tickStats.StagedWrites;
+        return &(staged.*field);
+    }
+
+    const StagedFloat* findStaged(Vehicle handle, StagedFloat StagedWrites::* field) {
+        if (!tickOpen || staged.Handle != handle || !(staged.*field).Pending)
+            return nullptr;
+        return &(staged.*field);
+    }
 }
 
 void VehicleExtensions::SetVersion(int version) {
@@ -354,7 +422,42 @@ void VehicleExtensions::Init() {
 }
 
 BYTE *VehicleExtensions::GetAddress(Vehicle handle) {
-    return reinterpret_cast<BYTE *>(mem::GetAddressOfEntity(handle));
+    if (!tickOpen)
+        return resolveAddress(handle);
+
+    ++tickStats.AddressRequests;
+    for (const auto& entry : addressCache) {
+        if (entry.Handle == handle && entry.Address != nullptr)
+            return entry.Address;
+    }
+
+    ++tickStats.AddressResolves;
+    BYTE* address = resolveAddress(handle);
+    if (address != nullptr) {
+        addressCache[nextAddressEntry] = { handle, address };
+        nextAddressEntry = (nextAddressEntry + 1) % addressCache.size();
+    }
+    return address;
+}
+
+void VehicleExtensions::BeginTick() {
+    addressCache = {};
+    nextAddressEntry = 0;
+    tickStats = {};
+    tickOpen = true;
+}
+
+void VehicleExtensions::EndTick() {
+    if (!tickOpen)
+        return;
+
+    flushStaged();
+    tickOpen = false;
+    lastTickStats = tickStats;
+}
+
+const VehicleExtensions::TickStats& VehicleExtensions::GetLastTickStats() {
+    return lastTickStats;
 }
 
 bool VehicleExtensions::GetRocketBoostActive(Vehicle handle) {
@@ -527,28 +630,39 @@ void VehicleExtensions::SetDriveMaxFlatVel(Vehicle handle, float value) {
 
 float VehicleExtensions::GetCurrentRPM(Vehicle handle) {
     if (currentRPMOffset == 0) return 0.0f;
+    if (auto pending = findStaged(handle, &StagedWrites::RPM)) return pending->Value;
     return *reinterpret_cast<const float *>(GetAddress(handle) + currentRPMOffset);
 }
 
 void VehicleExtensions::SetCurrentRPM(Vehicle handle, float value) {
     if (currentRPMOffset == 0) return;
+    if (auto slot = stage(handle, &StagedWrites::RPM)) {
+        *slot = { true, value };
+        return;
+    }
     *reinterpret_cast<float *>(GetAddress(handle) + currentRPMOffset) = value;
 }
 
 float VehicleExtensions::GetClutch(Vehicle handle) {
     if (clutchOffset == 0) return 0.0f;
+    if (auto pending = findStaged(handle, &StagedWrites::Clutch)) return pending->Value;
     auto address = GetAddress(handle);
     return address == nullptr ? 0 : *reinterpret_cast<const float *>(address + clutchOffset);
 }
 
 void VehicleExtensions::SetClutch(Vehicle handle, float value) {
     if (clutchOffset == 0) return;
+    if (auto slot = stage(handle, &StagedWrites::Clutch)) {
+        *slot = { true, value };
+        return;
+    }
     auto address = GetAddress(handle);
     *reinterpret_cast<float *>(address + clutchOffset) = value;
 }
 
 float VehicleExtensions::GetThrottle(Vehicle handle) {
     if (throttleOffset == 0) return 0.0f;
+    if (auto pending = findStaged(handle, &StagedWrites::Throttle)) return pending->Value;
     auto address = GetAddress(handle);
     return *reinterpret_cast<float *>(address + throttleOffset);
 }
@@ -556,6 +670,10 @@ float VehicleExtensions::GetThrottle(Vehicle handle) {
 // Seems to just control the sound.
 void VehicleExtensions::SetThrottle(Vehicle handle, float value) {
     if (throttleOffset == 0) return;
+    if (auto slot = stage(handle, &StagedWrites::Throttle)) {
+        *slot = { true, value };
+        return;
+    }
     auto address = GetAddress(handle);
     *reinterpret_cast<float *>(address + throttleOffset) = value;
 }
@@ -854,6 +972,24 @@ std::vector<float> VehicleExtensions::GetWheelHealths(Vehicle handle) {
     return healths;
 }
 
+float VehicleExtensions::GetWheelHealth(Vehicle handle, uint8_t index) {
+    if (index >= GetNumWheels(handle)) return 0.0f;
+    if (wheelHealthOffset == 0) return 0.0f;
+
+    auto wheelPtr = GetWheelsPtr(handle);
+    auto wheelAddr = *reinterpret_cast<uint64_t*>(wheelPtr + 0x008 * index);
+    return *reinterpret_cast<float*>(wheelAddr + wheelHealthOffset);
+}
+
+float VehicleExtensions::GetTyreHealth(Vehicle handle, uint8_t index) {
+    if (index >= GetNumWheels(handle)) return 0.0f;
+    if (wheelHealthOffset == 0) return 0.0f;
+
+    auto wheelPtr = GetWheelsPtr(handle);
+    auto wheelAddr = *reinterpret_cast<uint64_t*>(wheelPtr + 0x008 * index);
+    return *reinterpret_cast<float*>(wheelAddr + wheelHealthOffset + 0x4);
+}
+
 void VehicleExtensions::SetWheelsHealth(Vehicle handle, float health) {
     if (wheelHealthOffset == 0) return;
 
@@ -1184,6 +1320,15 @@ std::vector<uint16_t> VehicleExtensions::GetTireContactMaterial(Vehicle handle)
     return values;
 }
 
+uint16_t VehicleExtensions::GetTireContactMaterial(Vehicle handle, uint8_t index) {
+    if (index >= GetNumWheels(handle)) return 0;
+    if (wheelMatTypeOffset == 0) return 0;
+
+    auto wheelPtr = GetWheelsPtr(handle);
+    auto wheelAddr = *reinterpret_cast<uint64_t*>(wheelPtr + 0x008 * index);
+    return *reinterpret_cast<uint16_t*>(wheelAddr + wheelMatTypeOffset);
+}
+
 std::vector<float> VehicleExtensions::GetWheelPower(Vehicle handle) {
     auto numWheels = GetNumWheels(handle);
     auto wheelPtr = GetWheelsPtr(handle);
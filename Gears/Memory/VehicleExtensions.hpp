@@ -17,6 +17,25 @@ public:
 
     static BYTE* GetAddress(Vehicle handle);
 
+    /*
+     * Per-tick vehicle memory view, for the main script only.
+     * Between BeginTick() and EndTick() entity addresses are resolved once per
+     * vehicle, and throttle, clutch and RPM writes are staged and stored once in
+     * EndTick(). Reads of those return the staged value. Nothing may WAIT while
+     * the view is open: other scripts could delete the vehicle in between.
+     */
+    struct TickStats {
+        uint32_t AddressRequests;
+        uint32_t AddressResolves; // Actual GetAddressOfEntity calls
+        uint32_t StagedWrites;
+        uint32_t MemoryWrites;    // Staged values actually stored
+    };
+
+    static void BeginTick();
+    static void EndTick();
+    // Counters of the previous, completed tick
+    static const TickStats& GetLastTickStats();
+
     // <  1604:  8 gears
     // >= 1604: 11 gears
     static uint8_t GearsAvailable();
@@ -175,6 +194,9 @@ public:
     static std::vector<Vector3> GetWheelTractionVector(Vehicle handle);
 
     static std::vector<float> GetWheelHealths(Vehicle handle);
+    static float GetWheelHealth(Vehicle handle, uint8_t index);
+    // Drops when the tyre deflates or bursts
+    static float GetTyreHealth(Vehicle handle, uint8_t index);
     static void SetWheelsHealth(Vehicle handle, float health);
     
     static std::vector<float> GetWheelSteeringMultipliers(Vehicle handle);
@@ -210,6 +232,7 @@ public:
     static std::vector<float> GetTyreDrags(Vehicle handle);
     static std::vector<float> GetTopSpeedMults(Vehicle handle);
     static std::vector<uint16_t> GetTireContactMaterial(Vehicle handle);
+    static uint16_t GetTireContactMaterial(Vehicle handle, uint8_t index);
 
     // Needs patching the decreasing thing
     static std::vector<float> GetWheelPower(Vehicle handle);
@@ -1,7 +1,9 @@
 #include "ScriptHUD.h"
 #include <fmt/format.h>
 #include <inc/natives.h>
+#include <array>
 #include <numeric>
+#include <tuple>
 
 #include <menu.h>
 
@@ -15,11 +17,18 @@
 #include "Util/UIUtils.h"
 #include "Util/Materials.h"
 #include "Util/ScriptUtils.h"
+#include "Util/Profiler.h"
+#include "Util/NativeCache.h"
+#include "Util/LazyValue.h"
+#include "Util/Scheduler.h"
+#include "Util/CachedText.h"
 
 #include "Input/CarControls.hpp"
 #include "VehicleData.hpp"
+#include "VehicleModelCache.h"
 #include "ScriptSettings.hpp"
 #include "WheelInput.h"
+#include "WheelStatus.h"
 #include "Memory/Offsets.hpp"
 
 using VExt = VehicleExtensions;
@@ -53,9 +62,19 @@ void drawDashLights();
 void drawLSDInfo();
 void drawMouseSteering();
 void drawSteeringFfb();
+void drawProfilerInfo();
 
 namespace GForce {
-    std::vector<std::pair<float, float>> CoordTrails;
+    constexpr size_t TrailLength = 15;
+
+    // Ring buffer, oldest first starting at TrailHead once full.
+    std::array<std::pair<float, float>, TrailLength> CoordTrails;
+    size_t TrailHead = 0;
+    size_t TrailCount = 0;
+
+    UI::CachedText<int64_t> LatText;
+    UI::CachedText<int64_t> LonText;
+    UI::CachedText<int64_t> VertText;
 }
 
 namespace DashLights {
@@ -364,18 +383,22 @@ void drawGForces() {
     float GForceY = accel.y / 9.8f;
     float GForceZ = accel.z / 9.8f;
 
-    UI::ShowText(locX + 0.100f, locY - 0.075f, 0.5f, fmt::format("LAT: {:.2f} g", GForceX));
-    UI::ShowText(locX + 0.100f, locY - 0.025f, 0.5f, fmt::format("LON: {:.2f} g", GForceY));
-    UI::ShowText(locX + 0.100f, locY + 0.025f, 0.5f, fmt::format("VERT: {:.2f} g", GForceZ));
+    UI::ShowText(locX + 0.100f, locY - 0.075f, 0.5f,
+        LatText.Get(UI::Quantize(GForceX, 2), [=] { return fmt::format("LAT: {:.2f} g", GForceX); }));
+    UI::ShowText(locX + 0.100f, locY - 0.025f, 0.5f,
+        LonText.Get(UI::Quantize(GForceY, 2), [=] { return fmt::format("LON: {:.2f} g", GForceY); }));
+    UI::ShowText(locX + 0.100f, locY + 0.025f, 0.5f,
+        VertText.Get(UI::Quantize(GForceZ, 2), [=] { return fmt::format("VERT: {:.2f} g", GForceZ); }));
     
     // 1 div = 1G, entire thing = 2g
     float offX = (szX * 0.5f) * GForceX * 0.5f;
     float offY = (szY * 0.5f) * GForceY * 0.5f;
 
-    CoordTrails.emplace_back(offX, offY);
-    while (CoordTrails.size() > 15) {
-        CoordTrails.erase(CoordTrails.begin());
-    }
+    CoordTrails[(TrailHead + TrailCount) % TrailLength] = { offX, offY };
+    if (TrailCount < TrailLength)
+        ++TrailCount;
+    else
+        TrailHead = (TrailHead + 1) % TrailLength;
 
     GRAPHICS::DRAW_RECT({ locX, locY }, szX, szY, 0, 0, 0, 127, 0);
     GRAPHICS::DRAW_RECT({ locX, locY }, 0.001f, szY, 255, 255, 255, 127, 0);
@@ -387,26 +410,26 @@ void drawGForces() {
     GRAPHICS::DRAW_RECT({ locX - 0.25f * szX, locY }, 0.001f, szY, 127, 127, 127, 127, 0);
     GRAPHICS::DRAW_RECT({ locX, locY - 0.25f * szY }, szX, 0.001f, 127, 127, 127, 127, 0);
 
-    std::vector<float> allX;
-    std::vector<float> allY;
+    float sumX = 0.0f;
+    float sumY = 0.0f;
 
     int alpha = 0;
-    for (auto it = CoordTrails.begin(); it != CoordTrails.end(); ++it) {
-        auto c = *it;
-        if (std::next(it) == CoordTrails.end()) {
+    for (size_t i = 0; i < TrailCount; ++i) {
+        const auto& c = CoordTrails[(TrailHead + i) % TrailLength];
+        if (i + 1 == TrailCount) {
             GRAPHICS::DRAW_RECT({ locX + c.first, locY + c.second }, szX * 0.025f, szY * 0.025f, 255, 255, 255, 255, 0);
-            allX.push_back(locX + c.first);
-            allY.push_back(locY + c.second);
         }
         else {
             GRAPHICS::DRAW_RECT({ locX + c.first, locY + c.second }, szX * 0.025f, szY * 0.025f, 127, 127, 127, alpha, 0);
-            allX.push_back(locX + c.first);
-            allY.push_back(locY + c.second);
         }
-        alpha += 255 / static_cast<int>(CoordTrails.size());
+        sumX += locX + c.first;
+        sumY += locY + c.second;
+        alpha += 255 / static_cast<int>(TrailCount);
     }
 
-    GRAPHICS::DRAW_RECT({ avg(allX), avg(allY) }, szX * 0.020f, szY * 0.020f, 255, 0, 0, 255, 0);
+    float avgX = sumX / static_cast<float>(TrailCount);
+    float avgY = sumY / static_cast<float>(TrailCount);
+    GRAPHICS::DRAW_RECT({ avgX, avgY }, szX * 0.020f, szY * 0.020f, 255, 0, 0, 255, 0);
 }
 
 void drawRPMIndicator(float x, float y, float width, float height, Util::ColorI fg, Util::ColorI bg, float rpm) {
@@ -519,25 +542,30 @@ void drawRPMIndicator() {
     );
 }
 
-std::string formatSpeedo(std::string units, float speed, bool showUnit, int hudFont) {
-    if (units == "kph") 
-        speed = speed * 3.6f;
-
-    if (units == "mph") 
-        speed = speed / 0.44704f;
-
-    if (hudFont != 2 && units == "kph") 
-        units = "km/h";
-
-    if (hudFont != 2 && units == "ms") 
-        units = "m/s";
+float toSpeedoUnit(ESpeedoUnit unit, float speedms) {
+    switch (unit) {
+        case ESpeedoUnit::Kph: return speedms * 3.6f;
+        case ESpeedoUnit::Mph: return speedms / 0.44704f;
+        default: return speedms;
+    }
+}
 
+// speed: already in the display unit
+std::string formatSpeedo(ESpeedoUnit unit, float speed, bool showUnit, int hudFont) {
     std::string str = fmt::format("{:03.0f}", speed);
 
-    if (showUnit) 
-        str = fmt::format("{} {}", str, units);
+    if (!showUnit)
+        return str;
 
-    return str;
+    // Font 2 lacks the slash
+    const char* unitName = "";
+    switch (unit) {
+        case ESpeedoUnit::Kph: unitName = hudFont != 2 ? "km/h" : "kph"; break;
+        case ESpeedoUnit::Mph: unitName = "mph"; break;
+        case ESpeedoUnit::Ms:  unitName = hudFont != 2 ? "m/s" : "ms"; break;
+        default: break;
+    }
+    return fmt::format("{} {}", str, unitName);
 }
 
 void drawSpeedoMeter() {
@@ -554,9 +582,20 @@ void drawSpeedoMeter() {
         g_settings.HUD.Speedo.ColorB,
         255
     };
+
+    // Reformat only when the printed number or the format settings change
+    static UI::CachedText<std::tuple<int64_t, ESpeedoUnit, bool, int>> speedoText;
+
+    const ESpeedoUnit unit = g_settings.HUD.Speedo.UnitType;
+    const bool showUnit = g_settings.HUD.Speedo.ShowUnit;
+    const int font = g_settings.HUD.Font;
+    const float speed = toSpeedoUnit(unit, speedms);
+    const auto& text = speedoText.Get({ UI::Quantize(speed, 0), unit, showUnit, font }, [&] {
+        return formatSpeedo(unit, speed, showUnit, font);
+    });
+
     UI::ShowText(g_settings.HUD.Speedo.XPos, g_settings.HUD.Speedo.YPos, g_settings.HUD.Speedo.Size,
-        formatSpeedo(g_settings.HUD.Speedo.Unit, speedms, g_settings.HUD.Speedo.ShowUnit, g_settings.HUD.Font),
-        g_settings.HUD.Font, color, g_settings.HUD.Outline);
+        text, g_settings.HUD.Font, color, g_settings.HUD.Outline);
 }
 
 void drawShiftModeIndicator() {
@@ -582,23 +621,33 @@ void drawShiftModeIndicator() {
 }
 
 void drawGearIndicator() {
-    std::string gear = std::to_string(VExt::GetGearCurr(g_playerVehicle));
+    static UI::CachedText<int> gearText;
+
+    const int gearCurr = VExt::GetGearCurr(g_playerVehicle);
+    // Negative keys for the lettered states
+    int gearKey = gearCurr;
     if (VExt::GetHandbrake(g_playerVehicle)) {
-        gear = "P";
+        gearKey = -1;
     }
     else if (g_gearStates.FakeNeutral && g_settings.MTOptions.Enable) {
-        gear = "N";
-    }
-    else if (VExt::GetGearCurr(g_playerVehicle) == 0) {
-        gear = "R";
+        gearKey = -2;
     }
+
+    const std::string& gear = gearText.Get(gearKey, [gearKey] {
+        switch (gearKey) {
+            case -1: return std::string("P");
+            case -2: return std::string("N");
+            case 0:  return std::string("R");
+            default: return std::to_string(gearKey);
+        }
+    });
     Util::ColorI color {
         g_settings.HUD.Gear.ColorR,
         g_settings.HUD.Gear.ColorG,
         g_settings.HUD.Gear.ColorB,
         255
     };
-    if (VExt::GetGearCurr(g_playerVehicle) == VExt::GetTopGear(g_playerVehicle)) {
+    if (gearCurr == VExt::GetTopGear(g_playerVehicle)) {
         color.R = g_settings.HUD.Gear.TopColorR;
         color.G = g_settings.HUD.Gear.TopColorG;
         color.B = g_settings.HUD.Gear.TopColorB;
@@ -609,6 +658,8 @@ void drawGearIndicator() {
 }
 
 void MTHUD::UpdateHUD() {
+    UI::NewTextFrame();
+
     if (!Util::PlayerAvailable(g_player, g_playerPed) ||
         !Util::VehicleAvailable(g_playerVehicle, g_playerPed)) {
         return;
@@ -625,9 +676,7 @@ void MTHUD::UpdateHUD() {
         if (g_settings.HUD.ShiftMode.Enable) {
             drawShiftModeIndicator();
         }
-        if (g_settings.HUD.Speedo.Unit == "kph" ||
-            g_settings.HUD.Speedo.Unit == "mph" ||
-            g_settings.HUD.Speedo.Unit == "ms") {
+        if (g_settings.HUD.Speedo.UnitType != ESpeedoUnit::Off) {
             drawSpeedoMeter();
         }
         if (g_settings.HUD.RPMBar.Enable) {
@@ -670,6 +719,10 @@ void MTHUD::UpdateHUD() {
     if (g_settings.Debug.Metrics.GForce.Enable) {
         drawGForces();
     }
+    if (g_settings.Debug.Metrics.Profiler.Enable &&
+        g_settings.Debug.Metrics.Profiler.Display) {
+        drawProfilerInfo();
+    }
 
     if (g_settings.Debug.DisplayInfo &&
         g_settings.CustomSteering.Mode > 0 &&
@@ -685,6 +738,12 @@ void drawDebugInfo() {
         UI::ShowText(0.01, 0.275, 0.3, fmt::format("MT: {}" , g_settings.MTOptions.Enable));
         UI::ShowText(0.01, 0.300, 0.3, fmt::format("RPM: {:.3f}", g_vehData.mRPM));
         UI::ShowText(0.01, 0.325, 0.3, fmt::format("Gear: C[{}] N[{}]", VExt::GetGearCurr(g_playerVehicle), VExt::GetGearNext(g_playerVehicle)));
+        auto modelCacheStats = ModelCache::GetStats();
+        uint64_t modelCacheLookups = modelCacheStats.Hits + modelCacheStats.Misses;
+        UI::ShowText(0.01, 0.350, 0.3, fmt::format("Model cache: {}/{} hits ({:.0f}%) | {}/{} models | {} evicted",
+            modelCacheStats.Hits, modelCacheLookups,
+            modelCacheLookups ? 100.0 * modelCacheStats.Hits / modelCacheLookups : 0.0,
+            modelCacheStats.Size, ModelCache::Capacity, modelCacheStats.Evictions));
         UI::ShowText(0.01, 0.375, 0.3, fmt::format("Clutch: {:.2f}", VExt::GetClutch(g_playerVehicle)));
         UI::ShowText(0.01, 0.400, 0.3, fmt::format("Throttle: {:.2f}", VExt::GetThrottle(g_playerVehicle)));
         UI::ShowText(0.01, 0.425, 0.3, fmt::format("Turbo: {:.2f}", VExt::GetTurbo(g_playerVehicle)));
@@ -801,11 +860,11 @@ void drawInputWheelInfo() {
 }
 
 void drawVehicleWheelTractionVector() {
-    auto numWheels = VExt::GetNumWheels(g_playerVehicle);
+    auto numWheels = NativeCache::GetNumWheels(g_playerVehicle);
     auto wheelOffs = VExt::GetWheelOffsets(g_playerVehicle);
     auto wheelTVLYs = VExt::GetWheelTractionVectorY(g_playerVehicle);
     auto wheelTVLXs = VExt::GetWheelTractionVectorX(g_playerVehicle);
-    auto wheelCoords = Util::GetWheelCoords(g_playerVehicle);
+    const auto& wheelCoords = g_vehData.GetWheelCoords();
     for (int i = 0; i < numWheels; i++) {
         Vector3 tractionVectorWorld = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle,
             { wheelOffs[i].x + -wheelTVLXs[i], wheelOffs[i].y + wheelTVLYs[i], wheelOffs[i].z });
@@ -822,8 +881,8 @@ void drawVehicleWheelTractionVector() {
 }
 
 void drawVehicleWheelMaterialInfo() {
-    auto numWheels = VExt::GetNumWheels(g_playerVehicle);
-    auto wheelCoords = Util::GetWheelCoords(g_playerVehicle);
+    auto numWheels = NativeCache::GetNumWheels(g_playerVehicle);
+    const auto& wheelCoords = g_vehData.GetWheelCoords();
 
     auto materialIndex = VExt::GetTireContactMaterial(g_playerVehicle);
     auto tyreGrips = VExt::GetTyreGrips(g_playerVehicle);
@@ -846,14 +905,14 @@ void drawVehicleWheelMaterialInfo() {
 }
 
 void drawVehicleWheelInfo() {
-    auto numWheels = VExt::GetNumWheels(g_playerVehicle);
+    auto numWheels = NativeCache::GetNumWheels(g_playerVehicle);
     auto wheelsSpeed = VExt::GetTyreSpeeds(g_playerVehicle);
     auto wheelsCompr = VExt::GetWheelCompressions(g_playerVehicle);
     auto wheelsHealt = VExt::GetWheelHealths(g_playerVehicle);
     auto wheelsContactCoords = VExt::GetWheelLastContactCoords(g_playerVehicle);
     auto wheelsOnGround = VExt::GetWheelsOnGround(g_playerVehicle);
 
-    auto wheelCoords = Util::GetWheelCoords(g_playerVehicle);
+    const auto& wheelCoords = g_vehData.GetWheelCoords();
     auto wheelsPower = VExt::GetWheelPower(g_playerVehicle);
     auto wheelsBrake = VExt::GetWheelBrakePressure(g_playerVehicle);
     auto wheelDims = VExt::GetWheelDimensions(g_playerVehicle);
@@ -862,7 +921,7 @@ void drawVehicleWheelInfo() {
     auto wheelLoads = VExt::GetWheelLoads(g_playerVehicle);
     //auto wheelHots = VExt::GetWheelOverheats(g_playerVehicle);
 
-    auto wheelsTcs = DrivingAssists::GetTCS();
+    const auto& wheelsTcs = DrivingAssists::GetTCS();
 
     UI::ShowText(0.60f, 0.175f, 0.25f, fmt::format("Gravity constant: {:.3f} m/s2", VExt::GetGravity(g_playerVehicle)));
     UI::ShowText(0.60f, 0.200f, 0.25f, fmt::format("Average load: {:.0f} kg", avg(wheelLoads)));
@@ -925,21 +984,19 @@ void drawVehicleWheelInfo() {
 }
 
 void drawLSDInfo() {
-    auto lsdData = DrivingAssists::GetLSD();
-    std::string fddcol;
-    if (lsdData.FDD > 0.1f) { fddcol = "~r~"; }
-    if (lsdData.FDD < -0.1f) { fddcol = "~b~"; }
-
-    std::string rddcol;
-    if (lsdData.RDD > 0.1f) { rddcol = "~r~"; }
-    if (lsdData.RDD < -0.1f) { rddcol = "~b~"; }
-    UI::ShowText(0.60f, 0.000f, 0.25f, fmt::format("LF LSD: {:.2f}", lsdData.BrakeLF));
-    UI::ShowText(0.65f, 0.000f, 0.25f, fmt::format("RF LSD: {:.2f}", lsdData.BrakeRF));
-    UI::ShowText(0.70f, 0.000f, 0.25f, fmt::format("{}L-R: {:.2f}", fddcol, lsdData.FDD));
-    UI::ShowText(0.60f, 0.025f, 0.25f, fmt::format("LR LSD: {:.2f}", lsdData.BrakeLR));
-    UI::ShowText(0.65f, 0.025f, 0.25f, fmt::format("RR LSD: {:.2f}", lsdData.BrakeRR));
-    UI::ShowText(0.70f, 0.025f, 0.25f, fmt::format("{}L-R: {:.2f}", rddcol, lsdData.RDD));
-    UI::ShowText(0.60f, 0.050f, 0.25f, fmt::format(
+    const auto& lsdData = DrivingAssists::GetLSD();
+    for (uint8_t a = 0; a < lsdData.NumAxles; ++a) {
+        const auto& axle = lsdData.Axles[a];
+        std::string ddcol;
+        if (axle.SpeedDiff > 0.1f) { ddcol = "~r~"; }
+        if (axle.SpeedDiff < -0.1f) { ddcol = "~b~"; }
+
+        float y = 0.025f * static_cast<float>(a);
+        UI::ShowText(0.60f, y, 0.25f, fmt::format("L{} LSD: {:.2f}", a + 1, axle.BrakeLeft));
+        UI::ShowText(0.65f, y, 0.25f, fmt::format("R{} LSD: {:.2f}", a + 1, axle.BrakeRight));
+        UI::ShowText(0.70f, y, 0.25f, fmt::format("{}L-R: {:.2f}", ddcol, axle.SpeedDiff));
+    }
+    UI::ShowText(0.60f, 0.025f * static_cast<float>(lsdData.NumAxles), 0.25f, fmt::format(
         "{}LSD: {}", lsdData.Use ? "~g~" : "~r~", lsdData.Use ? "Active" : "Idle/Off"));
 }
 
@@ -1017,4 +1074,99 @@ void drawSteeringFfb() {
         { x + val * width * 0.25f, y },
         0.5f * width * val, height,
         fg.R, fg.G, fg.B, fg.A, 0);
-}
\ No newline at end of file
+}
+
+void drawProfilerInfo() {
+    const auto& stages = Profiler::GetStages();
+
+    UI::ShowText(0.60f, 0.200f, 0.3f, "Stage (us)");
+    UI::ShowText(0.78f, 0.200f, 0.3f, "Min");
+    UI::ShowText(0.82f, 0.200f, 0.3f, "Avg");
+    UI::ShowText(0.86f, 0.200f, 0.3f, "P99");
+    UI::ShowText(0.90f, 0.200f, 0.3f, "Max");
+
+    for (size_t i = 0; i < stages.size(); ++i) {
+        const auto stats = stages[i]->GetStats();
+        float y = 0.220f + 0.020f * static_cast<float>(i);
+        UI::ShowText(0.60f, y, 0.3f, stages[i]->Name());
+        UI::ShowText(0.78f, y, 0.3f, fmt::format("{:.0f}", stats.Min));
+        UI::ShowText(0.82f, y, 0.3f, fmt::format("{:.0f}", stats.Avg));
+        UI::ShowText(0.86f, y, 0.3f, fmt::format("{:.0f}", stats.P99));
+        UI::ShowText(0.90f, y, 0.3f, fmt::format("{:.0f}", stats.Max));
+    }
+
+    // Native calls requested vs. actually made by NativeCache, last tick
+    const auto& cacheStats = NativeCache::GetLastTickStats();
+    float y = 0.240f + 0.020f * static_cast<float>(stages.size());
+    UI::ShowText(0.60f, y, 0.3f, "Native (calls/tick)");
+    UI::ShowText(0.78f, y, 0.3f, "Req");
+    UI::ShowText(0.82f, y, 0.3f, "Made");
+    for (size_t i = 0; i < cacheStats.size(); ++i) {
+        y += 0.020f;
+        const auto& counters = cacheStats[i];
+        UI::ShowText(0.60f, y, 0.3f, NativeCache::GetNativeName(static_cast<NativeCache::ENative>(i)));
+        UI::ShowText(0.78f, y, 0.3f, fmt::format("{}", counters.Hits + counters.Misses));
+        UI::ShowText(0.82f, y, 0.3f, fmt::format("{}", counters.Misses));
+    }
+
+    // Vehicle memory view, last tick
+    const auto& memStats = VExt::GetLastTickStats();
+    y += 0.040f;
+    UI::ShowText(0.60f, y, 0.3f, "Vehicle memory (/tick)");
+    UI::ShowText(0.78f, y, 0.3f, "Req");
+    UI::ShowText(0.82f, y, 0.3f, "Made");
+    y += 0.020f;
+    UI::ShowText(0.60f, y, 0.3f, "Address lookups");
+    UI::ShowText(0.78f, y, 0.3f, fmt::format("{}", memStats.AddressRequests));
+    UI::ShowText(0.82f, y, 0.3f, fmt::format("{}", memStats.AddressResolves));
+    y += 0.020f;
+    UI::ShowText(0.60f, y, 0.3f, "Staged writes");
+    UI::ShowText(0.78f, y, 0.3f, fmt::format("{}", memStats.StagedWrites));
+    UI::ShowText(0.82f, y, 0.3f, fmt::format("{}", memStats.MemoryWrites));
+
+    // Tyre burst natives FFB would have made vs. made by WheelStatus, last tick
+    const auto& wheelStats = WheelStatus::GetLastTickStats();
+    y += 0.040f;
+    UI::ShowText(0.60f, y, 0.3f, "Wheel status (/tick)");
+    UI::ShowText(0.78f, y, 0.3f, "Req");
+    UI::ShowText(0.82f, y, 0.3f, "Made");
+    y += 0.020f;
+    UI::ShowText(0.60f, y, 0.3f, "Tyre burst natives");
+    UI::ShowText(0.78f, y, 0.3f, fmt::format("{}", wheelStats.NativesRequested));
+    UI::ShowText(0.82f, y, 0.3f, fmt::format("{}", wheelStats.NativesMade));
+    y += 0.020f;
+    UI::ShowText(0.60f, y, 0.3f, "Refreshes");
+    UI::ShowText(0.82f, y, 0.3f, fmt::format("{}", wheelStats.Refreshes));
+
+    // Derived per-tick values and how often they got computed last tick
+    y += 0.040f;
+    UI::ShowText(0.60f, y, 0.3f, "Derived (computes/tick)");
+    for (const auto* node : LazyGraph::GetNodes()) {
+        y += 0.020f;
+        UI::ShowText(0.60f, y, 0.3f, node->Name());
+        UI::ShowText(0.82f, y, 0.3f, fmt::format("{}", node->LastTickComputes()));
+    }
+
+    // Retained HUD text, last frame
+    const auto textStats = UI::GetLastTextStats();
+    y += 0.040f;
+    UI::ShowText(0.60f, y, 0.3f, "HUD text (/frame)");
+    UI::ShowText(0.78f, y, 0.3f, "Req");
+    UI::ShowText(0.82f, y, 0.3f, "Fmt");
+    y += 0.020f;
+    UI::ShowText(0.60f, y, 0.3f, "Cached strings");
+    UI::ShowText(0.78f, y, 0.3f, fmt::format("{}", textStats.Requests));
+    UI::ShowText(0.82f, y, 0.3f, fmt::format("{}", textStats.Formats));
+
+    // Fixed rate tasks and the steps they ran last tick
+    y += 0.040f;
+    UI::ShowText(0.60f, y, 0.3f, "Fixed rate");
+    UI::ShowText(0.78f, y, 0.3f, "Hz");
+    UI::ShowText(0.82f, y, 0.3f, "Steps");
+    for (const auto* task : Scheduler::GetTasks()) {
+        y += 0.020f;
+        UI::ShowText(0.60f, y, 0.3f, task->Name());
+        UI::ShowText(0.78f, y, 0.3f, fmt::format("{:.0f}", task->Rate()));
+        UI::ShowText(0.82f, y, 0.3f, fmt::format("{}", task->Steps()));
+    }
+}
@@ -21,6 +21,8 @@
 #include "Util/ScriptUtils.h"
 #include "Util/AddonSpawnerCache.h"
 #include "Util/Paths.h"
+#include "Util/Profiler.h"
+#include "Util/CachedText.h"
 
 #include "Memory/MemoryPatcher.hpp"
 #include "Memory/VehicleExtensions.hpp"
@@ -45,6 +47,7 @@
 #include <string>
 #include <mutex>
 #include <filesystem>
+#include <tuple>
 
 using VExt = VehicleExtensions;
 
@@ -129,11 +132,11 @@ namespace {
 
     std::vector<std::string> diDevicesInfo{ "Press Enter to refresh." };
 
-    std::string MenuSubtitleConfig() {
-        std::string cfgName = "Base";
-        if (g_settings.ConfigActive())
-            cfgName = g_settings().Name;
-        return fmt::format("CFG: [{}]", cfgName);
+    const std::string& MenuSubtitleConfig() {
+        static const std::string baseName = "Base";
+        static UI::CachedText<std::string> subtitle;
+        const std::string& cfgName = g_settings.ConfigActive() ? g_settings().Name : baseName;
+        return subtitle.Get(cfgName, [&] { return fmt::format("CFG: [{}]", cfgName); });
     }
 
     std::string FormatDeviceGuidName(GUID guid) {
@@ -185,7 +188,8 @@ void onMenuClose() {
 
 void update_mainmenu() {
     g_menu.Title("Manual Transmission");
-    g_menu.Subtitle(fmt::format("~b~{}{}", Constants::DisplayVersion, GIT_DIFF));
+    static const std::string versionSubtitle = fmt::format("~b~{}{}", Constants::DisplayVersion, GIT_DIFF);
+    g_menu.Subtitle(versionSubtitle);
 
     if (Paths::GetModPathChanged()) {
         g_menu.Option("Warning: Mod path moved!", NativeMenu::solidRed,
@@ -1023,8 +1027,13 @@ void update_forcefeedbackmenu() {
             "Gamma normally adjusts the curve.",
             "Boosted has a default initial ramp-up." });
 
+    static UI::CachedText<float> responseCurveText;
+    const std::string& responseCurveLabel = responseCurveText.Get(g_settings.Wheel.FFB.ResponseCurve, [] {
+        return fmt::format("FFB response curve: < {:.2f} >", g_settings.Wheel.FFB.ResponseCurve);
+    });
+
     bool showDynamicFfbCurveBox = false;
-    if (g_menu.OptionPlus(fmt::format("FFB response curve: < {:.2f} >", g_settings.Wheel.FFB.ResponseCurve), {}, &showDynamicFfbCurveBox,
+    if (g_menu.OptionPlus(responseCurveLabel, {}, &showDynamicFfbCurveBox,
             [=] { return incVal(g_settings.Wheel.FFB.ResponseCurve, 5.00f, 0.01f); },
             [=] { return decVal(g_settings.Wheel.FFB.ResponseCurve, 0.01f, 0.01f); },
             "Response curve", {
@@ -1057,6 +1066,17 @@ void update_forcefeedbackmenu() {
         { "Averages the detail force to prevent force feedback spikes.",
         "Recommended to keep as low as possible, as detail is lost with higher values."});
 
+    g_menu.FloatOption("Surface texture multiplier", g_settings.Wheel.FFB.TextureMult, 0.0f, 5.0f, 0.1f,
+        { "Vibration from rumble strips, gravel, cobbles and other rough surfaces.",
+          "This force stacks on top of the main SAT force." });
+
+    g_menu.IntOption("Surface texture limit", g_settings.Wheel.FFB.TextureLim, 0, 10000, 100,
+        { "Clamp surface texture force to this value." });
+
+    g_menu.BoolOption("Surface grip feel", g_settings.Wheel.FFB.SurfaceGripFeel,
+        { "Lowers the main SAT force on loose surfaces like grass, gravel, sand and mud.",
+          "Independent of the surface texture multiplier." });
+
     g_menu.FloatOption("Collision effect multiplier", g_settings.Wheel.FFB.CollisionMult, 0.0f, 10.0f, 0.1f,
         { "Force feedback effect caused by frontal/rear collisions." });
 
@@ -1111,8 +1131,9 @@ void update_forcefeedbackmenu() {
         }
     }
     else {
+        static UI::CachedText<std::string> lutText;
         g_menu.Option("FFB LUT active", {
-            fmt::format("Using LUT: {}", g_settings.Wheel.FFB.LUTFile),
+            lutText.Get(g_settings.Wheel.FFB.LUTFile, [] { return fmt::format("Using LUT: {}", g_settings.Wheel.FFB.LUTFile); }),
             "FFB anti-deadzone disabled."
         });
     }
@@ -1135,9 +1156,12 @@ void update_forcefeedbackmenu() {
               "> 1.0: Less FFB at low speeds, FFB increases towards speed cap.",
               "Keep at 1.0 for linear response. ~h~Not~h~ recommended to go higher than 1.0!" });
 
+        static UI::CachedText<float> maxSpeedText;
         g_menu.FloatOption("SAT max speed", g_settings.Wheel.FFB.MaxSpeed, 10.0f, 1000.0f, 1.0f,
             { "Speed where FFB stops increasing. Helpful against too strong FFB at extreme speeds.",
-              fmt::format("{} kph / {} mph", g_settings.Wheel.FFB.MaxSpeed * 3.6f, g_settings.Wheel.FFB.MaxSpeed * 2.23694f) });
+              maxSpeedText.Get(g_settings.Wheel.FFB.MaxSpeed, [] {
+                  return fmt::format("{} kph / {} mph", g_settings.Wheel.FFB.MaxSpeed * 3.6f, g_settings.Wheel.FFB.MaxSpeed * 2.23694f);
+              }) });
     }
 }
 
@@ -1344,6 +1368,7 @@ void update_speedodisplaymenu() {
     g_menu.StringArray("Speedometer", speedoTypes, newPos);
     if (newPos != oldPos) {
         g_settings.HUD.Speedo.Unit = speedoTypes.at(newPos);
+        g_settings.HUD.Speedo.UnitType = ParseSpeedoUnit(g_settings.HUD.Speedo.Unit);
     }
     g_menu.BoolOption("Use drivetrain speed", g_settings.HUD.Speedo.UseDrivetrain,
         { "Uses speed from the driven wheels or dashboard if selected, otherwise uses physics speed." });
@@ -1686,20 +1711,16 @@ void update_lsdsettingsmenu() {
             extra.push_back("LSD Disabled");
         }
         else {
-            auto lsdData = DrivingAssists::GetLSD();
-            std::string fddcol;
-            if (lsdData.FDD > 0.1f) { fddcol = "~r~"; }
-            if (lsdData.FDD < -0.1f) { fddcol = "~b~"; }
-
-            std::string rddcol;
-            if (lsdData.RDD > 0.1f) { rddcol = "~r~"; }
-            if (lsdData.RDD < -0.1f) { rddcol = "~b~"; }
-
-            extra.push_back(fmt::format("{}Front: L-R: {:.2f}", fddcol, lsdData.FDD));
-            extra.push_back(fmt::format("{}Rear:  L-R: {:.2f}", rddcol, lsdData.RDD));
-
-            extra.push_back(fmt::format("LF/RF [{:.2f}]/[{:.2f}]", lsdData.BrakeLF, lsdData.BrakeRF));
-            extra.push_back(fmt::format("LR/RR [{:.2f}]/[{:.2f}]", lsdData.BrakeLR, lsdData.BrakeRR));
+            const auto& lsdData = DrivingAssists::GetLSD();
+            for (uint8_t a = 0; a < lsdData.NumAxles; ++a) {
+                const auto& axle = lsdData.Axles[a];
+                std::string ddcol;
+                if (axle.SpeedDiff > 0.1f) { ddcol = "~r~"; }
+                if (axle.SpeedDiff < -0.1f) { ddcol = "~b~"; }
+
+                extra.push_back(fmt::format("{}Axle {}: L-R: {:.2f} | L/R [{:.2f}]/[{:.2f}]",
+                    ddcol, a + 1, axle.SpeedDiff, axle.BrakeLeft, axle.BrakeRight));
+            }
             extra.push_back(fmt::format("{}LSD: {}",
                 lsdData.Use ? "~g~" : "~r~",
                 lsdData.Use ? "Active" : "Idle/Off"));
@@ -1777,9 +1798,13 @@ void update_awdsettingsmenu() {
         "Bit 0: Enable torque transfer dial on y97y's BNR32",
         "Bit 1: Enable torque transfer dial on Wanted188's GT-R R32 (Remember to disable VehFuncs for torque dial)"
     };
-    std::string specialFlagsStr = fmt::format("{:08X}", g_settings().DriveAssists.AWD.SpecialFlags);
-    if (g_menu.Option(fmt::format("Special flags (hex): {}", specialFlagsStr), specialFlagsDescr)) {
-        std::string newFlags = GetKbEntryStr(specialFlagsStr);
+    static UI::CachedText<uint32_t> specialFlagsText;
+    const uint32_t specialFlags = g_settings().DriveAssists.AWD.SpecialFlags;
+    const std::string& specialFlagsLabel = specialFlagsText.Get(specialFlags, [=] {
+        return fmt::format("Special flags (hex): {:08X}", specialFlags);
+    });
+    if (g_menu.Option(specialFlagsLabel, specialFlagsDescr)) {
+        std::string newFlags = GetKbEntryStr(fmt::format("{:08X}", specialFlags));
         SetFlags(g_settings().DriveAssists.AWD.SpecialFlags, newFlags);
     }
 }
@@ -1800,7 +1825,9 @@ void update_cruisecontrolsettingsmenu() {
     std::string speedNameUnit = GetSpeedUnitMultiplier(g_settings.HUD.Speedo.Unit, speedValMul);
     float speedValUnit = speedValRaw * speedValMul;
 
-    if (g_menu.FloatOptionCb(fmt::format("Speed ({})", speedNameUnit), speedValUnit, 0.0f, 500.0f, 5.0f,
+    static UI::CachedText<std::string> speedText;
+    const std::string& speedLabel = speedText.Get(speedNameUnit, [&] { return fmt::format("Speed ({})", speedNameUnit); });
+    if (g_menu.FloatOptionCb(speedLabel, speedValUnit, 0.0f, 500.0f, 5.0f,
         GetKbEntryFloat,
         { "Speed for cruise control. Speeds higher than vehicle top speed are ignored.",
           "Can also be changed with hotkeys or wheel buttons." })) {
@@ -1845,6 +1872,12 @@ void update_cruisecontrolsettingsmenu() {
           "Higher: Brake harder for a smaller speed difference.",
           "Keep lower than the above option.",
           "Default: 1.2." });
+
+    g_menu.IntOption("Rays per frame", g_settings().DriveAssists.CruiseControl.RaysPerFrame, 1, 9, 1,
+        { "How many of the 9 detection rays are cast each frame.",
+          "Rays are spread over frames and the car in front is tracked in between.",
+          "Higher: Reacts sooner, costs more.",
+          "Default: 3." });
 }
 
 void update_speedlimitersettingsmenu() {
@@ -1856,7 +1889,9 @@ void update_speedlimitersettingsmenu() {
     std::string speedNameUnit = GetSpeedUnitMultiplier(g_settings.HUD.Speedo.Unit, speedValMul);
     float speedValUnit = speedValRaw * speedValMul;
 
-    if (g_menu.FloatOptionCb(fmt::format("Max speed ({})", speedNameUnit), speedValUnit, 0.0f, 500.0f, 5.0f,
+    static UI::CachedText<std::string> maxSpeedText;
+    const std::string& maxSpeedLabel = maxSpeedText.Get(speedNameUnit, [&] { return fmt::format("Max speed ({})", speedNameUnit); });
+    if (g_menu.FloatOptionCb(maxSpeedLabel, speedValUnit, 0.0f, 500.0f, 5.0f,
         GetKbEntryFloat,
         { "Electronically limit speed to this." })) {
 
@@ -1977,13 +2012,26 @@ void update_miscoptionsmenu() {
     g_menu.BoolOption("Enable dashboard extensions", g_settings.Misc.DashExtensions,
         { "If DashHook is installed, the script controls some dashboard lights such as the ABS light." });
 
+    static UI::CachedText<std::tuple<std::string, int>> endpointText;
     if (g_menu.BoolOption("Enable UDP telemetry", g_settings.Misc.UDPTelemetry,
         { "Allows programs like SimHub to use data from this script.",
             "This script uses the DIRT 4 format for telemetry data.",
-            fmt::format("Endpoint: {}:{}", g_settings.Misc.UDPAddress, g_settings.Misc.UDPPort),
+            endpointText.Get(std::tie(g_settings.Misc.UDPAddress, g_settings.Misc.UDPPort), [] {
+                return fmt::format("Endpoint: {}:{}", g_settings.Misc.UDPAddress, g_settings.Misc.UDPPort);
+            }),
             "Restart the game if the endpoints are changed." })) {
         StartUDPTelemetry();
     }
+
+    g_menu.BoolOption("Record telemetry", g_settings.Misc.TelemetryArchive,
+        { "Records the same data as UDP telemetry and more to a compressed file, "
+            "in the Telemetry folder of the mod folder. A new file starts every time this is enabled.",
+            "TelemetryTool converts the files to CSV." });
+
+    g_menu.BoolOption("Shared memory telemetry", g_settings.Misc.SharedTelemetry,
+        { "Publishes the same data as UDP telemetry and more in shared memory, "
+            "for dashboards and motion software on this PC that support it.",
+            "Cheaper than UDP: no network calls, and any number of programs can read it." });
 }
 
 void update_devoptionsmenu() {
@@ -2019,12 +2067,12 @@ void update_devoptionsmenu() {
         g_settings.Update.EnableUpdate = true;
         g_settings.Update.IgnoredVersion = "v0.0.0";
 
-        threadCheckUpdate(0);
+        scheduleUpdateCheck(0);
     }
 
     g_menu.Option("Mod path",
         { "This script currently uses the following folder to store data:",
-          fmt::format("{}", Paths::GetModPath()) });
+          Paths::GetModPath() });
 }
 
 void update_debugmenu() {
@@ -2155,7 +2203,9 @@ void update_metricsmenu() {
             "Timer0Unit = kph",
             "Timer0LimA = 0.0",
             "Timer0LimB = 120.0",
-            "Timer0Tolerance = 0.1"})) {
+            "Timer0Tolerance = 0.1",
+            "Units m and ft time a distance from standstill.",
+            "Results are saved to SpeedTimers.csv."})) {
         saveAllSettings();
         g_settings.Read(&g_controls);
         initTimers();
@@ -2170,6 +2220,33 @@ void update_metricsmenu() {
                 timerParams.Tolerance));
         }
     }
+
+    g_menu.FloatOption("Wheel status rate", g_settings.Misc.WheelStatusRate, 1.0f, 60.0f, 1.0f,
+        { "How often tyre burst state and grip get refreshed, in Hz.",
+          "Wheel damage and surface changes always refresh right away." });
+
+    if (g_menu.BoolOption("Enable profiler", g_settings.Debug.Metrics.Profiler.Enable,
+        { "Time each part of the script every tick.",
+          "Stats are kept over the last 256 ticks." })) {
+        Profiler::SetEnabled(g_settings.Debug.Metrics.Profiler.Enable);
+    }
+
+    if (g_settings.Debug.Metrics.Profiler.Enable) {
+        g_menu.BoolOption("Display profiler", g_settings.Debug.Metrics.Profiler.Display,
+            { "Show min/avg/p99/max time per script stage, in microseconds." });
+
+        if (g_menu.Option("Export profiler results",
+            { "Write the current profiler stats to Profiler.csv in the mod folder." })) {
+            const std::string csvFile = Paths::GetModPath() + "\\Profiler.csv";
+            if (Profiler::DumpCSV(csvFile)) {
+                UI::Notify(INFO, fmt::format("Profiler results saved to {}", csvFile));
+            }
+            else {
+                UI::Notify(WARN, "Failed to save profiler results. Check Gears.log for more details.");
+                logger.Write(ERROR, "[Profiler] Failed to write [%s]", csvFile.c_str());
+            }
+        }
+    }
 }
 
 void update_compatmenu() {
@@ -2195,140 +2272,78 @@ void update_compatmenu() {
             "Useful when another script hides the player." });
 }
 
-void update_menu() {
-    g_menu.CheckKeys();
-
-    /* mainmenu */
-    if (g_menu.CurrentMenu("mainmenu")) { update_mainmenu(); }
-
-    /* mainmenu -> settingsmenu */
-    if (g_menu.CurrentMenu("settingsmenu")) { update_settingsmenu(); }
-
-    /* mainmenu -> settingsmenu -> featuresmenu */
-    if (g_menu.CurrentMenu("featuresmenu")) { update_featuresmenu(); }
-
-    /* mainmenu -> settingsmenu -> featuresmenu -> speedlimitersettingsmenu */
-    if (g_menu.CurrentMenu("speedlimitersettingsmenu")) { update_speedlimitersettingsmenu(); }
-
-    /* mainmenu -> settingsmenu -> finetuneoptionsmenu */
-    if (g_menu.CurrentMenu("finetuneoptionsmenu")) { update_finetuneoptionsmenu(); }
-
-    /* mainmenu -> settingsmenu -> shiftingoptionsmenu */
-    if (g_menu.CurrentMenu("shiftingoptionsmenu")) { update_shiftingoptionsmenu(); }
-
-    /* mainmenu -> settingsmenu -> finetuneautooptionsmenu */
-    if (g_menu.CurrentMenu("finetuneautooptionsmenu")) { update_finetuneautooptionsmenu(); }
-
-    /* mainmenu -> vehconfigmenu */
-    if (g_menu.CurrentMenu("vehconfigmenu")) { update_vehconfigmenu(); }
-
-    /* mainmenu -> controlsmenu */
-    if (g_menu.CurrentMenu("controlsmenu")) { update_controlsmenu(); }
-
-    /* mainmenu -> controlsmenu -> controllermenu */
-    if (g_menu.CurrentMenu("controllermenu")) { update_controllermenu(); }
-
-    /* mainmenu -> controlsmenu -> controllermenu -> controllerbindingsnativemenu */
-    if (g_menu.CurrentMenu("controllerbindingsnativemenu")) { update_controllerbindingsnativemenu(); }
-
-    /* mainmenu -> controlsmenu -> controllermenu -> controllerbindingsxinputmenu */
-    if (g_menu.CurrentMenu("controllerbindingsxinputmenu")) { update_controllerbindingsxinputmenu(); }
-
-    /* mainmenu -> controlsmenu -> keyboardmenu */
-    if (g_menu.CurrentMenu("keyboardmenu")) { update_keyboardmenu(); }
-
-    /* mainmenu -> controlsmenu -> steeringassistmenu */
-    if (g_menu.CurrentMenu("steeringassistmenu")) { update_steeringassistmenu(); }
-
-    /* mainmenu -> controlsmenu -> steeringassistmenu -> mousesteeringoptionsmenu */
-    if (g_menu.CurrentMenu("mousesteeringoptionsmenu")) { update_mousesteeringoptionsmenu(); }
-
-    /* mainmenu -> controlsmenu -> wheelmenu */
-    if (g_menu.CurrentMenu("wheelmenu")) { update_wheelmenu(); }
-
-    /* mainmenu -> controlsmenu -> wheelmenu -> anglemenu */
-    if (g_menu.CurrentMenu("anglemenu")) { update_anglemenu(); }
-
-    /* mainmenu -> controlsmenu -> wheelmenu -> axesmenu */
-    if (g_menu.CurrentMenu("axesmenu")) { update_axesmenu(); }
-
-    /* mainmenu -> controlsmenu -> wheelmenu -> forcefeedbackmenu */
-    if (g_menu.CurrentMenu("forcefeedbackmenu")) { update_forcefeedbackmenu(); }
-
-    /* mainmenu -> controlsmenu -> wheelmenu -> forcefeedbackmenu */
-    if (g_menu.CurrentMenu("ffbnormalizationmenu")) { update_ffbnormalizationmenu(); }
-
-    /* mainmenu -> controlsmenu -> wheelmenu -> buttonsmenu */
-    if (g_menu.CurrentMenu("buttonsmenu")) { update_buttonsmenu(); }
-
-    /* mainmenu -> controlsmenu -> update_controlsvehconfmenu */
-    if (g_menu.CurrentMenu("controlsvehconfmenu")) { update_controlsvehconfmenu(); }
-
-    /* mainmenu -> hudmenu */
-    if (g_menu.CurrentMenu("hudmenu")) { update_hudmenu(); }
-
-    /* mainmenu -> hudmenu -> geardisplaymenu*/
-    if (g_menu.CurrentMenu("geardisplaymenu")) { update_geardisplaymenu(); }
-
-    /* mainmenu -> hudmenu -> speedodisplaymenu*/
-    if (g_menu.CurrentMenu("speedodisplaymenu")) { update_speedodisplaymenu(); }
-
-    /* mainmenu -> hudmenu -> rpmdisplaymenu*/
-    if (g_menu.CurrentMenu("rpmdisplaymenu")) { update_rpmdisplaymenu(); }
-
-    /* mainmenu -> hudmenu -> wheelinfomenu*/
-    if (g_menu.CurrentMenu("wheelinfomenu")) { update_wheelinfomenu(); }
-
-    /* mainmenu -> hudmenu -> dashindicatormenu*/
-    if (g_menu.CurrentMenu("dashindicatormenu")) { update_dashindicatormenu(); }
-
-    /* mainmenu -> hudmenu -> dsprotmenu*/
-    if (g_menu.CurrentMenu("dsprotmenu")) { update_dsprotmenu(); }
-
-    /* mainmenu -> hudmenu -> mousehudmenu*/
-    if (g_menu.CurrentMenu("mousehudmenu")) { update_mousehudmenu(); }
-
-    /* mainmenu -> driveassistmenu */
-    if (g_menu.CurrentMenu("driveassistmenu")) { update_driveassistmenu(); }
-
-    /* mainmenu -> driveassistmenu -> abssettingsmenu */
-    if (g_menu.CurrentMenu("abssettingsmenu")) { update_abssettingsmenu(); }
-
-    /* mainmenu -> driveassistmenu -> tcssettingsmenu */
-    if (g_menu.CurrentMenu("tcssettingsmenu")) { update_tcssettingsmenu(); }
-
-    /* mainmenu -> driveassistmenu -> espsettingsmenu */
-    if (g_menu.CurrentMenu("espsettingsmenu")) { update_espsettingsmenu(); }
-
-    /* mainmenu -> driveassistmenu -> lcssettings */
-    if (g_menu.CurrentMenu("lcssettings")) { update_lcssettingsmenu(); }
-
-    /* mainmenu -> driveassistmenu -> lsdsettingsmenu */
-    if (g_menu.CurrentMenu("lsdsettingsmenu")) { update_lsdsettingsmenu(); }
-
-    /* mainmenu -> driveassistmenu -> awdsettingsmenu */
-    if (g_menu.CurrentMenu("awdsettingsmenu")) { update_awdsettingsmenu(); }
-
-    /* mainmenu -> driveassistmenu -> cruisecontrolsettingsmenu */
-    if (g_menu.CurrentMenu("cruisecontrolsettingsmenu")) { update_cruisecontrolsettingsmenu(); }
-
-    /* mainmenu -> gameassistmenu */
-    if (g_menu.CurrentMenu("gameassistmenu")) { update_gameassistmenu(); }
-
-    /* mainmenu -> miscoptionsmenu */
-    if (g_menu.CurrentMenu("miscoptionsmenu")) { update_miscoptionsmenu(); }
+namespace {
+    struct SMenuEntry {
+        std::string Name;
+        void (*Update)();
+    };
 
-    /* mainmenu -> devoptionsmenu */
-    if (g_menu.CurrentMenu("devoptionsmenu")) { update_devoptionsmenu(); }
+    // Registered once. Lookup starts at the menu that matched last, so while
+    // a menu stays open this costs a single name comparison per tick.
+    const std::vector<SMenuEntry> menuEntries {
+        { "mainmenu", update_mainmenu },
+        { "settingsmenu", update_settingsmenu },
+        { "featuresmenu", update_featuresmenu },
+        { "speedlimitersettingsmenu", update_speedlimitersettingsmenu },
+        { "finetuneoptionsmenu", update_finetuneoptionsmenu },
+        { "shiftingoptionsmenu", update_shiftingoptionsmenu },
+        { "finetuneautooptionsmenu", update_finetuneautooptionsmenu },
+        { "vehconfigmenu", update_vehconfigmenu },
+        { "controlsmenu", update_controlsmenu },
+        { "controllermenu", update_controllermenu },
+        { "controllerbindingsnativemenu", update_controllerbindingsnativemenu },
+        { "controllerbindingsxinputmenu", update_controllerbindingsxinputmenu },
+        { "keyboardmenu", update_keyboardmenu },
+        { "steeringassistmenu", update_steeringassistmenu },
+        { "mousesteeringoptionsmenu", update_mousesteeringoptionsmenu },
+        { "wheelmenu", update_wheelmenu },
+        { "anglemenu", update_anglemenu },
+        { "axesmenu", update_axesmenu },
+        { "forcefeedbackmenu", update_forcefeedbackmenu },
+        { "ffbnormalizationmenu", update_ffbnormalizationmenu },
+        { "buttonsmenu", update_buttonsmenu },
+        { "controlsvehconfmenu", update_controlsvehconfmenu },
+        { "hudmenu", update_hudmenu },
+        { "geardisplaymenu", update_geardisplaymenu },
+        { "speedodisplaymenu", update_speedodisplaymenu },
+        { "rpmdisplaymenu", update_rpmdisplaymenu },
+        { "wheelinfomenu", update_wheelinfomenu },
+        { "dashindicatormenu", update_dashindicatormenu },
+        { "dsprotmenu", update_dsprotmenu },
+        { "mousehudmenu", update_mousehudmenu },
+        { "driveassistmenu", update_driveassistmenu },
+        { "abssettingsmenu", update_abssettingsmenu },
+        { "tcssettingsmenu", update_tcssettingsmenu },
+        { "espsettingsmenu", update_espsettingsmenu },
+        { "lcssettings", update_lcssettingsmenu },
+        { "lsdsettingsmenu", update_lsdsettingsmenu },
+        { "awdsettingsmenu", update_awdsettingsmenu },
+        { "cruisecontrolsettingsmenu", update_cruisecontrolsettingsmenu },
+        { "gameassistmenu", update_gameassistmenu },
+        { "miscoptionsmenu", update_miscoptionsmenu },
+        { "devoptionsmenu", update_devoptionsmenu },
+        { "debugmenu", update_debugmenu },
+        { "metricsmenu", update_metricsmenu },
+        { "compatmenu", update_compatmenu },
+    };
 
-    /* mainmenu -> devoptionsmenu -> debugmenu */
-    if (g_menu.CurrentMenu("debugmenu")) { update_debugmenu(); }
+    size_t lastMenuEntry = 0;
+}
 
-    /* mainmenu -> devoptionsmenu -> metricsmenu */
-    if (g_menu.CurrentMenu("metricsmenu")) { update_metricsmenu(); }
+void update_menu() {
+    g_menu.CheckKeys();
 
-    /* mainmenu -> devoptionsmenu -> compatmenu */
-    if (g_menu.CurrentMenu("compatmenu")) { update_compatmenu(); }
+    if (g_menu.IsThisOpen()) {
+        const size_t count = menuEntries.size();
+        for (size_t i = 0; i < count; ++i) {
+            size_t index = (lastMenuEntry + i) % count;
+            if (g_menu.CurrentMenu(menuEntries[index].Name)) {
+                lastMenuEntry = index;
+                menuEntries[index].Update();
+                break;
+            }
+        }
+    }
 
     g_menu.EndMenu();
 }
@@ -25,13 +25,7 @@ extern ScriptSettings g_settings;
 
 namespace {
     std::string getASCachedModelName(Hash model) {
-        const std::unordered_map<Hash, std::string>& cache = ASCache::Get();
-        if (!cache.empty()) {
-            auto bla = cache.find(model);
-            if (bla != cache.end())
-                return bla->second;
-        }
-        return {};
+        return std::string(ASCache::Find(model));
     }
 }
 
@@ -14,6 +14,7 @@
 #include "Util/MathExt.h"
 #include "Util/UIUtils.h"
 #include "Util/ScriptUtils.h"
+#include "Util/Scheduler.h"
 
 #include <inc/natives.h>
 #include <fmt/format.h>
@@ -28,6 +29,11 @@ extern Ped g_playerPed;
 extern Vehicle g_playerVehicle;
 
 std::vector<Vehicle> g_ignoredVehicles;
+
+// Gear choice and the vehicle list refresh at this rate.
+// Shift progress, gear locks and brakes still update every frame.
+Scheduler::Task g_npcTask("NPC", 10.0f);
+
 std::vector<NPCVehicle> g_npcVehicles;
 
 class NPCVehicle {
@@ -202,7 +208,7 @@ void updateShifting(Vehicle npcVehicle, VehicleGearboxStates& gearStates) {
 void updateNPCVehicle(NPCVehicle& _npcVehicle) {
     Vehicle npcVehicle = _npcVehicle.GetVehicle();
 
-    if (!g_settings.Debug.DisableNPCGearbox) {
+    if (!g_settings.Debug.DisableNPCGearbox && g_npcTask.Steps() > 0) {
         auto& gearStates = _npcVehicle.GetGearbox();
 
         if (npcVehicle == 0 ||
@@ -242,7 +248,7 @@ void updateNPCVehicle(NPCVehicle& _npcVehicle) {
         if (throttle >= gearStates.ThrottleHang)
             gearStates.ThrottleHang = throttle;
         else if (gearStates.ThrottleHang > 0.0f)
-            gearStates.ThrottleHang -= MISC::GET_FRAME_TIME() * g_settings.BaseConfig()->AutoParams.EcoRate;
+            gearStates.ThrottleHang -= g_npcTask.Elapsed() * g_settings.BaseConfig()->AutoParams.EcoRate;
 
         if (gearStates.ThrottleHang < 0.0f)
             gearStates.ThrottleHang = 0.0f;
@@ -383,12 +389,15 @@ void update_npc() {
     if (!g_settings.Debug.DisplayNPCInfo && !mtActive) 
         return;
 
-    const int ARR_SIZE = 1024;
-    std::vector<Vehicle> vehicles(ARR_SIZE);
-    int count = worldGetAllVehicles(vehicles.data(), ARR_SIZE);
-    vehicles.resize(count);
+    static int count = 0;
+    if (g_npcTask.Advance(MISC::GET_FRAME_TIME()) > 0) {
+        const int ARR_SIZE = 1024;
+        std::vector<Vehicle> vehicles(ARR_SIZE);
+        count = worldGetAllVehicles(vehicles.data(), ARR_SIZE);
+        vehicles.resize(count);
 
-    updateNPCVehicleList(vehicles, g_npcVehicles);
+        updateNPCVehicleList(vehicles, g_npcVehicles);
+    }
 
     if (g_settings.Debug.DisplayNPCInfo) {
         UI::ShowText(0.9, 0.5, 0.4, "NPC Vehs: " + std::to_string(count));
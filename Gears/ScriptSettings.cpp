@@ -5,6 +5,7 @@
 #include "VehicleConfig.h"
 
 #include "SettingsCommon.h"
+#include "ScriptSettingsSchema.h"
 #include "Util/GUID.h"
 #include "Util/Logger.hpp"
 #include "Util/Strings.hpp"
@@ -14,6 +15,7 @@
 #include <simpleini/SimpleIni.h>
 #include <fmt/format.h>
 
+#include <memory>
 #include <string>
 
 // TODO: Settings shouldn't *do* anything, other stuff just needs to take stuff from this.
@@ -57,9 +59,29 @@ namespace {
         }
         return nameFmt;
     }
+
+    template <typename TSchema>
+    void logNonDefault(const TSchema& schema, const ScriptSettings& settings, const char* file) {
+        const auto defaults = std::make_unique<ScriptSettings>();
+        size_t numChanged = SettingsSchema::Diff(schema, settings, *defaults,
+            [&](const char* section, const char* key, const std::string& value, const std::string& defaultValue) {
+                logger.Write(DEBUG, "[Settings] [%s] %s/%s = %s (default %s)",
+                    file, section, key, value.c_str(), defaultValue.c_str());
+            });
+        logger.Write(DEBUG, "[Settings] [%s] %d of %d settings changed from default",
+            file, static_cast<int>(numChanged), static_cast<int>(SettingsSchema::Size(schema)));
+    }
 }
 
-ScriptSettings::ScriptSettings() = default;
+ESpeedoUnit ParseSpeedoUnit(const std::string& unit) {
+    if (unit == "kph")
+        return ESpeedoUnit::Kph;
+    if (unit == "mph")
+        return ESpeedoUnit::Mph;
+    if (unit == "ms")
+        return ESpeedoUnit::Ms;
+    return ESpeedoUnit::Off;
+}
 
 void ScriptSettings::SetVehicleConfig(VehicleConfig* cfg) {
     activeConfig = cfg;
@@ -96,10 +118,20 @@ void ScriptSettings::SetFiles(const std::string &general, const std::string& con
 }
 
 void ScriptSettings::Read(CarControls* scriptControl) {
-    parseSettingsGeneral();
+    // The base vehicle config lives in the general settings file, so both share one parse.
+    CSimpleIniA generalIni;
+    generalIni.SetUnicode();
+    SI_Error result = generalIni.LoadFile(settingsGeneralFile.c_str());
+    CHECK_LOG_SI_ERROR(result, "load");
+
+    parseSettingsGeneral(generalIni);
     parseSettingsControls(scriptControl);
     parseSettingsWheel(scriptControl);
-    baseConfig.LoadSettings();
+    baseConfig.LoadSettings(generalIni);
+
+    logNonDefault(ScriptSettingsSchema::General, *this, "General");
+    logNonDefault(ScriptSettingsSchema::Controls, *this, "Controls");
+    logNonDefault(ScriptSettingsSchema::Wheel, *this, "Wheel");
 }
 
 void ScriptSettings::SaveGeneral() {
@@ -108,233 +140,17 @@ void ScriptSettings::SaveGeneral() {
     SI_Error result = ini.LoadFile(settingsGeneralFile.c_str());
     CHECK_LOG_SI_ERROR(result, "load");
 
-    // [MT_OPTIONS]
-    SAVE_VAL("MT_OPTIONS", "Enable", MTOptions.Enable);
-
-    SAVE_VAL("MT_OPTIONS", "EngineDamage", MTOptions.EngDamage);
-    SAVE_VAL("MT_OPTIONS", "EngineStalling", MTOptions.EngStallH);
-    SAVE_VAL("MT_OPTIONS", "EngineStallingS", MTOptions.EngStallS);
-    SAVE_VAL("MT_OPTIONS", "EngineBraking", MTOptions.EngBrake);
-    SAVE_VAL("MT_OPTIONS", "EngineLocking", MTOptions.EngLock);
-    SAVE_VAL("MT_OPTIONS", "FinalGearRPMLimit", MTOptions.FinalGearRPMLimit);
-
-    // [GAMEPLAY_ASSISTS]
-    SAVE_VAL("GAMEPLAY_ASSISTS", "SimpleBike", GameAssists.SimpleBike);
-    SAVE_VAL("GAMEPLAY_ASSISTS", "HillBrakeWorkaround", GameAssists.HillGravity);
-    SAVE_VAL("GAMEPLAY_ASSISTS", "AutoGear1", GameAssists.AutoGear1);
-    SAVE_VAL("GAMEPLAY_ASSISTS", "AutoLookBack", GameAssists.AutoLookBack);
-    SAVE_VAL("GAMEPLAY_ASSISTS", "ThrottleStart", GameAssists.ThrottleStart);
-    SAVE_VAL("GAMEPLAY_ASSISTS", "DefaultNeutral", GameAssists.DefaultNeutral);
-    SAVE_VAL("GAMEPLAY_ASSISTS", "DisableAutostart", GameAssists.DisableAutostart);
-    SAVE_VAL("GAMEPLAY_ASSISTS", "LeaveEngineRunning", GameAssists.LeaveEngineRunning);
-
-    //[CUSTOM_STEERING]
-    SAVE_VAL("CUSTOM_STEERING", "Mode", CustomSteering.Mode);
-    SAVE_VAL("CUSTOM_STEERING", "CountersteerMult", CustomSteering.CountersteerMult);
-    SAVE_VAL("CUSTOM_STEERING", "CountersteerLimit", CustomSteering.CountersteerLimit);
-    SAVE_VAL("CUSTOM_STEERING", "NoReductionHandbrake", CustomSteering.NoReductionHandbrake);
-    SAVE_VAL("CUSTOM_STEERING", "Gamma", CustomSteering.Gamma);
-    SAVE_VAL("CUSTOM_STEERING", "SteerTime", CustomSteering.SteerTime);
-    SAVE_VAL("CUSTOM_STEERING", "CenterTime", CustomSteering.CenterTime);
-
-    SAVE_VAL("CUSTOM_STEERING", "MouseSteering", CustomSteering.Mouse.Enable);
-    SAVE_VAL("CUSTOM_STEERING", "MouseSensitivity", CustomSteering.Mouse.Sensitivity);
-    SAVE_VAL("CUSTOM_STEERING", "MouseDisableSteerAssist", CustomSteering.Mouse.DisableSteerAssist);
-    SAVE_VAL("CUSTOM_STEERING", "MouseDisableReduction", CustomSteering.Mouse.DisableReduction);
+    SettingsSchema::Save(ini, ScriptSettingsSchema::General, *this);
 
     // [HUD]
-    SAVE_VAL("HUD", "EnableHUD", HUD.Enable);
-    SAVE_VAL("HUD", "AlwaysHUD", HUD.Always);
-    SAVE_VAL("HUD", "HUDFont", HUD.Font);
-    SAVE_VAL("HUD", "Outline", HUD.Outline);
-    SAVE_VAL("HUD", "NotifyLevel", HUD.NotifyLevel);
-
-    SAVE_VAL("HUD", "GearIndicator", HUD.Gear.Enable);
-    SAVE_VAL("HUD", "GearXpos", HUD.Gear.XPos);
-    SAVE_VAL("HUD", "GearYpos", HUD.Gear.YPos);
-    SAVE_VAL("HUD", "GearSize", HUD.Gear.Size);
-    SAVE_VAL("HUD", "GearTopColorR", HUD.Gear.TopColorR);
-    SAVE_VAL("HUD", "GearTopColorG", HUD.Gear.TopColorG);
-    SAVE_VAL("HUD", "GearTopColorB", HUD.Gear.TopColorB);
-    SAVE_VAL("HUD", "GearColorR", HUD.Gear.ColorR);
-    SAVE_VAL("HUD", "GearColorG", HUD.Gear.ColorG);
-    SAVE_VAL("HUD", "GearColorB", HUD.Gear.ColorB);
-
-    SAVE_VAL("HUD", "ShiftModeIndicator", HUD.ShiftMode.Enable);
-    SAVE_VAL("HUD", "ShiftModeXpos", HUD.ShiftMode.XPos);
-    SAVE_VAL("HUD", "ShiftModeYpos", HUD.ShiftMode.YPos);
-    SAVE_VAL("HUD", "ShiftModeSize", HUD.ShiftMode.Size);
-    SAVE_VAL("HUD", "ShiftModeColorR", HUD.ShiftMode.ColorR);
-    SAVE_VAL("HUD", "ShiftModeColorG", HUD.ShiftMode.ColorG);
-    SAVE_VAL("HUD", "ShiftModeColorB", HUD.ShiftMode.ColorB);
-
     SAVE_VAL("HUD", "SpeedoUnit", HUD.Speedo.Unit);
-    SAVE_VAL("HUD", "SpeedoShowUnit", HUD.Speedo.ShowUnit);
-    SAVE_VAL("HUD", "SpeedoUseDrivetrain", HUD.Speedo.UseDrivetrain);
-    SAVE_VAL("HUD", "SpeedoXpos", HUD.Speedo.XPos);
-    SAVE_VAL("HUD", "SpeedoYpos", HUD.Speedo.YPos);
-    SAVE_VAL("HUD", "SpeedoSize", HUD.Speedo.Size);
-    SAVE_VAL("HUD", "SpeedoColorR", HUD.Speedo.ColorR);
-    SAVE_VAL("HUD", "SpeedoColorG", HUD.Speedo.ColorG);
-    SAVE_VAL("HUD", "SpeedoColorB", HUD.Speedo.ColorB);
-
-    SAVE_VAL("HUD", "EnableRPMIndicator", HUD.RPMBar.Enable);
-    SAVE_VAL("HUD", "RPMIndicatorXpos", HUD.RPMBar.XPos);
-    SAVE_VAL("HUD", "RPMIndicatorYpos", HUD.RPMBar.YPos);
-    SAVE_VAL("HUD", "RPMIndicatorWidth", HUD.RPMBar.XSz);
-    SAVE_VAL("HUD", "RPMIndicatorHeight", HUD.RPMBar.YSz);
-    SAVE_VAL("HUD", "RPMIndicatorRedline", HUD.RPMBar.Redline);
-
-    SAVE_VAL("HUD", "RPMIndicatorBackgroundR", HUD.RPMBar.BgR);
-    SAVE_VAL("HUD", "RPMIndicatorBackgroundG", HUD.RPMBar.BgG);
-    SAVE_VAL("HUD", "RPMIndicatorBackgroundB", HUD.RPMBar.BgB);
-    SAVE_VAL("HUD", "RPMIndicatorBackgroundA", HUD.RPMBar.BgA);
-
-    SAVE_VAL("HUD", "RPMIndicatorForegroundR", HUD.RPMBar.FgR);
-    SAVE_VAL("HUD", "RPMIndicatorForegroundG", HUD.RPMBar.FgG);
-    SAVE_VAL("HUD", "RPMIndicatorForegroundB", HUD.RPMBar.FgB);
-    SAVE_VAL("HUD", "RPMIndicatorForegroundA", HUD.RPMBar.FgA);
-
-    SAVE_VAL("HUD", "RPMIndicatorRedlineR", HUD.RPMBar.RedlineR);
-    SAVE_VAL("HUD", "RPMIndicatorRedlineG", HUD.RPMBar.RedlineG);
-    SAVE_VAL("HUD", "RPMIndicatorRedlineB", HUD.RPMBar.RedlineB);
-    SAVE_VAL("HUD", "RPMIndicatorRedlineA", HUD.RPMBar.RedlineA);
-
-    SAVE_VAL("HUD", "RPMIndicatorRevlimitR", HUD.RPMBar.RevLimitR);
-    SAVE_VAL("HUD", "RPMIndicatorRevlimitG", HUD.RPMBar.RevLimitG);
-    SAVE_VAL("HUD", "RPMIndicatorRevlimitB", HUD.RPMBar.RevLimitB);
-    SAVE_VAL("HUD", "RPMIndicatorRevlimitA", HUD.RPMBar.RevLimitA);
-
-    SAVE_VAL("HUD", "RPMIndicatorLaunchStagedR", HUD.RPMBar.LaunchControlStagedR);
-    SAVE_VAL("HUD", "RPMIndicatorLaunchStagedG", HUD.RPMBar.LaunchControlStagedG);
-    SAVE_VAL("HUD", "RPMIndicatorLaunchStagedB", HUD.RPMBar.LaunchControlStagedB);
-    SAVE_VAL("HUD", "RPMIndicatorLaunchStagedA", HUD.RPMBar.LaunchControlStagedA);
-
-    SAVE_VAL("HUD", "RPMIndicatorLaunchActiveR", HUD.RPMBar.LaunchControlActiveR);
-    SAVE_VAL("HUD", "RPMIndicatorLaunchActiveG", HUD.RPMBar.LaunchControlActiveG);
-    SAVE_VAL("HUD", "RPMIndicatorLaunchActiveB", HUD.RPMBar.LaunchControlActiveB);
-    SAVE_VAL("HUD", "RPMIndicatorLaunchActiveA", HUD.RPMBar.LaunchControlActiveA);
-
-    SAVE_VAL("HUD", "SteeringWheelInfo", HUD.Wheel.Enable);
-    SAVE_VAL("HUD", "AlwaysSteeringWheelInfo", HUD.Wheel.Always);
-    SAVE_VAL("HUD", "SteeringWheelTextureX", HUD.Wheel.ImgXPos);
-    SAVE_VAL("HUD", "SteeringWheelTextureY", HUD.Wheel.ImgYPos);
-    SAVE_VAL("HUD", "SteeringWheelTextureSz", HUD.Wheel.ImgSize);
-    SAVE_VAL("HUD", "PedalInfoX", HUD.Wheel.PedalXPos);
-    SAVE_VAL("HUD", "PedalInfoY", HUD.Wheel.PedalYPos);
-    SAVE_VAL("HUD", "PedalInfoH"	   , HUD.Wheel.PedalYSz);
-    SAVE_VAL("HUD", "PedalInfoW"	   , HUD.Wheel.PedalXSz);
-    SAVE_VAL("HUD", "PedalInfoPadX"  , HUD.Wheel.PedalXPad);
-    SAVE_VAL("HUD", "PedalInfoPadY"  , HUD.Wheel.PedalYPad);
-
-    SAVE_VAL("HUD", "PedalBackgroundA", HUD.Wheel.PedalBgA);
-
-    SAVE_VAL("HUD", "PedalInfoThrottleR", HUD.Wheel.PedalThrottleR);
-    SAVE_VAL("HUD", "PedalInfoThrottleG", HUD.Wheel.PedalThrottleG);
-    SAVE_VAL("HUD", "PedalInfoThrottleB", HUD.Wheel.PedalThrottleB);
-    SAVE_VAL("HUD", "PedalInfoThrottleA", HUD.Wheel.PedalThrottleA);
-
-    SAVE_VAL("HUD", "PedalInfoBrakeR", HUD.Wheel.PedalBrakeR);
-    SAVE_VAL("HUD", "PedalInfoBrakeG", HUD.Wheel.PedalBrakeG);
-    SAVE_VAL("HUD", "PedalInfoBrakeB", HUD.Wheel.PedalBrakeB);
-    SAVE_VAL("HUD", "PedalInfoBrakeA", HUD.Wheel.PedalBrakeA);
-
-    SAVE_VAL("HUD", "PedalInfoClutchR", HUD.Wheel.PedalClutchR);
-    SAVE_VAL("HUD", "PedalInfoClutchG", HUD.Wheel.PedalClutchG);
-    SAVE_VAL("HUD", "PedalInfoClutchB", HUD.Wheel.PedalClutchB);
-    SAVE_VAL("HUD", "PedalInfoClutchA", HUD.Wheel.PedalClutchA);
-
-    SAVE_VAL("HUD", "FFBEnable", HUD.Wheel.FFB.Enable);
-
-    SAVE_VAL("HUD", "FFBXPos", HUD.Wheel.FFB.XPos  );
-    SAVE_VAL("HUD", "FFBYPos", HUD.Wheel.FFB.YPos  );
-    SAVE_VAL("HUD", "FFBXSz", HUD.Wheel.FFB.XSz   );
-    SAVE_VAL("HUD", "FFBYSz", HUD.Wheel.FFB.YSz   );
-
-    SAVE_VAL("HUD", "FFBBgR", HUD.Wheel.FFB.BgR   );
-    SAVE_VAL("HUD", "FFBBgG", HUD.Wheel.FFB.BgG   );
-    SAVE_VAL("HUD", "FFBBgB", HUD.Wheel.FFB.BgB   );
-    SAVE_VAL("HUD", "FFBBgA", HUD.Wheel.FFB.BgA   );
-
-    SAVE_VAL("HUD", "FFBFgR", HUD.Wheel.FFB.FgR   );
-    SAVE_VAL("HUD", "FFBFgG", HUD.Wheel.FFB.FgG   );
-    SAVE_VAL("HUD", "FFBFgB", HUD.Wheel.FFB.FgB   );
-    SAVE_VAL("HUD", "FFBFgA", HUD.Wheel.FFB.FgA   );
-
-    SAVE_VAL("HUD", "FFBLimitR", HUD.Wheel.FFB.LimitR);
-    SAVE_VAL("HUD", "FFBLimitG", HUD.Wheel.FFB.LimitG);
-    SAVE_VAL("HUD", "FFBLimitB", HUD.Wheel.FFB.LimitB);
-    SAVE_VAL("HUD", "FFBLimitA", HUD.Wheel.FFB.LimitA);
-
-    SAVE_VAL("HUD", "DashIndicators", HUD.DashIndicators.Enable);
-    SAVE_VAL("HUD", "DashIndicatorsXpos", HUD.DashIndicators.XPos);
-    SAVE_VAL("HUD", "DashIndicatorsYpos", HUD.DashIndicators.YPos);
-    SAVE_VAL("HUD", "DashIndicatorsSize", HUD.DashIndicators.Size);
-    SAVE_VAL("HUD", "DashIndicatorsLite", HUD.DashIndicators.Lite);
-    SAVE_VAL("HUD", "DashIndicatorsVOff", HUD.DashIndicators.TxtVOffset);
-    SAVE_VAL("HUD", "DashIndicatorsTMul", HUD.DashIndicators.TxtSzMod);
-
-    SAVE_VAL("HUD", "DsProtEnable", HUD.DsProt.Enable);
-    SAVE_VAL("HUD", "DsProtXpos", HUD.DsProt.XPos);
-    SAVE_VAL("HUD", "DsProtYpos", HUD.DsProt.YPos);
-    SAVE_VAL("HUD", "DsProtSize", HUD.DsProt.Size);
-
-    SAVE_VAL("HUD", "MouseEnable", HUD.MouseSteering.Enable);
-    SAVE_VAL("HUD", "MouseXPos", HUD.MouseSteering.XPos);
-    SAVE_VAL("HUD", "MouseYPos", HUD.MouseSteering.YPos);
-    SAVE_VAL("HUD", "MouseXSz", HUD.MouseSteering.XSz);
-    SAVE_VAL("HUD", "MouseYSz", HUD.MouseSteering.YSz);
-    SAVE_VAL("HUD", "MouseMarkerXSz", HUD.MouseSteering.MarkerXSz);
-
-    SAVE_VAL("HUD", "MouseBgR", HUD.MouseSteering.BgR);
-    SAVE_VAL("HUD", "MouseBgG", HUD.MouseSteering.BgG);
-    SAVE_VAL("HUD", "MouseBgB", HUD.MouseSteering.BgB);
-    SAVE_VAL("HUD", "MouseBgA", HUD.MouseSteering.BgA);
-
-    SAVE_VAL("HUD", "MouseFgR", HUD.MouseSteering.FgR);
-    SAVE_VAL("HUD", "MouseFgG", HUD.MouseSteering.FgG);
-    SAVE_VAL("HUD", "MouseFgB", HUD.MouseSteering.FgB);
-    SAVE_VAL("HUD", "MouseFgA", HUD.MouseSteering.FgA);
-
-    // [MISC]
-    SAVE_VAL("MISC", "UDPTelemetry", Misc.UDPTelemetry);
-    SAVE_VAL("MISC", "UDPAddress", Misc.UDPAddress);
-    SAVE_VAL("MISC", "UDPPort", Misc.UDPPort);
-    SAVE_VAL("MISC", "DashExtensions", Misc.DashExtensions);
-    SAVE_VAL("MISC", "SyncAnimations", Misc.SyncAnimations);
-    SAVE_VAL("MISC", "HidePlayerInFPV", Misc.HidePlayerInFPV);
-    SAVE_VAL("MISC", "HideWheelInFPV", Misc.HideWheelInFPV);
-    SAVE_VAL("MISC", "SaveFullConfig", Misc.SaveFullConfig);
 
     // [UPDATE]
-    SAVE_VAL("UPDATE", "EnableUpdate", Update.EnableUpdate);
     if (!Update.IgnoredVersion.empty())
         SAVE_VAL("UPDATE", "IgnoredVersion", Update.IgnoredVersion.c_str());
     else
         SAVE_VAL("UPDATE", "IgnoredVersion", "v0.0.0");
 
-    // [DEBUG]
-    SAVE_VAL("DEBUG", "DisplayInfo", Debug.DisplayInfo);
-    SAVE_VAL("DEBUG", "DisplayWheelInfo", Debug.DisplayWheelInfo);
-    SAVE_VAL("DEBUG", "DisplayMaterialInfo", Debug.DisplayMaterialInfo);
-    SAVE_VAL("DEBUG", "DisplayTractionInfo", Debug.DisplayTractionInfo);
-    SAVE_VAL("DEBUG", "DisplayGearingInfo", Debug.DisplayGearingInfo);
-    SAVE_VAL("DEBUG", "DisplayNPCInfo", Debug.DisplayNPCInfo);
-    SAVE_VAL("DEBUG", "ShowAdvancedFFBOptions", Debug.ShowAdvancedFFBOptions);
-    SAVE_VAL("DEBUG", "DisableRPMLimit", Debug.DisableRPMLimit);
-
-    SAVE_VAL("DEBUG", "DisableInputDetect", Debug.DisableInputDetect);
-    SAVE_VAL("DEBUG", "DisablePlayerHide", Debug.DisablePlayerHide);
-    SAVE_VAL("DEBUG", "DisableNPCGearbox", Debug.DisableNPCGearbox);
-    SAVE_VAL("DEBUG", "DisableNPCBrake", Debug.DisableNPCBrake);
-
-    SAVE_VAL("DEBUG", "EnableTimers", Debug.Metrics.EnableTimers);
-
-    SAVE_VAL("DEBUG", "EnableGForce", Debug.Metrics.GForce.Enable);
-    SAVE_VAL("DEBUG", "GForcePosX", Debug.Metrics.GForce.PosX);
-    SAVE_VAL("DEBUG", "GForcePosY", Debug.Metrics.GForce.PosY);
-    SAVE_VAL("DEBUG", "GForceSize", Debug.Metrics.GForce.Size);
-
     result = ini.SaveFile(settingsGeneralFile.c_str());
     CHECK_LOG_SI_ERROR(result, "save");
 
@@ -350,26 +166,14 @@ void ScriptSettings::SaveController(CarControls* scriptControl) const {
     SI_Error result = ini.LoadFile(settingsControlsFile.c_str());
     CHECK_LOG_SI_ERROR(result, "load");
 
-    // [CONTROLLER]
-    SAVE_VAL("CONTROLLER", "HoldTimeMs", Controller.HoldTimeMs);
-    SAVE_VAL("CONTROLLER", "MaxTapTimeMs", Controller.MaxTapTimeMs);
-    SAVE_VAL("CONTROLLER", "TriggerValue", Controller.TriggerValue);
-    SAVE_VAL("CONTROLLER", "ToggleEngine", Controller.ToggleEngine);
-
-    SAVE_VAL("CONTROLLER", "BlockCarControls", Controller.BlockCarControls);
-    SAVE_VAL("CONTROLLER", "IgnoreShiftsUI", Controller.IgnoreShiftsUI);
-    SAVE_VAL("CONTROLLER", "BlockHShift", Controller.BlockHShift);
-
-    SAVE_VAL("CONTROLLER", "CustomDeadzone", Controller.CustomDeadzone);
-    SAVE_VAL("CONTROLLER", "DeadzoneLeftThumb", Controller.DeadzoneLeftThumb);
-    SAVE_VAL("CONTROLLER", "DeadzoneRightThumb", Controller.DeadzoneRightThumb);
+    SettingsSchema::Save(ini, ScriptSettingsSchema::Controls, *this);
 
+    // [CONTROLLER]
     SAVE_VAL("CONTROLLER", "ShiftUpBlocks",   scriptControl->ControlXboxBlocks[static_cast<int>(CarControls::LegacyControlType::ShiftUp)]);
     SAVE_VAL("CONTROLLER", "ShiftDownBlocks", scriptControl->ControlXboxBlocks[static_cast<int>(CarControls::LegacyControlType::ShiftDown)]);
     SAVE_VAL("CONTROLLER", "ClutchBlocks",    scriptControl->ControlXboxBlocks[static_cast<int>(CarControls::LegacyControlType::Clutch)]);
 
     // [CONTROLLER_NATIVE]
-    SAVE_VAL("CONTROLLER_NATIVE", "Enable", Controller.Native.Enable);
     SAVE_VAL("CONTROLLER_NATIVE", "ShiftUpBlocks", scriptControl->ControlNativeBlocks[static_cast<int>(CarControls::LegacyControlType::ShiftUp)]);
     SAVE_VAL("CONTROLLER_NATIVE", "ShiftDownBlocks", scriptControl->ControlNativeBlocks[static_cast<int>(CarControls::LegacyControlType::ShiftDown)]);
     SAVE_VAL("CONTROLLER_NATIVE", "ClutchBlocks", scriptControl->ControlNativeBlocks[static_cast<int>(CarControls::LegacyControlType::Clutch)]);
@@ -385,127 +189,19 @@ void ScriptSettings::SaveWheel() const {
     SI_Error result = ini.LoadFile(settingsWheelFile.c_str());
     CHECK_LOG_SI_ERROR(result, "load");
 
-    // [OPTIONS]
-    SAVE_VAL("MT_OPTIONS", "EnableWheel", Wheel.Options.Enable);
-
-    SAVE_VAL("MT_OPTIONS", "LogitechLEDs", Wheel.Options.LogiLEDs);
-    SAVE_VAL("MT_OPTIONS", "HPatternKeyboard", Wheel.Options.HPatternKeyboard);
-
-    SAVE_VAL("MT_OPTIONS", "UseShifterForAuto", Wheel.Options.UseShifterForAuto);
-
-    // [FORCE_FEEDBACK]
-    SAVE_VAL("FORCE_FEEDBACK", "Enable", Wheel.FFB.Enable);
-    SAVE_VAL("FORCE_FEEDBACK", "SATAmpMult", Wheel.FFB.SATAmpMult);
-    SAVE_VAL("FORCE_FEEDBACK", "DamperMax", Wheel.FFB.DamperMax);
-    SAVE_VAL("FORCE_FEEDBACK", "DamperMin", Wheel.FFB.DamperMin);
-    SAVE_VAL("FORCE_FEEDBACK", "DamperMinSpeed", Wheel.FFB.DamperMinSpeed);
-    SAVE_VAL("FORCE_FEEDBACK", "DetailMult", Wheel.FFB.DetailMult);
-    SAVE_VAL("FORCE_FEEDBACK", "DetailLim", Wheel.FFB.DetailLim);
-    SAVE_VAL("FORCE_FEEDBACK", "DetailMaw", Wheel.FFB.DetailMAW);
-    SAVE_VAL("FORCE_FEEDBACK", "CollisionMult", Wheel.FFB.CollisionMult);
-    SAVE_VAL("FORCE_FEEDBACK", "AntiDeadForce", Wheel.FFB.AntiDeadForce);
-
-    SAVE_VAL("FORCE_FEEDBACK", "FFBProfile", Wheel.FFB.FFBProfile);
-    SAVE_VAL("FORCE_FEEDBACK", "ResponseCurve", Wheel.FFB.ResponseCurve);
-    SAVE_VAL("FORCE_FEEDBACK", "SlipOptMin", Wheel.FFB.SlipOptMin);
-    SAVE_VAL("FORCE_FEEDBACK", "SlipOptMinMult", Wheel.FFB.SlipOptMinMult);
-    SAVE_VAL("FORCE_FEEDBACK", "SlipOptMax", Wheel.FFB.SlipOptMax);
-    SAVE_VAL("FORCE_FEEDBACK", "SlipOptMaxMult", Wheel.FFB.SlipOptMaxMult);
-
-    SAVE_VAL("FORCE_FEEDBACK", "SATFactor", Wheel.FFB.SATFactor);
-    SAVE_VAL("FORCE_FEEDBACK", "Gamma", Wheel.FFB.Gamma);
-    SAVE_VAL("FORCE_FEEDBACK", "MaxSpeed", Wheel.FFB.MaxSpeed);
+    SettingsSchema::Save(ini, ScriptSettingsSchema::Wheel, *this);
 
     // [INPUT_DEVICES]
     ini.SetValue("INPUT_DEVICES", nullptr, nullptr);
 
-    // [STEER]
-    SAVE_VAL("STEER", "ANTIDEADZONE", Wheel.Steering.AntiDeadZone);
-    SAVE_VAL("STEER", "DEADZONE", Wheel.Steering.DeadZone);
-    SAVE_VAL("STEER", "DEADZONEOFFSET", Wheel.Steering.DeadZoneOffset);
-    SAVE_VAL("STEER", "SteerAngleMax", Wheel.Steering.AngleMax);
-    SAVE_VAL("STEER", "SteerAngleCar", Wheel.Steering.AngleCar);
-    SAVE_VAL("STEER", "SteerAngleBike",Wheel.Steering.AngleBike);
-    SAVE_VAL("STEER", "SteerAngleBoat", Wheel.Steering.AngleBoat);
-    SAVE_VAL("STEER", "GAMMA", Wheel.Steering.Gamma);
-
-    // [THROTTLE]
-    SAVE_VAL("THROTTLE", "GAMMA", Wheel.Throttle.Gamma);
-    SAVE_VAL("THROTTLE", "ANTIDEADZONE", Wheel.Throttle.AntiDeadZone);
-
-    // [BRAKE]
-    SAVE_VAL("BRAKE", "GAMMA", Wheel.Brake.Gamma);
-    SAVE_VAL("BRAKE", "ANTIDEADZONE", Wheel.Brake.AntiDeadZone);
-
     result = ini.SaveFile(settingsWheelFile.c_str());
     CHECK_LOG_SI_ERROR(result, "save");
 }
 
-void ScriptSettings::parseSettingsGeneral() {
-    CSimpleIniA ini;
-    ini.SetUnicode();
-    SI_Error result = ini.LoadFile(settingsGeneralFile.c_str());
-    CHECK_LOG_SI_ERROR(result, "load");
-
-    // [MT_OPTIONS]
-    LOAD_VAL("MT_OPTIONS", "Enable", MTOptions.Enable);
-
-    LOAD_VAL("MT_OPTIONS", "EngineDamage", MTOptions.EngDamage);
-    LOAD_VAL("MT_OPTIONS", "EngineStalling", MTOptions.EngStallH);
-    LOAD_VAL("MT_OPTIONS", "EngineStallingS", MTOptions.EngStallS);
-    LOAD_VAL("MT_OPTIONS", "EngineBraking", MTOptions.EngBrake);
-    LOAD_VAL("MT_OPTIONS", "EngineLocking", MTOptions.EngLock);
-    LOAD_VAL("MT_OPTIONS", "FinalGearRPMLimit", MTOptions.FinalGearRPMLimit);
-
-    LOAD_VAL("GAMEPLAY_ASSISTS", "DefaultNeutral", GameAssists.DefaultNeutral);
-    LOAD_VAL("GAMEPLAY_ASSISTS", "SimpleBike", GameAssists.SimpleBike);
-    LOAD_VAL("GAMEPLAY_ASSISTS", "HillBrakeWorkaround", GameAssists.HillGravity);
-    LOAD_VAL("GAMEPLAY_ASSISTS", "AutoGear1", GameAssists.AutoGear1);
-    LOAD_VAL("GAMEPLAY_ASSISTS", "AutoLookBack", GameAssists.AutoLookBack);
-    LOAD_VAL("GAMEPLAY_ASSISTS", "ThrottleStart", GameAssists.ThrottleStart);
-    LOAD_VAL("GAMEPLAY_ASSISTS", "DisableAutostart", GameAssists.DisableAutostart);
-    LOAD_VAL("GAMEPLAY_ASSISTS", "LeaveEngineRunning", GameAssists.LeaveEngineRunning);
-
-    // [CUSTOM_STEERING]
-    LOAD_VAL("CUSTOM_STEERING", "Mode", CustomSteering.Mode);
-    LOAD_VAL("CUSTOM_STEERING", "CountersteerMult", CustomSteering.CountersteerMult);
-    LOAD_VAL("CUSTOM_STEERING", "CountersteerLimit", CustomSteering.CountersteerLimit);
-    LOAD_VAL("CUSTOM_STEERING", "NoReductionHandbrake", CustomSteering.NoReductionHandbrake);
-    LOAD_VAL("CUSTOM_STEERING", "Gamma", CustomSteering.Gamma);
-    LOAD_VAL("CUSTOM_STEERING", "SteerTime", CustomSteering.SteerTime);
-    LOAD_VAL("CUSTOM_STEERING", "CenterTime", CustomSteering.CenterTime);
-
-    LOAD_VAL("CUSTOM_STEERING", "MouseSteering", CustomSteering.Mouse.Enable);
-    LOAD_VAL("CUSTOM_STEERING", "MouseSensitivity", CustomSteering.Mouse.Sensitivity);
-    LOAD_VAL("CUSTOM_STEERING", "MouseDisableSteerAssist", CustomSteering.Mouse.DisableSteerAssist);
-    LOAD_VAL("CUSTOM_STEERING", "MouseDisableReduction", CustomSteering.Mouse.DisableReduction);
+void ScriptSettings::parseSettingsGeneral(CSimpleIniA& ini) {
+    SettingsSchema::Load(ini, ScriptSettingsSchema::General, *this, "General");
 
     // [HUD]
-    LOAD_VAL("HUD", "EnableHUD", HUD.Enable);
-    LOAD_VAL("HUD", "AlwaysHUD", HUD.Always);
-    LOAD_VAL("HUD", "HUDFont", HUD.Font);
-    LOAD_VAL("HUD", "Outline", HUD.Outline);
-    LOAD_VAL("HUD", "NotifyLevel", HUD.NotifyLevel);
-
-    LOAD_VAL("HUD", "GearIndicator", HUD.Gear.Enable);
-    LOAD_VAL("HUD", "GearXpos", HUD.Gear.XPos);
-    LOAD_VAL("HUD", "GearYpos", HUD.Gear.YPos);
-    LOAD_VAL("HUD", "GearSize", HUD.Gear.Size);
-    LOAD_VAL("HUD", "GearTopColorR", HUD.Gear.TopColorR);
-    LOAD_VAL("HUD", "GearTopColorG", HUD.Gear.TopColorG);
-    LOAD_VAL("HUD", "GearTopColorB", HUD.Gear.TopColorB);
-    LOAD_VAL("HUD", "GearColorR", HUD.Gear.ColorR);
-    LOAD_VAL("HUD", "GearColorG", HUD.Gear.ColorG);
-    LOAD_VAL("HUD", "GearColorB", HUD.Gear.ColorB);
-
-    LOAD_VAL("HUD", "ShiftModeIndicator", HUD.ShiftMode.Enable);
-    LOAD_VAL("HUD", "ShiftModeXpos", HUD.ShiftMode.XPos);
-    LOAD_VAL("HUD", "ShiftModeYpos", HUD.ShiftMode.YPos);
-    LOAD_VAL("HUD", "ShiftModeSize", HUD.ShiftMode.Size);
-    LOAD_VAL("HUD", "ShiftModeColorR", HUD.ShiftMode.ColorR);
-    LOAD_VAL("HUD", "ShiftModeColorG", HUD.ShiftMode.ColorG);
-    LOAD_VAL("HUD", "ShiftModeColorB", HUD.ShiftMode.ColorB);
-
     auto unitStr = GetValue(ini, "HUD", "SpeedoUnit", std::string());
     if (!unitStr.empty()) {
         HUD.Speedo.Unit = unitStr;
@@ -513,167 +209,15 @@ void ScriptSettings::parseSettingsGeneral() {
     else {
         LOAD_VAL("HUD", "Speedo", HUD.Speedo.Unit);
     }
-    LOAD_VAL("HUD", "SpeedoShowUnit", HUD.Speedo.ShowUnit);
-    LOAD_VAL("HUD", "SpeedoUseDrivetrain", HUD.Speedo.UseDrivetrain);
-    LOAD_VAL("HUD", "SpeedoXpos", HUD.Speedo.XPos);
-    LOAD_VAL("HUD", "SpeedoYpos", HUD.Speedo.YPos);
-    LOAD_VAL("HUD", "SpeedoSize", HUD.Speedo.Size);
-    LOAD_VAL("HUD", "SpeedoColorR", HUD.Speedo.ColorR);
-    LOAD_VAL("HUD", "SpeedoColorG", HUD.Speedo.ColorG);
-    LOAD_VAL("HUD", "SpeedoColorB", HUD.Speedo.ColorB);
-
-    LOAD_VAL("HUD", "EnableRPMIndicator", HUD.RPMBar.Enable);
-    LOAD_VAL("HUD", "RPMIndicatorXpos", HUD.RPMBar.XPos);
-    LOAD_VAL("HUD", "RPMIndicatorYpos", HUD.RPMBar.YPos);
-    LOAD_VAL("HUD", "RPMIndicatorWidth", HUD.RPMBar.XSz);
-    LOAD_VAL("HUD", "RPMIndicatorHeight", HUD.RPMBar.YSz);
-    LOAD_VAL("HUD", "RPMIndicatorRedline", HUD.RPMBar.Redline);
-
-    LOAD_VAL("HUD", "RPMIndicatorBackgroundR", HUD.RPMBar.BgR);
-    LOAD_VAL("HUD", "RPMIndicatorBackgroundG", HUD.RPMBar.BgG);
-    LOAD_VAL("HUD", "RPMIndicatorBackgroundB", HUD.RPMBar.BgB);
-    LOAD_VAL("HUD", "RPMIndicatorBackgroundA", HUD.RPMBar.BgA);
-                                    
-    LOAD_VAL("HUD", "RPMIndicatorForegroundR", HUD.RPMBar.FgR);
-    LOAD_VAL("HUD", "RPMIndicatorForegroundG", HUD.RPMBar.FgG);
-    LOAD_VAL("HUD", "RPMIndicatorForegroundB", HUD.RPMBar.FgB);
-    LOAD_VAL("HUD", "RPMIndicatorForegroundA", HUD.RPMBar.FgA);
-                                    
-    LOAD_VAL("HUD", "RPMIndicatorRedlineR", HUD.RPMBar.RedlineR);
-    LOAD_VAL("HUD", "RPMIndicatorRedlineG", HUD.RPMBar.RedlineG);
-    LOAD_VAL("HUD", "RPMIndicatorRedlineB", HUD.RPMBar.RedlineB);
-    LOAD_VAL("HUD", "RPMIndicatorRedlineA", HUD.RPMBar.RedlineA);
-
-    LOAD_VAL("HUD", "RPMIndicatorRevlimitR", HUD.RPMBar.RevLimitR);
-    LOAD_VAL("HUD", "RPMIndicatorRevlimitG", HUD.RPMBar.RevLimitG);
-    LOAD_VAL("HUD", "RPMIndicatorRevlimitB", HUD.RPMBar.RevLimitB);
-    LOAD_VAL("HUD", "RPMIndicatorRevlimitA", HUD.RPMBar.RevLimitA);
-
-    LOAD_VAL("HUD", "RPMIndicatorLaunchStagedR", HUD.RPMBar.LaunchControlStagedR);
-    LOAD_VAL("HUD", "RPMIndicatorLaunchStagedG", HUD.RPMBar.LaunchControlStagedG);
-    LOAD_VAL("HUD", "RPMIndicatorLaunchStagedB", HUD.RPMBar.LaunchControlStagedB);
-    LOAD_VAL("HUD", "RPMIndicatorLaunchStagedA", HUD.RPMBar.LaunchControlStagedA);
-
-    LOAD_VAL("HUD", "RPMIndicatorLaunchActiveR", HUD.RPMBar.LaunchControlActiveR);
-    LOAD_VAL("HUD", "RPMIndicatorLaunchActiveG", HUD.RPMBar.LaunchControlActiveG);
-    LOAD_VAL("HUD", "RPMIndicatorLaunchActiveB", HUD.RPMBar.LaunchControlActiveB);
-    LOAD_VAL("HUD", "RPMIndicatorLaunchActiveA", HUD.RPMBar.LaunchControlActiveA);
-
-    LOAD_VAL("HUD", "SteeringWheelInfo", HUD.Wheel.Enable);
-    LOAD_VAL("HUD", "AlwaysSteeringWheelInfo", HUD.Wheel.Always);
-    LOAD_VAL("HUD", "SteeringWheelTextureX", HUD.Wheel.ImgXPos);
-    LOAD_VAL("HUD", "SteeringWheelTextureY", HUD.Wheel.ImgYPos);
-    LOAD_VAL("HUD", "SteeringWheelTextureSz", HUD.Wheel.ImgSize);
-
-    LOAD_VAL("HUD", "PedalInfoX", HUD.Wheel.PedalXPos);
-    LOAD_VAL("HUD", "PedalInfoY", HUD.Wheel.PedalYPos);
-    LOAD_VAL("HUD", "PedalInfoH", HUD.Wheel.PedalYSz);
-    LOAD_VAL("HUD", "PedalInfoW", HUD.Wheel.PedalXSz);
-    LOAD_VAL("HUD", "PedalInfoPadX", HUD.Wheel.PedalXPad);
-    LOAD_VAL("HUD", "PedalInfoPadY", HUD.Wheel.PedalYPad);
-    LOAD_VAL("HUD", "PedalBackgroundA", HUD.Wheel.PedalBgA);
-
-    LOAD_VAL("HUD", "PedalInfoThrottleR", HUD.Wheel.PedalThrottleR);
-    LOAD_VAL("HUD", "PedalInfoThrottleG", HUD.Wheel.PedalThrottleG);
-    LOAD_VAL("HUD", "PedalInfoThrottleB", HUD.Wheel.PedalThrottleB);
-    LOAD_VAL("HUD", "PedalInfoThrottleA", HUD.Wheel.PedalThrottleA);
-
-    LOAD_VAL("HUD", "PedalInfoBrakeR", HUD.Wheel.PedalBrakeR);
-    LOAD_VAL("HUD", "PedalInfoBrakeG", HUD.Wheel.PedalBrakeG);
-    LOAD_VAL("HUD", "PedalInfoBrakeB", HUD.Wheel.PedalBrakeB);
-    LOAD_VAL("HUD", "PedalInfoBrakeA", HUD.Wheel.PedalBrakeA);
-
-    LOAD_VAL("HUD", "PedalInfoClutchR", HUD.Wheel.PedalClutchR);
-    LOAD_VAL("HUD", "PedalInfoClutchG", HUD.Wheel.PedalClutchG);
-    LOAD_VAL("HUD", "PedalInfoClutchB", HUD.Wheel.PedalClutchB);
-    LOAD_VAL("HUD", "PedalInfoClutchA", HUD.Wheel.PedalClutchA);
-
-    LOAD_VAL("HUD", "FFBEnable", HUD.Wheel.FFB.Enable);
-
-    LOAD_VAL("HUD", "FFBXPos", HUD.Wheel.FFB.XPos);
-    LOAD_VAL("HUD", "FFBYPos", HUD.Wheel.FFB.YPos);
-    LOAD_VAL("HUD", "FFBXSz", HUD.Wheel.FFB.XSz);
-    LOAD_VAL("HUD", "FFBYSz", HUD.Wheel.FFB.YSz);
-
-    LOAD_VAL("HUD", "FFBBgR", HUD.Wheel.FFB.BgR);
-    LOAD_VAL("HUD", "FFBBgG", HUD.Wheel.FFB.BgG);
-    LOAD_VAL("HUD", "FFBBgB", HUD.Wheel.FFB.BgB);
-    LOAD_VAL("HUD", "FFBBgA", HUD.Wheel.FFB.BgA);
-
-    LOAD_VAL("HUD", "FFBFgR", HUD.Wheel.FFB.FgR);
-    LOAD_VAL("HUD", "FFBFgG", HUD.Wheel.FFB.FgG);
-    LOAD_VAL("HUD", "FFBFgB", HUD.Wheel.FFB.FgB);
-    LOAD_VAL("HUD", "FFBFgA", HUD.Wheel.FFB.FgA);
-
-    LOAD_VAL("HUD", "FFBLimitR", HUD.Wheel.FFB.LimitR);
-    LOAD_VAL("HUD", "FFBLimitG", HUD.Wheel.FFB.LimitG);
-    LOAD_VAL("HUD", "FFBLimitB", HUD.Wheel.FFB.LimitB);
-    LOAD_VAL("HUD", "FFBLimitA", HUD.Wheel.FFB.LimitA);
-
-    LOAD_VAL("HUD", "DashIndicators", HUD.DashIndicators.Enable);
-    LOAD_VAL("HUD", "DashIndicatorsXpos", HUD.DashIndicators.XPos);
-    LOAD_VAL("HUD", "DashIndicatorsYpos", HUD.DashIndicators.YPos);
-    LOAD_VAL("HUD", "DashIndicatorsSize", HUD.DashIndicators.Size);
-    LOAD_VAL("HUD", "DashIndicatorsLite", HUD.DashIndicators.Lite);
-    LOAD_VAL("HUD", "DashIndicatorsVOff", HUD.DashIndicators.TxtVOffset);
-    LOAD_VAL("HUD", "DashIndicatorsTMul", HUD.DashIndicators.TxtSzMod);
-
-    LOAD_VAL("HUD", "DsProtEnable", HUD.DsProt.Enable);
-    LOAD_VAL("HUD", "DsProtXpos", HUD.DsProt.XPos);
-    LOAD_VAL("HUD", "DsProtYpos", HUD.DsProt.YPos);
-    LOAD_VAL("HUD", "DsProtSize", HUD.DsProt.Size);
-
-    LOAD_VAL("HUD", "MouseEnable", HUD.MouseSteering.Enable);
-    LOAD_VAL("HUD", "MouseXPos", HUD.MouseSteering.XPos);
-    LOAD_VAL("HUD", "MouseYPos", HUD.MouseSteering.YPos);
-    LOAD_VAL("HUD", "MouseXSz", HUD.MouseSteering.XSz);
-    LOAD_VAL("HUD", "MouseYSz", HUD.MouseSteering.YSz);
-    LOAD_VAL("HUD", "MouseMarkerXSz", HUD.MouseSteering.MarkerXSz);
-
-    LOAD_VAL("HUD", "MouseBgR", HUD.MouseSteering.BgR);
-    LOAD_VAL("HUD", "MouseBgG", HUD.MouseSteering.BgG);
-    LOAD_VAL("HUD", "MouseBgB", HUD.MouseSteering.BgB);
-    LOAD_VAL("HUD", "MouseBgA", HUD.MouseSteering.BgA);
-
-    LOAD_VAL("HUD", "MouseFgR", HUD.MouseSteering.FgR);
-    LOAD_VAL("HUD", "MouseFgG", HUD.MouseSteering.FgG);
-    LOAD_VAL("HUD", "MouseFgB", HUD.MouseSteering.FgB);
-    LOAD_VAL("HUD", "MouseFgA", HUD.MouseSteering.FgA);
-
-    // [MISC]
-    LOAD_VAL("MISC", "UDPTelemetry", Misc.UDPTelemetry);
-    LOAD_VAL("MISC", "UDPAddress", Misc.UDPAddress);
-    LOAD_VAL("MISC", "UDPPort", Misc.UDPPort);
-    LOAD_VAL("MISC", "DashExtensions", Misc.DashExtensions);
-    LOAD_VAL("MISC", "SyncAnimations", Misc.SyncAnimations);
-    LOAD_VAL("MISC", "HidePlayerInFPV", Misc.HidePlayerInFPV);
-    LOAD_VAL("MISC", "HideWheelInFPV", Misc.HideWheelInFPV);
-    LOAD_VAL("MISC", "SaveFullConfig", Misc.SaveFullConfig);
+    HUD.Speedo.UnitType = ParseSpeedoUnit(HUD.Speedo.Unit);
 
     // [UPDATE]
-    LOAD_VAL("UPDATE", "EnableUpdate", Update.EnableUpdate);
     LOAD_VAL("UPDATE", "IgnoredVersion", Update.IgnoredVersion);
 
     // [DEBUG]
     LOAD_VAL("DEBUG", "LogLevel", Debug.LogLevel);
     LOAD_VAL("DEBUG", "CancelAnimOnUnload", Debug.CancelAnimOnUnload);
 
-    LOAD_VAL("DEBUG", "DisplayInfo", Debug.DisplayInfo);
-    LOAD_VAL("DEBUG", "DisplayWheelInfo", Debug.DisplayWheelInfo);
-    LOAD_VAL("DEBUG", "DisplayMaterialInfo", Debug.DisplayMaterialInfo);
-    LOAD_VAL("DEBUG", "DisplayTractionInfo", Debug.DisplayTractionInfo);
-    LOAD_VAL("DEBUG", "DisplayGearingInfo", Debug.DisplayGearingInfo);
-    LOAD_VAL("DEBUG", "DisplayNPCInfo", Debug.DisplayNPCInfo);
-    LOAD_VAL("DEBUG", "ShowAdvancedFFBOptions", Debug.ShowAdvancedFFBOptions);
-    LOAD_VAL("DEBUG", "DisableRPMLimit", Debug.DisableRPMLimit);
-
-    LOAD_VAL("DEBUG", "DisableInputDetect", Debug.DisableInputDetect);
-    LOAD_VAL("DEBUG", "DisablePlayerHide", Debug.DisablePlayerHide);
-    LOAD_VAL("DEBUG", "DisableNPCGearbox", Debug.DisableNPCGearbox);
-    LOAD_VAL("DEBUG", "DisableNPCBrake", Debug.DisableNPCBrake);
-
-    LOAD_VAL("DEBUG", "EnableTimers", Debug.Metrics.EnableTimers);
-
     int it = 0;
     Debug.Metrics.Timers.clear();
     while (true) {
@@ -709,14 +253,16 @@ void ScriptSettings::parseSettingsGeneral() {
         switch (joaat(unit.c_str())) {
             case joaat("kph"): // fall-through
             case joaat("mph"): // fall-through
-            case joaat("m/s"):
+            case joaat("m/s"): // fall-through
+            case joaat("m"):   // fall-through
+            case joaat("ft"):
                 logger.Write(INFO, "[Settings] Timer%d: Added [%f - %f] [%s] timer",
                     it, limA, limB, unit.c_str());
                 break;
             default:
                 logger.Write(WARN, "[Settings] Timer%d: Skipping. Invalid unit: %s",
                     it, unit.c_str());
-                logger.Write(WARN, "[Settings] Timer%d: Valid units: kph, mph or m/s",
+                logger.Write(WARN, "[Settings] Timer%d: Valid units: kph, mph, m/s, m or ft",
                     it);
                 it++;
                 continue;
@@ -725,11 +271,6 @@ void ScriptSettings::parseSettingsGeneral() {
         Debug.Metrics.Timers.push_back(TimerParams{ unit, limA, limB, tolerance });
         it++;
     }
-
-    LOAD_VAL("DEBUG", "EnableGForce", Debug.Metrics.GForce.Enable);
-    LOAD_VAL("DEBUG", "GForcePosX", Debug.Metrics.GForce.PosX);
-    LOAD_VAL("DEBUG", "GForcePosY", Debug.Metrics.GForce.PosY);
-    LOAD_VAL("DEBUG", "GForceSize", Debug.Metrics.GForce.Size);
 }
 
 
@@ -748,20 +289,9 @@ void ScriptSettings::parseSettingsControls(CarControls* scriptControl) {
     SI_Error result = ini.LoadFile(settingsControlsFile.c_str());
     CHECK_LOG_SI_ERROR(result, "load");
 
-    // [CONTROLLER]
-    LOAD_VAL("CONTROLLER", "BlockCarControls", Controller.BlockCarControls);
-    LOAD_VAL("CONTROLLER", "IgnoreShiftsUI", Controller.IgnoreShiftsUI);
-    LOAD_VAL("CONTROLLER", "BlockHShift", Controller.BlockHShift);
-    LOAD_VAL("CONTROLLER", "ToggleEngine", Controller.ToggleEngine);
-
-    LOAD_VAL("CONTROLLER", "HoldTimeMs", Controller.HoldTimeMs);
-    LOAD_VAL("CONTROLLER", "MaxTapTimeMs", Controller.MaxTapTimeMs);
-    LOAD_VAL("CONTROLLER", "TriggerValue", Controller.TriggerValue);
-
-    LOAD_VAL("CONTROLLER", "CustomDeadzone", Controller.CustomDeadzone);
-    LOAD_VAL("CONTROLLER", "DeadzoneLeftThumb", Controller.DeadzoneLeftThumb);
-    LOAD_VAL("CONTROLLER", "DeadzoneRightThumb", Controller.DeadzoneRightThumb);
+    SettingsSchema::Load(ini, ScriptSettingsSchema::Controls, *this, "Controls");
 
+    // [CONTROLLER]
     scriptControl->ControlXbox[GET_CT(Toggle)] = parseControllerItem<std::string>(ini, "Toggle", "UNKNOWN", "Toggle MT", "Usage: hold");
     scriptControl->ControlXbox[GET_CT(ToggleH)] = parseControllerItem<std::string>(ini, "ToggleShift", "B", "Change shift mode", "Usage: hold");
     scriptControl->ControlXbox[GET_CT(CycleAssists)] = parseControllerItem<std::string>(ini, "CycleAssists", "UNKNOWN", "Cycle assists", "Usage: hold");
@@ -783,8 +313,6 @@ void ScriptSettings::parseSettingsControls(CarControls* scriptControl) {
     scriptControl->ControlXboxBlocks[GET_CT(Clutch)]    = ini.GetLongValue("CONTROLLER", "ClutchBlocks", -1);
 
     // [CONTROLLER_NATIVE]
-    LOAD_VAL("CONTROLLER_NATIVE", "Enable", Controller.Native.Enable);
-
     scriptControl->LegacyControls[GET_LT(Toggle)]       = parseControllerItem<eControl>(ini, "Toggle", static_cast<eControl>(-1), "Toggle MT", "Usage: hold");
     scriptControl->LegacyControls[GET_LT(ToggleH)]      = parseControllerItem<eControl>(ini, "ToggleShift", ControlFrontendCancel, "Change shift mode", "Usage: hold");
     scriptControl->LegacyControls[GET_LT(CycleAssists)] = parseControllerItem<eControl>(ini, "CycleAssists", static_cast<eControl>(-1), "Cycle assists", "Usage: hold");
@@ -841,6 +369,8 @@ void ScriptSettings::parseSettingsControls(CarControls* scriptControl) {
     scriptControl->KBControl[GET_KT(H9)] =  parseKeyboardItem(ini, "H9", "UNKNOWN", "H-pattern 9");
     scriptControl->KBControl[GET_KT(H10)] = parseKeyboardItem(ini, "H10", "UNKNOWN", "H-pattern 10");
     scriptControl->KBControl[GET_KT(HN)] =  parseKeyboardItem(ini, "HN", "UNKNOWN", "H-pattern neutral");
+
+    scriptControl->UpdateKeyboardBindings();
 }
 
 #undef GET_KT
@@ -860,36 +390,11 @@ void ScriptSettings::parseSettingsWheel(CarControls *scriptControl) {
     SI_Error result = ini.LoadFile(settingsWheelFile.c_str());
     CHECK_LOG_SI_ERROR(result, "load");
 
-    // [OPTIONS]
-    LOAD_VAL("MT_OPTIONS", "EnableWheel", Wheel.Options.Enable);
-    LOAD_VAL("MT_OPTIONS", "LogitechLEDs", Wheel.Options.LogiLEDs);
-    LOAD_VAL("MT_OPTIONS", "HPatternKeyboard", Wheel.Options.HPatternKeyboard);
-    LOAD_VAL("MT_OPTIONS", "UseShifterForAuto", Wheel.Options.UseShifterForAuto);
+    SettingsSchema::Load(ini, ScriptSettingsSchema::Wheel, *this, "Wheel");
 
     // [FORCE_FEEDBACK]
-    LOAD_VAL("FORCE_FEEDBACK", "Enable", Wheel.FFB.Enable);
-    LOAD_VAL("FORCE_FEEDBACK", "SATAmpMult", Wheel.FFB.SATAmpMult);
-    LOAD_VAL("FORCE_FEEDBACK", "DamperMax", Wheel.FFB.DamperMax);
-    LOAD_VAL("FORCE_FEEDBACK", "DamperMin", Wheel.FFB.DamperMin);
-    LOAD_VAL("FORCE_FEEDBACK", "DamperMinSpeed", Wheel.FFB.DamperMinSpeed);
-    LOAD_VAL("FORCE_FEEDBACK", "DetailMult", Wheel.FFB.DetailMult);
-    LOAD_VAL("FORCE_FEEDBACK", "DetailLim", Wheel.FFB.DetailLim);
-    LOAD_VAL("FORCE_FEEDBACK", "DetailMaw", Wheel.FFB.DetailMAW);
-    LOAD_VAL("FORCE_FEEDBACK", "CollisionMult", Wheel.FFB.CollisionMult);
-    LOAD_VAL("FORCE_FEEDBACK", "AntiDeadForce", Wheel.FFB.AntiDeadForce);
     Wheel.FFB.LUTFile = ini.GetValue("FORCE_FEEDBACK", "LUTFile", "");
 
-    LOAD_VAL("FORCE_FEEDBACK", "FFBProfile", Wheel.FFB.FFBProfile);
-    LOAD_VAL("FORCE_FEEDBACK", "ResponseCurve", Wheel.FFB.ResponseCurve);
-    LOAD_VAL("FORCE_FEEDBACK", "SlipOptMin", Wheel.FFB.SlipOptMin);
-    LOAD_VAL("FORCE_FEEDBACK", "SlipOptMinMult", Wheel.FFB.SlipOptMinMult);
-    LOAD_VAL("FORCE_FEEDBACK", "SlipOptMax", Wheel.FFB.SlipOptMax);
-    LOAD_VAL("FORCE_FEEDBACK", "SlipOptMaxMult", Wheel.FFB.SlipOptMaxMult);
-
-    LOAD_VAL("FORCE_FEEDBACK", "SATFactor", Wheel.FFB.SATFactor);
-    LOAD_VAL("FORCE_FEEDBACK", "Gamma", Wheel.FFB.Gamma);
-    LOAD_VAL("FORCE_FEEDBACK", "MaxSpeed", Wheel.FFB.MaxSpeed);
-
     // [INPUT_DEVICES]
     int it = 0;
     Wheel.InputDevices.RegisteredGUIDs.clear();
@@ -937,24 +442,12 @@ void ScriptSettings::parseSettingsWheel(CarControls *scriptControl) {
     LOAD_VAL("STEER", "MIN", Wheel.Steering.Min);
     LOAD_VAL("STEER", "MAX", Wheel.Steering.Max);
 
-    LOAD_VAL("STEER", "ANTIDEADZONE", Wheel.Steering.AntiDeadZone);
-    LOAD_VAL("STEER", "DEADZONE", Wheel.Steering.DeadZone);
-    LOAD_VAL("STEER", "DEADZONEOFFSET", Wheel.Steering.DeadZoneOffset);
-    LOAD_VAL("STEER", "GAMMA", Wheel.Steering.Gamma);
-
-    LOAD_VAL("STEER", "SteerAngleMax", Wheel.Steering.AngleMax);
-    LOAD_VAL("STEER", "SteerAngleCar", Wheel.Steering.AngleCar);
-    LOAD_VAL("STEER", "SteerAngleBike", Wheel.Steering.AngleBike);
-    LOAD_VAL("STEER", "SteerAngleBoat", Wheel.Steering.AngleBoat);
-
     // [THROTTLE]
     scriptControl->WheelAxes[GET_AT(Throttle)] =
         parseWheelItem<std::string>(ini, "THROTTLE", "");
 
     LOAD_VAL("THROTTLE", "MIN", Wheel.Throttle.Min);
     LOAD_VAL("THROTTLE", "MAX", Wheel.Throttle.Max);
-    LOAD_VAL("THROTTLE", "ANTIDEADZONE", Wheel.Throttle.AntiDeadZone);
-    LOAD_VAL("THROTTLE", "GAMMA", Wheel.Throttle.Gamma);
 
     // [BRAKE]
     scriptControl->WheelAxes[GET_AT(Brake)] =
@@ -962,8 +455,6 @@ void ScriptSettings::parseSettingsWheel(CarControls *scriptControl) {
 
     LOAD_VAL("BRAKE", "MIN", Wheel.Brake.Min);
     LOAD_VAL("BRAKE", "MAX", Wheel.Brake.Max);
-    LOAD_VAL("BRAKE", "ANTIDEADZONE", Wheel.Brake.AntiDeadZone);
-    LOAD_VAL("BRAKE", "GAMMA", Wheel.Brake.Gamma);
 
     // [CLUTCH]
     scriptControl->WheelAxes[GET_AT(Clutch)] =
@@ -1139,13 +630,13 @@ void ScriptSettings::parseSettingsWheel(CarControls *scriptControl) {
         for (int i = 0; i < MAX_RGBBUTTONS; ++i) {
             const char* value = ini.GetValue("TO_KEYBOARD", fmt::format("DEV{}BUTTON{}", index, i).c_str(), nullptr);
             if (value) {
-                scriptControl->WheelToKey.push_back(CarControls::SInput<int>(value, guid, i, "", ""));
+                scriptControl->WheelToKey.emplace_back(value, guid, i);
             }
         }
         for (const auto& pov : WheelDirectInput::POVDirections) {
             const char* value = ini.GetValue("TO_KEYBOARD", fmt::format("DEV{}BUTTON{}", index, pov).c_str(), nullptr);
             if (value) {
-                scriptControl->WheelToKey.push_back(CarControls::SInput<int>(value, guid, pov, "", ""));
+                scriptControl->WheelToKey.emplace_back(value, guid, pov);
             }
         }
     }
@@ -8,9 +8,19 @@
 #include <vector>
 #include <string>
 
+enum class ESpeedoUnit {
+    Off,
+    Kph,
+    Mph,
+    Ms,
+};
+
+// Unknown strings turn the speedometer off.
+ESpeedoUnit ParseSpeedoUnit(const std::string& unit);
+
 class ScriptSettings {
 public:
-    ScriptSettings();
+    ScriptSettings() = default;
     void SetFiles(const std::string &general, const std::string& controls, const std::string &wheel);
     void Read(CarControls* scriptControl);
     void SaveGeneral();
@@ -123,6 +133,8 @@ public:
         struct {
             // can be kph, mph, or ms
             std::string Unit = "kph";
+            // Unit resolved on load, update both when changing it
+            ESpeedoUnit UnitType = ESpeedoUnit::Kph;
             bool ShowUnit = true;
             bool UseDrivetrain = true;
             float XPos = 0.860f;
@@ -299,6 +311,10 @@ public:
         bool UDPTelemetry = true;
         std::string UDPAddress = "127.0.0.1";
         int UDPPort = 20777;
+        // Record the telemetry to a compressed file in the Telemetry folder
+        bool TelemetryArchive = false;
+        // Publish the telemetry in shared memory for programs on this PC
+        bool SharedTelemetry = false;
 
         bool DashExtensions = true;
         bool SyncAnimations = true;
@@ -307,6 +323,9 @@ public:
         bool HideWheelInFPV = false;
 
         bool SaveFullConfig = true;
+
+        // Hz, tyre burst state and grip. Changes in wheel health or surface refresh right away.
+        float WheelStatusRate = 5.0f;
     } Misc;
 
     // [UPDATE]
@@ -345,6 +364,10 @@ public:
                 float PosY = 0.125f;
                 float Size = 0.200f;
             } GForce;
+            struct {
+                bool Enable = false;
+                bool Display = false;
+            } Profiler;
         } Metrics;
     } Debug;
 
@@ -378,6 +401,11 @@ public:
             float DetailMult = 4.0f;
             int DetailLim = 5000;
             int DetailMAW = 3;
+            // Surface texture: rumble strips, gravel, cobbles
+            float TextureMult = 1.0f;
+            int TextureLim = 2000;
+            // Lighter SAT on loose surfaces (grass, gravel, sand, mud)
+            bool SurfaceGripFeel = false;
             float CollisionMult = 2.5f;
 
             int AntiDeadForce = 0;
@@ -457,7 +485,7 @@ public:
     void SteeringAddWheelToKey(const std::string & conftag, ptrdiff_t index, int button, const std::string & keyName);
     bool SteeringClearWheelToKey(const std::string& assignment);
 private:
-    void parseSettingsGeneral();
+    void parseSettingsGeneral(CSimpleIniA& ini);
     void parseSettingsControls(CarControls* scriptControl);
     void parseSettingsWheel(CarControls *scriptControl);
 
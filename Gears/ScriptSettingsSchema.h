@@ -0,0 +1,279 @@
+#pragma once
+#include "SettingsSchema.h"
+
+/*
+ * ScriptSettings members that map one key to one member, per file. Legacy key names,
+ * bindings, device lists and other irregular entries are read and written by hand
+ * in ScriptSettings.cpp.
+ * Kept out of ScriptSettings.cpp so the standalone tests can round-trip them.
+ */
+namespace ScriptSettingsSchema {
+    // settings_general.ini
+    inline constexpr auto General = SettingsSchema::Make(
+        // [MT_OPTIONS]
+        SETTINGS_FIELD("MT_OPTIONS", "Enable", MTOptions.Enable),
+        SETTINGS_FIELD("MT_OPTIONS", "EngineDamage", MTOptions.EngDamage),
+        SETTINGS_FIELD("MT_OPTIONS", "EngineStalling", MTOptions.EngStallH),
+        SETTINGS_FIELD("MT_OPTIONS", "EngineStallingS", MTOptions.EngStallS),
+        SETTINGS_FIELD("MT_OPTIONS", "EngineBraking", MTOptions.EngBrake),
+        SETTINGS_FIELD("MT_OPTIONS", "EngineLocking", MTOptions.EngLock),
+        SETTINGS_FIELD("MT_OPTIONS", "FinalGearRPMLimit", MTOptions.FinalGearRPMLimit),
+
+        // [GAMEPLAY_ASSISTS]
+        SETTINGS_FIELD("GAMEPLAY_ASSISTS", "SimpleBike", GameAssists.SimpleBike),
+        SETTINGS_FIELD("GAMEPLAY_ASSISTS", "HillBrakeWorkaround", GameAssists.HillGravity),
+        SETTINGS_FIELD("GAMEPLAY_ASSISTS", "AutoGear1", GameAssists.AutoGear1),
+        SETTINGS_FIELD("GAMEPLAY_ASSISTS", "AutoLookBack", GameAssists.AutoLookBack),
+        SETTINGS_FIELD("GAMEPLAY_ASSISTS", "ThrottleStart", GameAssists.ThrottleStart),
+        SETTINGS_FIELD("GAMEPLAY_ASSISTS", "DefaultNeutral", GameAssists.DefaultNeutral),
+        SETTINGS_FIELD("GAMEPLAY_ASSISTS", "DisableAutostart", GameAssists.DisableAutostart),
+        SETTINGS_FIELD("GAMEPLAY_ASSISTS", "LeaveEngineRunning", GameAssists.LeaveEngineRunning),
+
+        // [CUSTOM_STEERING]
+        SETTINGS_FIELD("CUSTOM_STEERING", "Mode", CustomSteering.Mode),
+        SETTINGS_FIELD_RANGE("CUSTOM_STEERING", "CountersteerMult", CustomSteering.CountersteerMult, 0.0f, 2.0f),
+        SETTINGS_FIELD_RANGE("CUSTOM_STEERING", "CountersteerLimit", CustomSteering.CountersteerLimit, 0.0f, 360.0f),
+        SETTINGS_FIELD("CUSTOM_STEERING", "NoReductionHandbrake", CustomSteering.NoReductionHandbrake),
+        SETTINGS_FIELD_RANGE("CUSTOM_STEERING", "Gamma", CustomSteering.Gamma, 0.01f, 5.0f),
+        SETTINGS_FIELD_RANGE("CUSTOM_STEERING", "SteerTime", CustomSteering.SteerTime, 0.000001f, 0.90f),
+        SETTINGS_FIELD_RANGE("CUSTOM_STEERING", "CenterTime", CustomSteering.CenterTime, 0.000001f, 0.99f),
+        SETTINGS_FIELD("CUSTOM_STEERING", "MouseSteering", CustomSteering.Mouse.Enable),
+        SETTINGS_FIELD_RANGE("CUSTOM_STEERING", "MouseSensitivity", CustomSteering.Mouse.Sensitivity, 0.05f, 2.0f),
+        SETTINGS_FIELD("CUSTOM_STEERING", "MouseDisableSteerAssist", CustomSteering.Mouse.DisableSteerAssist),
+        SETTINGS_FIELD("CUSTOM_STEERING", "MouseDisableReduction", CustomSteering.Mouse.DisableReduction),
+
+        // [HUD]
+        SETTINGS_FIELD("HUD", "EnableHUD", HUD.Enable),
+        SETTINGS_FIELD("HUD", "AlwaysHUD", HUD.Always),
+        SETTINGS_FIELD("HUD", "HUDFont", HUD.Font),
+        SETTINGS_FIELD("HUD", "Outline", HUD.Outline),
+        SETTINGS_FIELD("HUD", "NotifyLevel", HUD.NotifyLevel),
+        SETTINGS_FIELD("HUD", "GearIndicator", HUD.Gear.Enable),
+        SETTINGS_FIELD_RANGE("HUD", "GearXpos", HUD.Gear.XPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "GearYpos", HUD.Gear.YPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "GearSize", HUD.Gear.Size, 0.0f, 3.0f),
+        SETTINGS_FIELD("HUD", "GearTopColorR", HUD.Gear.TopColorR),
+        SETTINGS_FIELD("HUD", "GearTopColorG", HUD.Gear.TopColorG),
+        SETTINGS_FIELD("HUD", "GearTopColorB", HUD.Gear.TopColorB),
+        SETTINGS_FIELD("HUD", "GearColorR", HUD.Gear.ColorR),
+        SETTINGS_FIELD("HUD", "GearColorG", HUD.Gear.ColorG),
+        SETTINGS_FIELD("HUD", "GearColorB", HUD.Gear.ColorB),
+        SETTINGS_FIELD("HUD", "ShiftModeIndicator", HUD.ShiftMode.Enable),
+        SETTINGS_FIELD_RANGE("HUD", "ShiftModeXpos", HUD.ShiftMode.XPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "ShiftModeYpos", HUD.ShiftMode.YPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "ShiftModeSize", HUD.ShiftMode.Size, 0.0f, 3.0f),
+        SETTINGS_FIELD("HUD", "ShiftModeColorR", HUD.ShiftMode.ColorR),
+        SETTINGS_FIELD("HUD", "ShiftModeColorG", HUD.ShiftMode.ColorG),
+        SETTINGS_FIELD("HUD", "ShiftModeColorB", HUD.ShiftMode.ColorB),
+        SETTINGS_FIELD("HUD", "SpeedoShowUnit", HUD.Speedo.ShowUnit),
+        SETTINGS_FIELD("HUD", "SpeedoUseDrivetrain", HUD.Speedo.UseDrivetrain),
+        SETTINGS_FIELD_RANGE("HUD", "SpeedoXpos", HUD.Speedo.XPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "SpeedoYpos", HUD.Speedo.YPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "SpeedoSize", HUD.Speedo.Size, 0.0f, 3.0f),
+        SETTINGS_FIELD("HUD", "SpeedoColorR", HUD.Speedo.ColorR),
+        SETTINGS_FIELD("HUD", "SpeedoColorG", HUD.Speedo.ColorG),
+        SETTINGS_FIELD("HUD", "SpeedoColorB", HUD.Speedo.ColorB),
+        SETTINGS_FIELD("HUD", "EnableRPMIndicator", HUD.RPMBar.Enable),
+        SETTINGS_FIELD_RANGE("HUD", "RPMIndicatorXpos", HUD.RPMBar.XPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "RPMIndicatorYpos", HUD.RPMBar.YPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "RPMIndicatorWidth", HUD.RPMBar.XSz, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "RPMIndicatorHeight", HUD.RPMBar.YSz, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "RPMIndicatorRedline", HUD.RPMBar.Redline, 0.0f, 1.0f),
+        SETTINGS_FIELD("HUD", "RPMIndicatorBackgroundR", HUD.RPMBar.BgR),
+        SETTINGS_FIELD("HUD", "RPMIndicatorBackgroundG", HUD.RPMBar.BgG),
+        SETTINGS_FIELD("HUD", "RPMIndicatorBackgroundB", HUD.RPMBar.BgB),
+        SETTINGS_FIELD("HUD", "RPMIndicatorBackgroundA", HUD.RPMBar.BgA),
+        SETTINGS_FIELD("HUD", "RPMIndicatorForegroundR", HUD.RPMBar.FgR),
+        SETTINGS_FIELD("HUD", "RPMIndicatorForegroundG", HUD.RPMBar.FgG),
+        SETTINGS_FIELD("HUD", "RPMIndicatorForegroundB", HUD.RPMBar.FgB),
+        SETTINGS_FIELD("HUD", "RPMIndicatorForegroundA", HUD.RPMBar.FgA),
+        SETTINGS_FIELD("HUD", "RPMIndicatorRedlineR", HUD.RPMBar.RedlineR),
+        SETTINGS_FIELD("HUD", "RPMIndicatorRedlineG", HUD.RPMBar.RedlineG),
+        SETTINGS_FIELD("HUD", "RPMIndicatorRedlineB", HUD.RPMBar.RedlineB),
+        SETTINGS_FIELD("HUD", "RPMIndicatorRedlineA", HUD.RPMBar.RedlineA),
+        SETTINGS_FIELD("HUD", "RPMIndicatorRevlimitR", HUD.RPMBar.RevLimitR),
+        SETTINGS_FIELD("HUD", "RPMIndicatorRevlimitG", HUD.RPMBar.RevLimitG),
+        SETTINGS_FIELD("HUD", "RPMIndicatorRevlimitB", HUD.RPMBar.RevLimitB),
+        SETTINGS_FIELD("HUD", "RPMIndicatorRevlimitA", HUD.RPMBar.RevLimitA),
+        SETTINGS_FIELD("HUD", "RPMIndicatorLaunchStagedR", HUD.RPMBar.LaunchControlStagedR),
+        SETTINGS_FIELD("HUD", "RPMIndicatorLaunchStagedG", HUD.RPMBar.LaunchControlStagedG),
+        SETTINGS_FIELD("HUD", "RPMIndicatorLaunchStagedB", HUD.RPMBar.LaunchControlStagedB),
+        SETTINGS_FIELD("HUD", "RPMIndicatorLaunchStagedA", HUD.RPMBar.LaunchControlStagedA),
+        SETTINGS_FIELD("HUD", "RPMIndicatorLaunchActiveR", HUD.RPMBar.LaunchControlActiveR),
+        SETTINGS_FIELD("HUD", "RPMIndicatorLaunchActiveG", HUD.RPMBar.LaunchControlActiveG),
+        SETTINGS_FIELD("HUD", "RPMIndicatorLaunchActiveB", HUD.RPMBar.LaunchControlActiveB),
+        SETTINGS_FIELD("HUD", "RPMIndicatorLaunchActiveA", HUD.RPMBar.LaunchControlActiveA),
+        SETTINGS_FIELD("HUD", "SteeringWheelInfo", HUD.Wheel.Enable),
+        SETTINGS_FIELD("HUD", "AlwaysSteeringWheelInfo", HUD.Wheel.Always),
+        SETTINGS_FIELD_RANGE("HUD", "SteeringWheelTextureX", HUD.Wheel.ImgXPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "SteeringWheelTextureY", HUD.Wheel.ImgYPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "SteeringWheelTextureSz", HUD.Wheel.ImgSize, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "PedalInfoX", HUD.Wheel.PedalXPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "PedalInfoY", HUD.Wheel.PedalYPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "PedalInfoH", HUD.Wheel.PedalYSz, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "PedalInfoW", HUD.Wheel.PedalXSz, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "PedalInfoPadX", HUD.Wheel.PedalXPad, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "PedalInfoPadY", HUD.Wheel.PedalYPad, 0.0f, 1.0f),
+        SETTINGS_FIELD("HUD", "PedalBackgroundA", HUD.Wheel.PedalBgA),
+        SETTINGS_FIELD("HUD", "PedalInfoThrottleR", HUD.Wheel.PedalThrottleR),
+        SETTINGS_FIELD("HUD", "PedalInfoThrottleG", HUD.Wheel.PedalThrottleG),
+        SETTINGS_FIELD("HUD", "PedalInfoThrottleB", HUD.Wheel.PedalThrottleB),
+        SETTINGS_FIELD("HUD", "PedalInfoThrottleA", HUD.Wheel.PedalThrottleA),
+        SETTINGS_FIELD("HUD", "PedalInfoBrakeR", HUD.Wheel.PedalBrakeR),
+        SETTINGS_FIELD("HUD", "PedalInfoBrakeG", HUD.Wheel.PedalBrakeG),
+        SETTINGS_FIELD("HUD", "PedalInfoBrakeB", HUD.Wheel.PedalBrakeB),
+        SETTINGS_FIELD("HUD", "PedalInfoBrakeA", HUD.Wheel.PedalBrakeA),
+        SETTINGS_FIELD("HUD", "PedalInfoClutchR", HUD.Wheel.PedalClutchR),
+        SETTINGS_FIELD("HUD", "PedalInfoClutchG", HUD.Wheel.PedalClutchG),
+        SETTINGS_FIELD("HUD", "PedalInfoClutchB", HUD.Wheel.PedalClutchB),
+        SETTINGS_FIELD("HUD", "PedalInfoClutchA", HUD.Wheel.PedalClutchA),
+        SETTINGS_FIELD("HUD", "FFBEnable", HUD.Wheel.FFB.Enable),
+        SETTINGS_FIELD_RANGE("HUD", "FFBXPos", HUD.Wheel.FFB.XPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "FFBYPos", HUD.Wheel.FFB.YPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "FFBXSz", HUD.Wheel.FFB.XSz, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "FFBYSz", HUD.Wheel.FFB.YSz, 0.0f, 1.0f),
+        SETTINGS_FIELD("HUD", "FFBBgR", HUD.Wheel.FFB.BgR),
+        SETTINGS_FIELD("HUD", "FFBBgG", HUD.Wheel.FFB.BgG),
+        SETTINGS_FIELD("HUD", "FFBBgB", HUD.Wheel.FFB.BgB),
+        SETTINGS_FIELD("HUD", "FFBBgA", HUD.Wheel.FFB.BgA),
+        SETTINGS_FIELD("HUD", "FFBFgR", HUD.Wheel.FFB.FgR),
+        SETTINGS_FIELD("HUD", "FFBFgG", HUD.Wheel.FFB.FgG),
+        SETTINGS_FIELD("HUD", "FFBFgB", HUD.Wheel.FFB.FgB),
+        SETTINGS_FIELD("HUD", "FFBFgA", HUD.Wheel.FFB.FgA),
+        SETTINGS_FIELD("HUD", "FFBLimitR", HUD.Wheel.FFB.LimitR),
+        SETTINGS_FIELD("HUD", "FFBLimitG", HUD.Wheel.FFB.LimitG),
+        SETTINGS_FIELD("HUD", "FFBLimitB", HUD.Wheel.FFB.LimitB),
+        SETTINGS_FIELD("HUD", "FFBLimitA", HUD.Wheel.FFB.LimitA),
+        SETTINGS_FIELD("HUD", "DashIndicators", HUD.DashIndicators.Enable),
+        SETTINGS_FIELD_RANGE("HUD", "DashIndicatorsXpos", HUD.DashIndicators.XPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "DashIndicatorsYpos", HUD.DashIndicators.YPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "DashIndicatorsSize", HUD.DashIndicators.Size, 0.25f, 4.0f),
+        SETTINGS_FIELD("HUD", "DashIndicatorsLite", HUD.DashIndicators.Lite),
+        SETTINGS_FIELD_RANGE("HUD", "DashIndicatorsVOff", HUD.DashIndicators.TxtVOffset, -1.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "DashIndicatorsTMul", HUD.DashIndicators.TxtSzMod, 0.0f, 10.0f),
+        SETTINGS_FIELD("HUD", "DsProtEnable", HUD.DsProt.Enable),
+        SETTINGS_FIELD_RANGE("HUD", "DsProtXpos", HUD.DsProt.XPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "DsProtYpos", HUD.DsProt.YPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "DsProtSize", HUD.DsProt.Size, 0.01f, 1.0f),
+        SETTINGS_FIELD("HUD", "MouseEnable", HUD.MouseSteering.Enable),
+        SETTINGS_FIELD_RANGE("HUD", "MouseXPos", HUD.MouseSteering.XPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "MouseYPos", HUD.MouseSteering.YPos, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "MouseXSz", HUD.MouseSteering.XSz, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "MouseYSz", HUD.MouseSteering.YSz, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("HUD", "MouseMarkerXSz", HUD.MouseSteering.MarkerXSz, 0.0f, 1.0f),
+        SETTINGS_FIELD("HUD", "MouseBgR", HUD.MouseSteering.BgR),
+        SETTINGS_FIELD("HUD", "MouseBgG", HUD.MouseSteering.BgG),
+        SETTINGS_FIELD("HUD", "MouseBgB", HUD.MouseSteering.BgB),
+        SETTINGS_FIELD("HUD", "MouseBgA", HUD.MouseSteering.BgA),
+        SETTINGS_FIELD("HUD", "MouseFgR", HUD.MouseSteering.FgR),
+        SETTINGS_FIELD("HUD", "MouseFgG", HUD.MouseSteering.FgG),
+        SETTINGS_FIELD("HUD", "MouseFgB", HUD.MouseSteering.FgB),
+        SETTINGS_FIELD("HUD", "MouseFgA", HUD.MouseSteering.FgA),
+
+        // [MISC]
+        SETTINGS_FIELD("MISC", "UDPTelemetry", Misc.UDPTelemetry),
+        SETTINGS_FIELD("MISC", "UDPAddress", Misc.UDPAddress),
+        SETTINGS_FIELD("MISC", "UDPPort", Misc.UDPPort),
+        SETTINGS_FIELD("MISC", "TelemetryArchive", Misc.TelemetryArchive),
+        SETTINGS_FIELD("MISC", "SharedTelemetry", Misc.SharedTelemetry),
+        SETTINGS_FIELD("MISC", "DashExtensions", Misc.DashExtensions),
+        SETTINGS_FIELD("MISC", "SyncAnimations", Misc.SyncAnimations),
+        SETTINGS_FIELD("MISC", "HidePlayerInFPV", Misc.HidePlayerInFPV),
+        SETTINGS_FIELD("MISC", "HideWheelInFPV", Misc.HideWheelInFPV),
+        SETTINGS_FIELD("MISC", "SaveFullConfig", Misc.SaveFullConfig),
+        SETTINGS_FIELD_RANGE("MISC", "WheelStatusRate", Misc.WheelStatusRate, 1.0f, 60.0f),
+
+        // [UPDATE]
+        SETTINGS_FIELD("UPDATE", "EnableUpdate", Update.EnableUpdate),
+
+        // [DEBUG]
+        SETTINGS_FIELD("DEBUG", "DisplayInfo", Debug.DisplayInfo),
+        SETTINGS_FIELD("DEBUG", "DisplayWheelInfo", Debug.DisplayWheelInfo),
+        SETTINGS_FIELD("DEBUG", "DisplayMaterialInfo", Debug.DisplayMaterialInfo),
+        SETTINGS_FIELD("DEBUG", "DisplayTractionInfo", Debug.DisplayTractionInfo),
+        SETTINGS_FIELD("DEBUG", "DisplayGearingInfo", Debug.DisplayGearingInfo),
+        SETTINGS_FIELD("DEBUG", "DisplayNPCInfo", Debug.DisplayNPCInfo),
+        SETTINGS_FIELD("DEBUG", "ShowAdvancedFFBOptions", Debug.ShowAdvancedFFBOptions),
+        SETTINGS_FIELD("DEBUG", "DisableRPMLimit", Debug.DisableRPMLimit),
+        SETTINGS_FIELD("DEBUG", "DisableInputDetect", Debug.DisableInputDetect),
+        SETTINGS_FIELD("DEBUG", "DisablePlayerHide", Debug.DisablePlayerHide),
+        SETTINGS_FIELD("DEBUG", "DisableNPCGearbox", Debug.DisableNPCGearbox),
+        SETTINGS_FIELD("DEBUG", "DisableNPCBrake", Debug.DisableNPCBrake),
+        SETTINGS_FIELD("DEBUG", "EnableTimers", Debug.Metrics.EnableTimers),
+        SETTINGS_FIELD("DEBUG", "EnableGForce", Debug.Metrics.GForce.Enable),
+        SETTINGS_FIELD("DEBUG", "GForcePosX", Debug.Metrics.GForce.PosX),
+        SETTINGS_FIELD("DEBUG", "GForcePosY", Debug.Metrics.GForce.PosY),
+        SETTINGS_FIELD("DEBUG", "GForceSize", Debug.Metrics.GForce.Size),
+        SETTINGS_FIELD("DEBUG", "EnableProfiler", Debug.Metrics.Profiler.Enable),
+        SETTINGS_FIELD("DEBUG", "DisplayProfiler", Debug.Metrics.Profiler.Display)
+    );
+
+    // settings_controls.ini
+    inline constexpr auto Controls = SettingsSchema::Make(
+        // [CONTROLLER]
+        SETTINGS_FIELD_RANGE("CONTROLLER", "HoldTimeMs", Controller.HoldTimeMs, 100.0f, 5000.0f),
+        SETTINGS_FIELD_RANGE("CONTROLLER", "MaxTapTimeMs", Controller.MaxTapTimeMs, 50.0f, 1000.0f),
+        SETTINGS_FIELD_RANGE("CONTROLLER", "TriggerValue", Controller.TriggerValue, 0.25f, 1.0f),
+        SETTINGS_FIELD("CONTROLLER", "ToggleEngine", Controller.ToggleEngine),
+        SETTINGS_FIELD("CONTROLLER", "BlockCarControls", Controller.BlockCarControls),
+        SETTINGS_FIELD("CONTROLLER", "IgnoreShiftsUI", Controller.IgnoreShiftsUI),
+        SETTINGS_FIELD("CONTROLLER", "BlockHShift", Controller.BlockHShift),
+        SETTINGS_FIELD("CONTROLLER", "CustomDeadzone", Controller.CustomDeadzone),
+        SETTINGS_FIELD("CONTROLLER", "DeadzoneLeftThumb", Controller.DeadzoneLeftThumb),
+        SETTINGS_FIELD("CONTROLLER", "DeadzoneRightThumb", Controller.DeadzoneRightThumb),
+
+        // [CONTROLLER_NATIVE]
+        SETTINGS_FIELD("CONTROLLER_NATIVE", "Enable", Controller.Native.Enable)
+    );
+
+    // settings_wheel.ini
+    inline constexpr auto Wheel = SettingsSchema::Make(
+        // [MT_OPTIONS]
+        SETTINGS_FIELD("MT_OPTIONS", "EnableWheel", Wheel.Options.Enable),
+        SETTINGS_FIELD("MT_OPTIONS", "LogitechLEDs", Wheel.Options.LogiLEDs),
+        SETTINGS_FIELD("MT_OPTIONS", "HPatternKeyboard", Wheel.Options.HPatternKeyboard),
+        SETTINGS_FIELD("MT_OPTIONS", "UseShifterForAuto", Wheel.Options.UseShifterForAuto),
+
+        // [FORCE_FEEDBACK]
+        SETTINGS_FIELD("FORCE_FEEDBACK", "Enable", Wheel.FFB.Enable),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "SATAmpMult", Wheel.FFB.SATAmpMult, 0.05f, 10.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "DamperMax", Wheel.FFB.DamperMax, 0.0f, 200.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "DamperMin", Wheel.FFB.DamperMin, 0.0f, 200.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "DamperMinSpeed", Wheel.FFB.DamperMinSpeed, 0.0f, 40.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "DetailMult", Wheel.FFB.DetailMult, 0.0f, 10.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "DetailLim", Wheel.FFB.DetailLim, 0.0f, 20000.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "DetailMaw", Wheel.FFB.DetailMAW, 1.0f, 100.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "TextureMult", Wheel.FFB.TextureMult, 0.0f, 5.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "TextureLim", Wheel.FFB.TextureLim, 0.0f, 10000.0f),
+        SETTINGS_FIELD("FORCE_FEEDBACK", "SurfaceGripFeel", Wheel.FFB.SurfaceGripFeel),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "CollisionMult", Wheel.FFB.CollisionMult, 0.0f, 10.0f),
+        SETTINGS_FIELD("FORCE_FEEDBACK", "AntiDeadForce", Wheel.FFB.AntiDeadForce),
+        SETTINGS_FIELD("FORCE_FEEDBACK", "FFBProfile", Wheel.FFB.FFBProfile),
+        SETTINGS_FIELD("FORCE_FEEDBACK", "ResponseCurve", Wheel.FFB.ResponseCurve),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "SlipOptMin", Wheel.FFB.SlipOptMin, 0.0f, 90.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "SlipOptMinMult", Wheel.FFB.SlipOptMinMult, 0.0f, 10.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "SlipOptMax", Wheel.FFB.SlipOptMax, 0.0f, 90.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "SlipOptMaxMult", Wheel.FFB.SlipOptMaxMult, 0.0f, 10.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "SATFactor", Wheel.FFB.SATFactor, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "Gamma", Wheel.FFB.Gamma, 0.01f, 2.0f),
+        SETTINGS_FIELD_RANGE("FORCE_FEEDBACK", "MaxSpeed", Wheel.FFB.MaxSpeed, 10.0f, 1000.0f),
+
+        // [STEER]
+        SETTINGS_FIELD("STEER", "ANTIDEADZONE", Wheel.Steering.AntiDeadZone),
+        SETTINGS_FIELD_RANGE("STEER", "DEADZONE", Wheel.Steering.DeadZone, 0.0f, 0.5f),
+        SETTINGS_FIELD_RANGE("STEER", "DEADZONEOFFSET", Wheel.Steering.DeadZoneOffset, -0.5f, 0.5f),
+        SETTINGS_FIELD("STEER", "SteerAngleMax", Wheel.Steering.AngleMax),
+        SETTINGS_FIELD("STEER", "SteerAngleCar", Wheel.Steering.AngleCar),
+        SETTINGS_FIELD("STEER", "SteerAngleBike", Wheel.Steering.AngleBike),
+        SETTINGS_FIELD("STEER", "SteerAngleBoat", Wheel.Steering.AngleBoat),
+        SETTINGS_FIELD("STEER", "GAMMA", Wheel.Steering.Gamma),
+
+        // [THROTTLE]
+        SETTINGS_FIELD("THROTTLE", "GAMMA", Wheel.Throttle.Gamma),
+        SETTINGS_FIELD_RANGE("THROTTLE", "ANTIDEADZONE", Wheel.Throttle.AntiDeadZone, 0.0f, 1.0f),
+
+        // [BRAKE]
+        SETTINGS_FIELD("BRAKE", "GAMMA", Wheel.Brake.Gamma),
+        SETTINGS_FIELD_RANGE("BRAKE", "ANTIDEADZONE", Wheel.Brake.AntiDeadZone, 0.0f, 1.0f)
+    );
+}
@@ -0,0 +1,172 @@
+#pragma once
+#include "SettingsCommon.h"
+#include "Util/Logger.hpp"
+
+#include <simpleini/SimpleIni.h>
+#include <fmt/format.h>
+
+#include <limits>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+/*
+ * Compile-time table of INI-backed settings, so loading, saving and comparing all
+ * come from one list instead of separate hand-written LOAD_VAL/SAVE_VAL blocks.
+ * A field is a section, key, accessor to the member and an optional valid range.
+ * Accessors are captureless lambdas rather than member pointers, since most settings
+ * sit in nested anonymous structs that a member pointer can't name from the owner.
+ * Plain values (int, float, bool, std::string), enums and Tracked<T> are supported.
+ * All functions work on an already parsed document, so one file is parsed once.
+ */
+namespace SettingsSchema {
+    constexpr float NoLimit = std::numeric_limits<float>::quiet_NaN();
+
+    template <typename TAccess>
+    struct Field {
+        const char* Section;
+        const char* Key;
+        TAccess Access;
+        // Expected range, usually the menu limits. NoLimit skips the check.
+        float Min = NoLimit;
+        float Max = NoLimit;
+    };
+
+    template <typename TAccess>
+    constexpr Field<TAccess> MakeField(const char* section, const char* key, TAccess access,
+        float min = NoLimit, float max = NoLimit) {
+        return Field<TAccess>{ section, key, access, min, max };
+    }
+
+    template <typename... TFields>
+    constexpr auto Make(TFields... fields) {
+        return std::make_tuple(fields...);
+    }
+
+    template <typename TSchema>
+    constexpr size_t Size(const TSchema&) {
+        return std::tuple_size_v<TSchema>;
+    }
+
+    template <typename TSchema, typename TFunc>
+    void ForEach(const TSchema& schema, TFunc&& func) {
+        std::apply([&](const auto&... fields) { (func(fields), ...); }, schema);
+    }
+
+    namespace detail {
+        template <typename T>
+        concept Tracked = requires(T t) { t.Value(); t.Set(t.Value()); t.Reset(); };
+
+        // The stored value of a field, Tracked<T> unwrapped.
+        template <typename T>
+        auto Plain(const T& value) {
+            if constexpr (Tracked<T>)
+                return value.Value();
+            else
+                return value;
+        }
+
+        template <typename T>
+        auto Read(CSimpleIniA& ini, const char* section, const char* key, const T& fallback) {
+            if constexpr (std::is_enum_v<T>)
+                return static_cast<T>(GetValue(ini, section, key, static_cast<int>(fallback)));
+            else
+                return GetValue(ini, section, key, fallback);
+        }
+
+        template <typename T>
+        void Write(CSimpleIniA& ini, const char* section, const char* key, const T& value) {
+            if constexpr (std::is_enum_v<T>)
+                SetValue(ini, section, key, static_cast<int>(value));
+            else
+                SetValue(ini, section, key, value);
+        }
+
+        template <typename T>
+        std::string Format(const T& value) {
+            if constexpr (std::is_enum_v<T>)
+                return fmt::format("{}", static_cast<int>(value));
+            else
+                return fmt::format("{}", value);
+        }
+    }
+
+    // Reads every field from ini into owner. Missing keys take the value from fallback,
+    // which may be owner itself. Values outside the field range are kept, but logged.
+    template <typename TSchema, typename TOwner>
+    void Load(CSimpleIniA& ini, const TSchema& schema, TOwner& owner, const TOwner& fallback,
+        const char* source) {
+        ForEach(schema, [&](const auto& field) {
+            auto& value = field.Access(owner);
+            auto loaded = detail::Read(ini, field.Section, field.Key, detail::Plain(field.Access(fallback)));
+
+            if constexpr (detail::Tracked<std::remove_reference_t<decltype(value)>>)
+                value.Set(loaded);
+            else
+                value = loaded;
+
+            if constexpr (std::is_arithmetic_v<decltype(loaded)> && !std::is_same_v<decltype(loaded), bool>) {
+                float asFloat = static_cast<float>(loaded);
+                if (asFloat < field.Min || asFloat > field.Max) {
+                    logger.Write(WARN, "[Settings] [%s] %s/%s: %s is outside [%g, %g]",
+                        source, field.Section, field.Key, detail::Format(loaded).c_str(),
+                        static_cast<double>(field.Min), static_cast<double>(field.Max));
+                }
+            }
+        });
+    }
+
+    template <typename TSchema, typename TOwner>
+    void Load(CSimpleIniA& ini, const TSchema& schema, TOwner& owner, const char* source) {
+        Load(ini, schema, owner, owner, source);
+    }
+
+    // Writes the fields for which shouldSave(value, baseValue) is true.
+    // Tracked<T> fields are marked unchanged once written.
+    template <typename TSchema, typename TOwner, typename TPredicate>
+    void Save(CSimpleIniA& ini, const TSchema& schema, TOwner& owner, const std::remove_const_t<TOwner>& base,
+        TPredicate&& shouldSave) {
+        ForEach(schema, [&](const auto& field) {
+            auto& value = field.Access(owner);
+            if (!shouldSave(value, field.Access(base)))
+                return;
+
+            detail::Write(ini, field.Section, field.Key, detail::Plain(value));
+            if constexpr (detail::Tracked<std::remove_reference_t<decltype(value)>>)
+                value.Reset();
+        });
+    }
+
+    template <typename TSchema, typename TOwner>
+    void Save(CSimpleIniA& ini, const TSchema& schema, TOwner& owner) {
+        Save(ini, schema, owner, owner, [](const auto&, const auto&) { return true; });
+    }
+
+    // Calls onDiff(section, key, aValue, bValue) for every field that differs,
+    // with the values formatted as they'd be written.
+    template <typename TSchema, typename TOwner, typename TFunc>
+    size_t Diff(const TSchema& schema, const TOwner& a, const TOwner& b, TFunc&& onDiff) {
+        size_t numDiffs = 0;
+        ForEach(schema, [&](const auto& field) {
+            auto aValue = detail::Plain(field.Access(a));
+            auto bValue = detail::Plain(field.Access(b));
+            if (aValue == bValue)
+                return;
+
+            ++numDiffs;
+            onDiff(field.Section, field.Key, detail::Format(aValue), detail::Format(bValue));
+        });
+        return numDiffs;
+    }
+
+    template <typename TSchema, typename TOwner>
+    size_t Diff(const TSchema& schema, const TOwner& a, const TOwner& b) {
+        return Diff(schema, a, b, [](const char*, const char*, const std::string&, const std::string&) {});
+    }
+}
+
+#define SETTINGS_FIELD(section, key, member) \
+    SettingsSchema::MakeField(section, key, [](auto& o) -> auto& { return o.member; })
+
+#define SETTINGS_FIELD_RANGE(section, key, member, min, max) \
+    SettingsSchema::MakeField(section, key, [](auto& o) -> auto& { return o.member; }, min, max)
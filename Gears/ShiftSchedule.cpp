@@ -0,0 +1,32 @@
+#include "ShiftSchedule.h"
+
+#include "Util/MathExt.h"
+
+#include <algorithm>
+
+float ShiftSchedule::UpshiftSpeed(int gear, float throttle) const {
+    return lookup(Upshift, gear, throttle);
+}
+
+float ShiftSchedule::DownshiftSpeed(int gear, float throttle) const {
+    return lookup(Downshift, gear, throttle);
+}
+
+float ShiftSchedule::lookup(const std::vector<std::vector<float>>& lines, int gear, float throttle) const {
+    if (gear < 0 || gear >= static_cast<int>(lines.size()))
+        return -1.0f;
+
+    const auto& line = lines[gear];
+    if (line.empty() || line.size() != Throttle.size())
+        return -1.0f;
+
+    if (throttle <= Throttle.front())
+        return line.front();
+    if (throttle >= Throttle.back())
+        return line.back();
+
+    auto upper = std::upper_bound(Throttle.begin(), Throttle.end(), throttle);
+    size_t hi = static_cast<size_t>(upper - Throttle.begin());
+    size_t lo = hi - 1;
+    return map(throttle, Throttle[lo], Throttle[hi], line[lo], line[hi]);
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <vector>
+
+/*
+ * Throttle x speed shift map for the automatic gearbox, like a TCU shift schedule.
+ * Every gear can have an upshift and a downshift line: the speed (m/s) to shift
+ * at, for each throttle breakpoint. Values between breakpoints are interpolated
+ * linearly, outside the breakpoints the nearest value is used.
+ */
+struct ShiftSchedule {
+    // Ascending, 0.0 to 1.0
+    std::vector<float> Throttle;
+
+    // Index is gear. Empty for gears without a line.
+    std::vector<std::vector<float>> Upshift;
+    std::vector<std::vector<float>> Downshift;
+
+    bool Empty() const { return Throttle.empty(); }
+
+    // Negative when the gear has no line.
+    float UpshiftSpeed(int gear, float throttle) const;
+    float DownshiftSpeed(int gear, float throttle) const;
+
+private:
+    float lookup(const std::vector<std::vector<float>>& lines, int gear, float throttle) const;
+};
@@ -5,6 +5,7 @@
 #include "Input/CarControls.hpp"
 #include "Util/MathExt.h"
 #include "Util/UIUtils.h"
+#include "Util/NativeCache.h"
 
 #include <inc/enums.h>
 #include <inc/natives.h>
@@ -26,7 +27,7 @@ bool SpeedLimiter::Update(float& throttle) {
     // 5 kph min buffer
     if (g_vehData.mVelocity.y > targetSetpoint - (5.0f / 3.6f) && throttle > limitThrottle) {
         float targetAcceleration = (targetSetpoint - g_vehData.mVelocity.y);
-        limitThrottle = std::clamp(limitThrottle + (targetAcceleration - g_vehData.mAcceleration.y) * MISC::GET_FRAME_TIME(), -1.0f, 1.0f);
+        limitThrottle = std::clamp(limitThrottle + (targetAcceleration - g_vehData.mAcceleration.y) * NativeCache::GetFrameTime(), -1.0f, 1.0f);
         float newThrottle = std::clamp(throttle + limitThrottle, 0.0f, 1.0f);
 
         if (newThrottle < throttle) {
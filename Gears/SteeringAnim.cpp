@@ -20,6 +20,7 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <cmath>
 #include <filesystem>
 
 extern Vehicle g_playerVehicle;
@@ -43,12 +44,30 @@ namespace {
         CTaskCloseVehicleDoorFromInside = 164,
     };
 
+    enum class eAnimState {
+        Stopped,    // None of ours playing
+        Starting,   // Task given, waiting for the ped to play it
+        Playing,    // Anim time follows the wheel
+    };
+
+    // Smallest steering wheel rotation (degrees) worth a SET_ENTITY_ANIM_CURRENT_TIME.
+    constexpr float visibleRotation = 0.2f;
+    // The game drops the task by itself (phone, getting out), so check once in a while
+    // instead of every tick. Also how long a task may take to start.
+    constexpr int64_t playingCheckInterval = 250;
+
     std::vector<SteeringAnimation::Animation> steeringAnimations;
     SteeringAnimation::Animation lastAnimation;
     size_t steeringAnimIdx = 0;
     float setAngle = 0.0f;
     bool fileProblem = false;
     bool skipThisFrame = false;
+
+    eAnimState animState = eAnimState::Stopped;
+    // Anim time last given to the game, negative to force the next one.
+    float lastAnimTime = -1.0f;
+    Timer playingCheckTimer(playingCheckInterval);
+    std::vector<std::string> loadedDictionaries;
 }
 
 namespace YAML {
@@ -66,6 +85,7 @@ namespace YAML {
 
 void playAnimTime(const SteeringAnimation::Animation& anim, float time);
 void cancelAnim(const SteeringAnimation::Animation& anim);
+void loadDictionaries();
 float mapAnim(float wheelDegrees, float maxAnimAngle);
 
 void SteeringAnimation::SetFile(const std::string& cs) {
@@ -154,6 +174,8 @@ void SteeringAnimation::Load() {
         steeringAnimations = animRoot["Animations"].as<std::vector<Animation>>();
         logger.Write(DEBUG, fmt::format("Animation: Loaded {} animations", steeringAnimations.size()));
         fileProblem = false;
+
+        loadDictionaries();
     }
     catch (const YAML::ParserException& ex) {
         logger.Write(ERROR, fmt::format("Encountered a YAML exception (parse)"));
@@ -167,7 +189,46 @@ void SteeringAnimation::Load() {
     }
 }
 
+// Requests every dictionary up front, so starting an animation doesn't wait for
+// streaming. Requested dictionaries stay loaded until removed.
+void loadDictionaries() {
+    std::vector<std::string> dictionaries;
+    for (auto& anim : steeringAnimations) {
+        if (anim.Dictionary.empty())
+            continue;
+
+        if (!STREAMING::DOES_ANIM_DICT_EXIST(anim.Dictionary.c_str())) {
+            UI::Notify(ERROR, fmt::format("Animation: dictionary does not exist [{}]", anim.Dictionary), false);
+            logger.Write(ERROR, fmt::format("Animation: dictionary does not exist [{}]", anim.Dictionary));
+            // Clear dict so we don't keep loading it
+            anim.Dictionary = std::string();
+            continue;
+        }
+
+        if (std::find(dictionaries.begin(), dictionaries.end(), anim.Dictionary) == dictionaries.end()) {
+            STREAMING::REQUEST_ANIM_DICT(anim.Dictionary.c_str());
+            dictionaries.push_back(anim.Dictionary);
+        }
+    }
+
+    // Release what a previous file used and this one doesn't
+    for (const auto& dictionary : loadedDictionaries) {
+        if (std::find(dictionaries.begin(), dictionaries.end(), dictionary) == dictionaries.end())
+            STREAMING::REMOVE_ANIM_DICT(dictionary.c_str());
+    }
+
+    loadedDictionaries = std::move(dictionaries);
+    logger.Write(DEBUG, fmt::format("Animation: Requested {} dictionaries", loadedDictionaries.size()));
+}
+
 void cancelAnim(const SteeringAnimation::Animation& anim) {
+    if (animState == eAnimState::Stopped) {
+        return;
+    }
+
+    animState = eAnimState::Stopped;
+    lastAnimTime = -1.0f;
+
     if (anim.Dictionary.empty() || anim.Name.empty()) {
         return;
     }
@@ -175,13 +236,12 @@ void cancelAnim(const SteeringAnimation::Animation& anim) {
     const char* dict = anim.Dictionary.c_str();
     const char* name = anim.Name.c_str();
 
-    const bool playing = ENTITY::IS_ENTITY_PLAYING_ANIM(g_playerPed, dict, name, 3);
-
-    if (playing) {
-        UI::Notify(DEBUG, fmt::format("Cancelled steering animation ({})", lastAnimation.Dictionary), false);
+    // Once per stop instead of every tick, the state says if there's anything to stop.
+    if (ENTITY::IS_ENTITY_PLAYING_ANIM(g_playerPed, dict, name, 3)) {
+        UI::Notify(DEBUG, fmt::format("Cancelled steering animation ({})", anim.Dictionary), false);
         TASK::STOP_ANIM_TASK(g_playerPed, dict, name, -8.0f);
-        lastAnimation = SteeringAnimation::Animation();
     }
+    lastAnimation = SteeringAnimation::Animation();
 }
 
 void playAnimTime(const SteeringAnimation::Animation& anim, float time) {
@@ -192,38 +252,64 @@ void playAnimTime(const SteeringAnimation::Animation& anim, float time) {
     const char* dict = anim.Dictionary.c_str();
     const char* name = anim.Name.c_str();
 
-    const bool playing = ENTITY::IS_ENTITY_PLAYING_ANIM(g_playerPed, dict, name, 3);
-
-    if (!playing) {
-        cancelAnim(lastAnimation);
+    switch (animState) {
+        case eAnimState::Stopped: {
+            // Normally loaded since Load(), unless the game dropped it.
+            if (!STREAMING::HAS_ANIM_DICT_LOADED(dict)) {
+                STREAMING::REQUEST_ANIM_DICT(dict);
+                return;
+            }
+
+            // Fix for if anim is playing while the script starts
+            if (!ENTITY::IS_ENTITY_PLAYING_ANIM(g_playerPed, dict, name, 3)) {
+                constexpr int flag = ANIM_FLAG_ENABLE_PLAYER_CONTROL;
+                TASK::TASK_PLAY_ANIM(g_playerPed, dict, name, -8.0f, 8.0f, -1, flag, 1.0f, 0, 0, 0);
+                UI::Notify(DEBUG, fmt::format("Started steering animation ({})", anim.Dictionary), false);
+            }
 
-        if (!STREAMING::DOES_ANIM_DICT_EXIST(dict)) {
-            UI::Notify(ERROR, fmt::format("Animation: dictionary does not exist [{}]", dict), false);
-            logger.Write(ERROR, fmt::format("Animation: dictionary does not exist [{}]", dict));
-            // Clear dict so we don't keep loading it
-            steeringAnimations[steeringAnimIdx].Dictionary = std::string();
+            lastAnimation = anim;
+            animState = eAnimState::Starting;
+            playingCheckTimer.Reset();
             return;
         }
-
-        STREAMING::REQUEST_ANIM_DICT(dict);
-        if (!STREAMING::HAS_ANIM_DICT_LOADED(dict)) {
-            return;
+        case eAnimState::Starting: {
+            if (!ENTITY::IS_ENTITY_PLAYING_ANIM(g_playerPed, dict, name, 3)) {
+                // Try again if the ped never picked it up
+                if (playingCheckTimer.Expired())
+                    animState = eAnimState::Stopped;
+                return;
+            }
+
+            animState = eAnimState::Playing;
+            lastAnimTime = -1.0f;
+            playingCheckTimer.Reset();
+            break;
+        }
+        case eAnimState::Playing: {
+            if (playingCheckTimer.Expired()) {
+                playingCheckTimer.Reset();
+                if (!ENTITY::IS_ENTITY_PLAYING_ANIM(g_playerPed, dict, name, 3)) {
+                    animState = eAnimState::Stopped;
+                    lastAnimation = SteeringAnimation::Animation();
+                    return;
+                }
+                // Still ours, refresh speed and time in case something else touched them.
+                lastAnimTime = -1.0f;
+            }
+            break;
         }
-
-        constexpr int flag = ANIM_FLAG_ENABLE_PLAYER_CONTROL;
-        TASK::TASK_PLAY_ANIM(g_playerPed, dict, name, -8.0f, 8.0f, -1, flag, 1.0f, 0, 0, 0);
-        lastAnimation = anim;
-        UI::Notify(DEBUG, fmt::format("Started steering animation ({})", lastAnimation.Dictionary), false);
     }
-    else {
-        ENTITY::SET_ENTITY_ANIM_SPEED(g_playerPed, dict, name, 0.0f);
-        ENTITY::SET_ENTITY_ANIM_CURRENT_TIME(g_playerPed, dict, name, time);
 
-        // Fix for if anim is playing while the script starts
-        if (lastAnimation.Dictionary.empty()) {
-            lastAnimation = anim;
-        }
+    // Only on a change the player can see
+    float epsilon = anim.Rotation > 0.0f ? visibleRotation / anim.Rotation : 0.0f;
+    if (lastAnimTime >= 0.0f && std::abs(time - lastAnimTime) <= epsilon) {
+        return;
     }
+
+    if (lastAnimTime < 0.0f)
+        ENTITY::SET_ENTITY_ANIM_SPEED(g_playerPed, dict, name, 0.0f);
+    ENTITY::SET_ENTITY_ANIM_CURRENT_TIME(g_playerPed, dict, name, time);
+    lastAnimTime = time;
 }
 
 // map
@@ -0,0 +1,182 @@
+#include "SharedTelemetry.h"
+
+#include "../Util/Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+using namespace SharedTelemetry;
+
+namespace {
+    // Readers map the memory read-only and may be other programs, so the fields
+    // are plain integers accessed through atomic_ref rather than std::atomic.
+    static_assert(std::atomic_ref<uint64_t>::is_always_lock_free);
+    static_assert(std::atomic_ref<uint32_t>::is_always_lock_free);
+
+    // Spins of a reader racing the writer. The writer holds a slot for a ~300 byte
+    // copy, so a handful is plenty.
+    constexpr int MaxReadAttempts = 64;
+
+    uint64_t load(const uint64_t& value, std::memory_order order) {
+        return std::atomic_ref(const_cast<uint64_t&>(value)).load(order);
+    }
+
+    uint32_t load(const uint32_t& value, std::memory_order order) {
+        return std::atomic_ref(const_cast<uint32_t&>(value)).load(order);
+    }
+
+    void writeSlot(Slot& slot, const Sample& sample) {
+        std::atomic_ref sequence(slot.Sequence);
+        sequence.store(2 * sample.Index - 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memcpy(&slot.Data, &sample, sizeof(Sample));
+        sequence.store(2 * sample.Index, std::memory_order_release);
+    }
+}
+
+int64_t SharedTelemetry::NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+Publisher::~Publisher() {
+    Close();
+}
+
+bool Publisher::Open(const char* name) {
+    Close();
+    if (!mMemory.Create(name, sizeof(Layout)))
+        return false;
+
+    mLayout = static_cast<Layout*>(mMemory.Data());
+
+    // Continue the sample count of a mapping readers kept alive, so their
+    // lastIndex stays valid. Anything else is reset.
+    bool compatible = mLayout->Magic == Magic && mLayout->Version == Version &&
+        mLayout->SampleSize == sizeof(Sample) && mLayout->RingSlots == RingSize;
+    if (compatible) {
+        mPublished = load(mLayout->Published, std::memory_order_acquire);
+    }
+    else {
+        std::atomic_ref(mLayout->Magic).store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        memset(reinterpret_cast<char*>(mLayout) + sizeof(uint32_t), 0, sizeof(Layout) - sizeof(uint32_t));
+        mLayout->Version = Version;
+        mLayout->SampleSize = sizeof(Sample);
+        mLayout->RingSlots = RingSize;
+        mPublished = 0;
+        std::atomic_ref(mLayout->Magic).store(Magic, std::memory_order_release);
+    }
+    std::atomic_ref(mLayout->Active).store(1, std::memory_order_release);
+
+    logger.Write(INFO, "[SharedTelemetry] Publishing to [%s], %zu bytes", name, sizeof(Layout));
+    return true;
+}
+
+void Publisher::Close() {
+    if (mLayout) {
+        std::atomic_ref(mLayout->Active).store(0, std::memory_order_release);
+        logger.Write(INFO, "[SharedTelemetry] Closed after %llu samples",
+            static_cast<unsigned long long>(mPublished));
+    }
+    mLayout = nullptr;
+    mMemory.Close();
+}
+
+void Publisher::Publish(Sample& sample) {
+    if (!mLayout)
+        return;
+
+    sample.Index = ++mPublished;
+    sample.PublishTimeNs = NowNs();
+
+    // Ring first: once Published or Latest say n, Ring has n too.
+    writeSlot(mLayout->Ring[(sample.Index - 1) % RingSize], sample);
+    writeSlot(mLayout->Latest, sample);
+    std::atomic_ref(mLayout->Published).store(sample.Index, std::memory_order_release);
+}
+
+bool Subscriber::Open(const char* name) {
+    Close();
+    if (!mMemory.Open(name, sizeof(Layout)))
+        return false;
+
+    const Layout* layout = static_cast<const Layout*>(mMemory.Data());
+    bool compatible = load(layout->Magic, std::memory_order_acquire) == Magic &&
+        layout->Version == Version && layout->SampleSize == sizeof(Sample) && layout->RingSlots == RingSize;
+    if (!compatible) {
+        mMemory.Close();
+        return false;
+    }
+
+    mLayout = layout;
+    return true;
+}
+
+void Subscriber::Close() {
+    mLayout = nullptr;
+    mMemory.Close();
+}
+
+bool Subscriber::Active() const {
+    return mLayout && load(mLayout->Active, std::memory_order_acquire) != 0;
+}
+
+bool Subscriber::readSlot(const Slot& slot, uint64_t expectedSequence, Sample& sample) const {
+    for (int attempt = 0; attempt < MaxReadAttempts; ++attempt) {
+        uint64_t before = load(slot.Sequence, std::memory_order_acquire);
+        if (before == 0)
+            return false;
+        // Overwritten by a newer sample, or an older one still there.
+        if (expectedSequence != 0 && before != expectedSequence && (before & 1) == 0)
+            return false;
+
+        if ((before & 1) == 0) {
+            memcpy(&sample, &slot.Data, sizeof(Sample));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (load(slot.Sequence, std::memory_order_relaxed) == before)
+                return true;
+        }
+        ++mRetries;
+    }
+    return false;
+}
+
+bool Subscriber::ReadLatest(Sample& sample) const {
+    if (!mLayout)
+        return false;
+    return readSlot(mLayout->Latest, 0, sample);
+}
+
+size_t Subscriber::ReadSince(uint64_t& lastIndex, Sample* samples, size_t maxSamples, uint64_t* missed) const {
+    if (missed)
+        *missed = 0;
+    if (!mLayout)
+        return 0;
+
+    uint64_t published = load(mLayout->Published, std::memory_order_acquire);
+    // The script started over.
+    if (published < lastIndex)
+        lastIndex = 0;
+
+    uint64_t oldest = published > RingSize ? published - RingSize + 1 : 1;
+    uint64_t first = std::max(lastIndex + 1, oldest);
+    uint64_t skipped = first - (lastIndex + 1);
+
+    size_t count = 0;
+    uint64_t index = first;
+    for (; index <= published && count < maxSamples; ++index) {
+        const Slot& slot = mLayout->Ring[(index - 1) % RingSize];
+        if (readSlot(slot, 2 * index, samples[count]))
+            ++count;
+        else
+            ++skipped;
+    }
+
+    lastIndex = index - 1;
+    if (missed)
+        *missed = skipped;
+    return count;
+}
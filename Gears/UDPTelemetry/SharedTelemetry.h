@@ -0,0 +1,108 @@
+#pragma once
+#include "TelemetryPacket.h"
+#include "../Util/SharedMemory.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Telemetry in named shared memory, for programs on the same PC. Publishing is
+ * a few memory writes per tick, no system calls, and any number of readers can
+ * attach without the script knowing about them.
+ *
+ * The mapping (Layout) holds the latest sample and a ring of the last RingSize
+ * samples. Each slot is a seqlock: its Sequence is odd while the script writes
+ * it, and 2 * sample index when done. A reader copies the slot and keeps the copy
+ * if Sequence was even and unchanged around the copy, else it tries again.
+ * The script never waits for readers.
+ *
+ * Readers that want every sample poll the ring with ReadSince, readers that only
+ * need the current state (dashboards, shakers) use ReadLatest. PublishTimeNs is
+ * steady_clock, which is the same clock in every process (QueryPerformanceCounter,
+ * CLOCK_MONOTONIC), so readers can tell how old a sample is.
+ */
+namespace SharedTelemetry {
+    constexpr const char* MappingName = "GTAVManualTransmissionTelemetry";
+    constexpr uint32_t Magic = 0x4D534C54; // "TLSM"
+    constexpr uint32_t Version = 1;
+    constexpr uint32_t RingSize = 256;
+
+    struct Sample {
+        uint64_t Index;         // One up per sample, starts at 1
+        int64_t GameTimeMs;
+        int64_t PublishTimeNs;  // NowNs() when published
+        TelemetryPacket Packet; // Same as the UDP packet
+        // VehicleData the packet doesn't carry
+        float RPM;              // 0.2 to 1.0
+        float GameThrottle;
+        float GameClutch;
+        float Turbo;
+        float SteeringAngle;    // Radians
+        float GearNext;
+        float Handbrake;
+    };
+
+    struct alignas(64) Slot {
+        uint64_t Sequence;
+        Sample Data;
+    };
+
+    struct Layout {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t SampleSize;
+        uint32_t RingSlots;
+        uint32_t Active;        // 0 once the script closed the mapping
+        alignas(64) uint64_t Published; // Index of the last published sample
+        Slot Latest;
+        Slot Ring[RingSize];    // Sample n is in Ring[(n - 1) % RingSize]
+    };
+
+    int64_t NowNs();
+
+    class Publisher {
+    public:
+        Publisher() = default;
+        ~Publisher();
+
+        bool Open(const char* name = MappingName);
+        void Close();
+        bool IsOpen() const { return mLayout != nullptr; }
+
+        // Fills in Index and PublishTimeNs.
+        void Publish(Sample& sample);
+
+    private:
+        SharedMemory mMemory;
+        Layout* mLayout = nullptr;
+        uint64_t mPublished = 0;
+    };
+
+    class Subscriber {
+    public:
+        // Fails until the script created the mapping.
+        bool Open(const char* name = MappingName);
+        void Close();
+        bool IsOpen() const { return mLayout != nullptr; }
+
+        // False if the script closed the mapping. Reopen to attach to its next one.
+        bool Active() const;
+
+        // False if nothing was published yet.
+        bool ReadLatest(Sample& sample) const;
+
+        // Samples after lastIndex, oldest first, at most maxSamples. Advances lastIndex.
+        // missed counts samples the ring overwrote before they could be read.
+        size_t ReadSince(uint64_t& lastIndex, Sample* samples, size_t maxSamples, uint64_t* missed = nullptr) const;
+
+        // Retries of torn reads, for diagnostics.
+        uint64_t Retries() const { return mRetries; }
+
+    private:
+        bool readSlot(const Slot& slot, uint64_t expectedSequence, Sample& sample) const;
+
+        SharedMemory mMemory;
+        const Layout* mLayout = nullptr;
+        mutable uint64_t mRetries = 0;
+    };
+}
@@ -55,7 +55,7 @@ public:
         mStarted = true;
     }
 
-    int SendPacket(char* packet, int size) {
+    int SendPacket(const char* packet, int size) {
         return sendto(mSocket, packet, size, 0, reinterpret_cast<sockaddr*>(&mDest), sizeof(mDest));
     }
 
@@ -0,0 +1,432 @@
+#include "TelemetryArchive.h"
+
+#include "../Util/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+    // Longest varint of a 64-bit value
+    constexpr size_t maxVarintBytes = 10;
+
+    // Quantized values beyond this lose integer precision in the double math.
+    constexpr double maxQuantized = 9007199254740992.0; // 2^53
+
+    uint64_t zigzag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    int64_t unzigzag(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    uint8_t* putVarint(uint8_t* out, uint64_t value) {
+        while (value >= 0x80) {
+            *out++ = static_cast<uint8_t>(value) | 0x80;
+            value >>= 7;
+        }
+        *out++ = static_cast<uint8_t>(value);
+        return out;
+    }
+
+    bool getVarint(const uint8_t*& in, const uint8_t* end, uint64_t& value) {
+        value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7) {
+            if (in == end)
+                return false;
+            uint8_t byte = *in++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+
+    // NaN and infinity are stored as 0.
+    int64_t quantize(float value, float inverseStep) {
+        double scaled = std::round(static_cast<double>(value) * inverseStep);
+        if (!std::isfinite(scaled))
+            return 0;
+        return static_cast<int64_t>(std::clamp(scaled, -maxQuantized, maxQuantized));
+    }
+
+    int seek64(FILE* file, uint64_t offset, int origin) {
+#ifdef _WIN32
+        return _fseeki64(file, static_cast<int64_t>(offset), origin);
+#else
+        return fseeko(file, static_cast<off_t>(offset), origin);
+#endif
+    }
+
+    uint64_t tell64(FILE* file) {
+#ifdef _WIN32
+        return static_cast<uint64_t>(_ftelli64(file));
+#else
+        return static_cast<uint64_t>(ftello(file));
+#endif
+    }
+
+    template <typename T>
+    bool readValue(FILE* file, T& value) {
+        return fread(&value, sizeof(T), 1, file) == 1;
+    }
+}
+
+void TelemetryArchive::EncodeChunk(const int64_t* times, const float* values, size_t records,
+    const std::vector<float>& inverseSteps, std::vector<uint8_t>& out) {
+    const size_t channels = inverseSteps.size();
+    size_t start = out.size();
+    out.resize(start + (channels + 1) * records * maxVarintBytes);
+    uint8_t* cursor = out.data() + start;
+
+    // Timestamps: the first absolute, then deltas, usually the frame time.
+    int64_t prevTime = 0;
+    for (size_t r = 0; r < records; ++r) {
+        cursor = putVarint(cursor, zigzag(times[r] - prevTime));
+        prevTime = times[r];
+    }
+
+    for (size_t c = 0; c < channels; ++c) {
+        float inverseStep = inverseSteps[c];
+        int64_t prev = 0;
+        for (size_t r = 0; r < records; ++r) {
+            int64_t quantized = quantize(values[r * channels + c], inverseStep);
+            cursor = putVarint(cursor, zigzag(quantized - prev));
+            prev = quantized;
+        }
+    }
+
+    out.resize(cursor - out.data());
+}
+
+bool TelemetryArchive::DecodeChunk(const uint8_t* data, size_t size, size_t records,
+    const std::vector<float>& steps, std::vector<int64_t>& times, std::vector<float>& values) {
+    const size_t channels = steps.size();
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+    times.resize(records);
+    values.resize(records * channels);
+
+    int64_t prevTime = 0;
+    for (size_t r = 0; r < records; ++r) {
+        uint64_t raw;
+        if (!getVarint(cursor, end, raw))
+            return false;
+        prevTime += unzigzag(raw);
+        times[r] = prevTime;
+    }
+
+    for (size_t c = 0; c < channels; ++c) {
+        double step = steps[c];
+        int64_t prev = 0;
+        for (size_t r = 0; r < records; ++r) {
+            uint64_t raw;
+            if (!getVarint(cursor, end, raw))
+                return false;
+            prev += unzigzag(raw);
+            values[r * channels + c] = static_cast<float>(static_cast<double>(prev) * step);
+        }
+    }
+
+    return cursor == end;
+}
+
+TelemetryArchive::Writer::~Writer() {
+    // May run at unload, don't wait on the pool indefinitely.
+    Close(std::chrono::milliseconds(250));
+}
+
+bool TelemetryArchive::Writer::Open(const std::string& file, std::span<const Channel> channels,
+    int64_t startUnixMs) {
+    Close();
+
+    if (channels.empty() || channels.size() > UINT16_MAX) {
+        logger.Write(ERROR, "[Telemetry] Archive: invalid channel count %zu", channels.size());
+        return false;
+    }
+
+    mFile = fopen(file.c_str(), "wb");
+    if (!mFile) {
+        logger.Write(ERROR, "[Telemetry] Archive: failed to create [%s]", file.c_str());
+        return false;
+    }
+
+    mFileName = file;
+    mChannelCount = channels.size();
+    mInverseSteps.clear();
+    mIndex.clear();
+    mError = false;
+    mStats = {};
+
+    FileHeader header{ FileMagic, Version, static_cast<uint16_t>(channels.size()), startUnixMs };
+    fwrite(&header, sizeof(header), 1, mFile);
+    mOffset = sizeof(header);
+
+    for (const auto& channel : channels) {
+        uint8_t nameLength = static_cast<uint8_t>(std::min<size_t>(strlen(channel.Name), UINT8_MAX));
+        fwrite(&channel.Step, sizeof(channel.Step), 1, mFile);
+        fwrite(&nameLength, sizeof(nameLength), 1, mFile);
+        fwrite(channel.Name, 1, nameLength, mFile);
+        mOffset += sizeof(channel.Step) + sizeof(nameLength) + nameLength;
+        mInverseSteps.push_back(channel.Step > 0.0f ? 1.0f / channel.Step : 1.0f);
+    }
+    mStats.FileBytes = mOffset;
+
+    mCurrent.Times.reserve(RecordsPerChunk);
+    mCurrent.Values.reserve(RecordsPerChunk * mChannelCount);
+    return true;
+}
+
+void TelemetryArchive::Writer::Add(int64_t timeMs, const float* values) {
+    if (!mFile)
+        return;
+
+    mCurrent.Times.push_back(timeMs);
+    mCurrent.Values.insert(mCurrent.Values.end(), values, values + mChannelCount);
+    if (mCurrent.Times.size() >= RecordsPerChunk)
+        queueCurrent();
+}
+
+void TelemetryArchive::Writer::Close() {
+    if (!mFile)
+        return;
+
+    queueCurrent();
+    // A drain that hasn't started yet is done here instead.
+    mDrain.Cancel();
+    if (mDrain.Valid())
+        mDrain.Wait();
+    finish();
+}
+
+bool TelemetryArchive::Writer::Close(std::chrono::milliseconds timeout) {
+    if (!mFile)
+        return true;
+
+    queueCurrent();
+    mDrain.Cancel();
+    if (mDrain.Valid() && !mDrain.WaitFor(timeout)) {
+        // The job owns the file until it's done. Readers rebuild the missing index.
+        logger.Write(WARN, "[Telemetry] Archive [%s]: still writing after %lld ms, left without index",
+            mFileName.c_str(), static_cast<long long>(timeout.count()));
+        return false;
+    }
+    finish();
+    return true;
+}
+
+void TelemetryArchive::Writer::finish() {
+    // Chunks a cancelled drain left behind, and the last one.
+    drain();
+
+    Trailer trailer{ mOffset, static_cast<uint32_t>(mIndex.size()), IndexMagic };
+    fwrite(mIndex.data(), sizeof(IndexEntry), mIndex.size(), mFile);
+    fwrite(&trailer, sizeof(trailer), 1, mFile);
+    if (ferror(mFile))
+        mError = true;
+    fclose(mFile);
+    mFile = nullptr;
+
+    auto stats = GetStats();
+    stats.FileBytes += mIndex.size() * sizeof(IndexEntry) + sizeof(trailer);
+    logger.Write(mError ? ERROR : INFO, "[Telemetry] Archive [%s] closed%s: %llu records, %.1f MiB (%.1fx smaller than raw)",
+        mFileName.c_str(), mError ? " with write errors" : "",
+        static_cast<unsigned long long>(stats.Records), static_cast<double>(stats.FileBytes) / (1024.0 * 1024.0),
+        stats.FileBytes > 0 ? static_cast<double>(stats.RawBytes) / static_cast<double>(stats.FileBytes) : 0.0);
+}
+
+TelemetryArchive::Writer::Stats TelemetryArchive::Writer::GetStats() const {
+    std::lock_guard lock(mMutex);
+    return mStats;
+}
+
+void TelemetryArchive::Writer::queueCurrent() {
+    if (mCurrent.Times.empty())
+        return;
+
+    bool startDrain = false;
+    {
+        std::lock_guard lock(mMutex);
+        mQueue.push_back(std::move(mCurrent));
+        if (!mDraining) {
+            mDraining = true;
+            startDrain = true;
+        }
+    }
+
+    mCurrent = PendingChunk();
+    mCurrent.Times.reserve(RecordsPerChunk);
+    mCurrent.Values.reserve(RecordsPerChunk * mChannelCount);
+
+    if (startDrain)
+        mDrain = TaskPool::Submit(TaskPool::Priority::Low, [this] { drain(); });
+}
+
+void TelemetryArchive::Writer::drain() {
+    std::vector<uint8_t> buffer;
+    while (true) {
+        PendingChunk chunk;
+        {
+            std::lock_guard lock(mMutex);
+            if (mQueue.empty()) {
+                mDraining = false;
+                return;
+            }
+            chunk = std::move(mQueue.front());
+            mQueue.pop_front();
+        }
+        writeChunk(chunk, buffer);
+    }
+}
+
+void TelemetryArchive::Writer::writeChunk(const PendingChunk& chunk, std::vector<uint8_t>& buffer) {
+    size_t records = chunk.Times.size();
+    buffer.clear();
+    EncodeChunk(chunk.Times.data(), chunk.Values.data(), records, mInverseSteps, buffer);
+
+    ChunkHeader header{
+        ChunkMagic,
+        static_cast<uint32_t>(buffer.size()),
+        static_cast<uint32_t>(records),
+        static_cast<uint32_t>(mChannelCount),
+        chunk.Times.front(),
+        chunk.Times.back(),
+    };
+    fwrite(&header, sizeof(header), 1, mFile);
+    fwrite(buffer.data(), 1, buffer.size(), mFile);
+    // Whole chunks on disk, in case the game crashes before Close.
+    fflush(mFile);
+    if (ferror(mFile) && !mError) {
+        mError = true;
+        logger.Write(ERROR, "[Telemetry] Archive [%s]: write failed", mFileName.c_str());
+    }
+
+    mIndex.push_back({ header.FirstTimeMs, header.LastTimeMs, mOffset, header.Records, header.Size });
+    mOffset += sizeof(header) + buffer.size();
+
+    std::lock_guard lock(mMutex);
+    mStats.Records += records;
+    mStats.Chunks++;
+    mStats.RawBytes += records * (sizeof(int64_t) + mChannelCount * sizeof(float));
+    mStats.FileBytes = mOffset;
+}
+
+TelemetryArchive::Reader::~Reader() {
+    if (mFile)
+        fclose(mFile);
+}
+
+bool TelemetryArchive::Reader::Open(const std::string& file) {
+    if (mFile) {
+        fclose(mFile);
+        mFile = nullptr;
+    }
+    mChannels.clear();
+    mSteps.clear();
+    mIndex.clear();
+    mRecovered = false;
+    mError.clear();
+
+    mFile = fopen(file.c_str(), "rb");
+    if (!mFile) {
+        mError = "Can't open file";
+        return false;
+    }
+
+    FileHeader header;
+    if (!readValue(mFile, header) || header.Magic != FileMagic) {
+        mError = "Not a telemetry archive";
+        return false;
+    }
+    if (header.Version != Version) {
+        mError = "Unsupported version " + std::to_string(header.Version);
+        return false;
+    }
+    mStartUnixMs = header.StartUnixMs;
+
+    for (uint16_t i = 0; i < header.ChannelCount; ++i) {
+        float step;
+        uint8_t nameLength;
+        if (!readValue(mFile, step) || !readValue(mFile, nameLength)) {
+            mError = "Truncated channel table";
+            return false;
+        }
+        std::string name(nameLength, '\0');
+        if (fread(name.data(), 1, nameLength, mFile) != nameLength) {
+            mError = "Truncated channel table";
+            return false;
+        }
+        mChannels.push_back({ std::move(name), step });
+        mSteps.push_back(step);
+    }
+    mDataOffset = tell64(mFile);
+
+    seek64(mFile, 0, SEEK_END);
+    uint64_t fileSize = tell64(mFile);
+    if (!readIndex(fileSize))
+        rebuildIndex(fileSize);
+    return true;
+}
+
+size_t TelemetryArchive::Reader::FindChunk(int64_t timeMs) const {
+    auto it = std::lower_bound(mIndex.begin(), mIndex.end(), timeMs,
+        [](const IndexEntry& entry, int64_t time) { return entry.LastTimeMs < time; });
+    return static_cast<size_t>(it - mIndex.begin());
+}
+
+bool TelemetryArchive::Reader::ReadChunk(size_t chunk, std::vector<int64_t>& times, std::vector<float>& values) {
+    if (chunk >= mIndex.size())
+        return false;
+
+    const IndexEntry& entry = mIndex[chunk];
+    ChunkHeader header;
+    if (seek64(mFile, entry.Offset, SEEK_SET) != 0 || !readValue(mFile, header) ||
+        header.Magic != ChunkMagic || header.Size != entry.Size || header.Channels != mChannels.size()) {
+        mError = "Bad chunk header";
+        return false;
+    }
+
+    mBuffer.resize(header.Size);
+    if (fread(mBuffer.data(), 1, header.Size, mFile) != header.Size ||
+        !DecodeChunk(mBuffer.data(), mBuffer.size(), header.Records, mSteps, times, values)) {
+        mError = "Bad chunk data";
+        return false;
+    }
+    return true;
+}
+
+bool TelemetryArchive::Reader::readIndex(uint64_t fileSize) {
+    Trailer trailer;
+    if (fileSize < mDataOffset + sizeof(trailer) ||
+        seek64(mFile, fileSize - sizeof(trailer), SEEK_SET) != 0 ||
+        !readValue(mFile, trailer) || trailer.Magic != IndexMagic)
+        return false;
+
+    uint64_t indexSize = static_cast<uint64_t>(trailer.ChunkCount) * sizeof(IndexEntry);
+    if (trailer.IndexOffset < mDataOffset || trailer.IndexOffset + indexSize + sizeof(trailer) != fileSize)
+        return false;
+
+    mIndex.resize(trailer.ChunkCount);
+    if (seek64(mFile, trailer.IndexOffset, SEEK_SET) != 0 ||
+        fread(mIndex.data(), sizeof(IndexEntry), mIndex.size(), mFile) != mIndex.size()) {
+        mIndex.clear();
+        return false;
+    }
+    return true;
+}
+
+void TelemetryArchive::Reader::rebuildIndex(uint64_t fileSize) {
+    mRecovered = true;
+    uint64_t offset = mDataOffset;
+    while (offset + sizeof(ChunkHeader) <= fileSize) {
+        ChunkHeader header;
+        if (seek64(mFile, offset, SEEK_SET) != 0 || !readValue(mFile, header) ||
+            header.Magic != ChunkMagic || header.Channels != mChannels.size() ||
+            offset + sizeof(header) + header.Size > fileSize)
+            break;
+
+        mIndex.push_back({ header.FirstTimeMs, header.LastTimeMs, offset, header.Records, header.Size });
+        offset += sizeof(header) + header.Size;
+    }
+}
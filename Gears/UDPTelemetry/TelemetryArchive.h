@@ -0,0 +1,190 @@
+#pragma once
+#include "../Util/TaskPool.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+/*
+ * Compressed telemetry session file, for recording whole driving sessions.
+ * A record is a timestamp and one float per channel. Each channel has a step:
+ * values are stored as integer multiples of it (e.g. 0.001 for millimeters),
+ * delta coded against the previous record and written as zigzag varints, one
+ * column per channel. Slowly changing channels mostly take one byte per record.
+ *
+ * Records are grouped in chunks of RecordsPerChunk that decode on their own, so
+ * reading a time range only touches the chunks it overlaps. An index of all chunks
+ * is appended when the file is closed. A seek is a search of that in-memory index
+ * and one chunk read. Files that weren't closed (crash) are still readable, the
+ * index is then rebuilt from the chunk headers.
+ *
+ * Layout, little endian:
+ *   FileHeader, per channel { float Step, uint8 NameLength, char Name[] },
+ *   { ChunkHeader, body }..., IndexEntry[ChunkCount], Trailer
+ */
+namespace TelemetryArchive {
+    constexpr uint32_t FileMagic = 0x52414C54; // "TLAR"
+    constexpr uint32_t ChunkMagic = 0x4B434C54; // "TLCK"
+    constexpr uint32_t IndexMagic = 0x58494C54; // "TLIX"
+    constexpr uint16_t Version = 1;
+
+    constexpr uint32_t RecordsPerChunk = 512;
+
+    struct Channel {
+        const char* Name;
+        float Step;
+    };
+
+    struct ChannelInfo {
+        std::string Name;
+        float Step;
+    };
+
+#pragma pack(push, 1)
+    struct FileHeader {
+        uint32_t Magic;
+        uint16_t Version;
+        uint16_t ChannelCount;
+        int64_t StartUnixMs;
+    };
+
+    struct ChunkHeader {
+        uint32_t Magic;
+        uint32_t Size;      // Body bytes
+        uint32_t Records;
+        uint32_t Channels;
+        int64_t FirstTimeMs;
+        int64_t LastTimeMs;
+    };
+
+    struct IndexEntry {
+        int64_t FirstTimeMs;
+        int64_t LastTimeMs;
+        uint64_t Offset;    // Of the ChunkHeader
+        uint32_t Records;
+        uint32_t Size;
+    };
+
+    struct Trailer {
+        uint64_t IndexOffset;
+        uint32_t ChunkCount;
+        uint32_t Magic;
+    };
+#pragma pack(pop)
+
+    // Appends the body of a chunk. values is row-major, records * inverseSteps.size().
+    void EncodeChunk(const int64_t* times, const float* values, size_t records,
+        const std::vector<float>& inverseSteps, std::vector<uint8_t>& out);
+
+    // Decodes a body from EncodeChunk into times and row-major values.
+    // Returns false if the body is truncated or malformed.
+    bool DecodeChunk(const uint8_t* data, size_t size, size_t records, const std::vector<float>& steps,
+        std::vector<int64_t>& times, std::vector<float>& values);
+
+    /*
+     * Records on the calling thread, encodes and writes on the TaskPool.
+     * Full chunks are queued and written in order by one job at a time,
+     * so a slow disk never holds up the script tick.
+     */
+    class Writer {
+    public:
+        Writer() = default;
+        ~Writer();
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        bool Open(const std::string& file, std::span<const Channel> channels, int64_t startUnixMs);
+        // values holds one float per channel.
+        void Add(int64_t timeMs, const float* values);
+        // Writes the remaining records and the index. Blocks until everything is on disk.
+        void Close();
+        // Same, but waits at most timeout for a chunk that's being written on the pool.
+        // If it doesn't finish, the file is left without an index and false is returned.
+        bool Close(std::chrono::milliseconds timeout);
+
+        bool IsOpen() const { return mFile != nullptr; }
+        const std::string& File() const { return mFileName; }
+
+        struct Stats {
+            uint64_t Records = 0;
+            uint64_t Chunks = 0;
+            // A plain dump: timestamp and the floats of each record.
+            uint64_t RawBytes = 0;
+            uint64_t FileBytes = 0;
+        };
+        // Written so far, updated as chunks reach the disk.
+        Stats GetStats() const;
+
+    private:
+        struct PendingChunk {
+            std::vector<int64_t> Times;
+            std::vector<float> Values;
+        };
+
+        void queueCurrent();
+        void drain();
+        void finish();
+        void writeChunk(const PendingChunk& chunk, std::vector<uint8_t>& buffer);
+
+        // Owned by the recording thread
+        PendingChunk mCurrent;
+        size_t mChannelCount = 0;
+        TaskPool::Handle<void> mDrain;
+
+        // Shared with the drain job
+        mutable std::mutex mMutex;
+        std::deque<PendingChunk> mQueue;
+        bool mDraining = false;
+        Stats mStats;
+
+        // Owned by whoever drains
+        FILE* mFile = nullptr;
+        std::string mFileName;
+        std::vector<float> mInverseSteps;
+        std::vector<IndexEntry> mIndex;
+        uint64_t mOffset = 0;
+        bool mError = false;
+    };
+
+    class Reader {
+    public:
+        Reader() = default;
+        ~Reader();
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+
+        // Returns false and sets Error() on failure.
+        bool Open(const std::string& file);
+
+        const std::vector<ChannelInfo>& Channels() const { return mChannels; }
+        const std::vector<IndexEntry>& Index() const { return mIndex; }
+        int64_t StartUnixMs() const { return mStartUnixMs; }
+        // True if the index was rebuilt because the file wasn't closed.
+        bool Recovered() const { return mRecovered; }
+        const std::string& Error() const { return mError; }
+
+        // First chunk that has records at or after timeMs, or Index().size().
+        size_t FindChunk(int64_t timeMs) const;
+
+        // values is row-major, Records * Channels().size().
+        bool ReadChunk(size_t chunk, std::vector<int64_t>& times, std::vector<float>& values);
+
+    private:
+        bool readIndex(uint64_t fileSize);
+        void rebuildIndex(uint64_t fileSize);
+
+        FILE* mFile = nullptr;
+        std::vector<ChannelInfo> mChannels;
+        std::vector<float> mSteps;
+        std::vector<IndexEntry> mIndex;
+        std::vector<uint8_t> mBuffer;
+        uint64_t mDataOffset = 0;
+        int64_t mStartUnixMs = 0;
+        bool mRecovered = false;
+        std::string mError;
+    };
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "TelemetryArchive.h"
+
+#include <array>
+
+/*
+ * Channels of a recorded telemetry archive: the TelemetryPacket fields the script
+ * fills in, plus some VehicleData the packet doesn't carry.
+ * Steps are the stored resolution, so keep them around what's still meaningful:
+ * smaller steps cost bytes on noisy channels.
+ * Archives carry their own channel table, so this can change without breaking
+ * older files.
+ */
+namespace TelemetryChannels {
+    enum Index {
+        PosX, PosY, PosZ,
+        Speed,
+        VelX, VelY, VelZ,
+        Pitch, Roll, Yaw,
+        SuspPosFL, SuspPosFR, SuspPosRL, SuspPosRR,
+        SuspVelFL, SuspVelFR, SuspVelRL, SuspVelRR,
+        WheelSpeedFL, WheelSpeedFR, WheelSpeedRL, WheelSpeedRR,
+        Throttle, Steer, Brake, Clutch,
+        Gear,
+        AccelLat, AccelLong,
+        EngineRevs, MaxRpm, IdleRpm, MaxGears,
+        Fuel,
+        // VehicleData
+        RPM, GameThrottle, GameClutch, Turbo, SteeringAngle, GearNext, Handbrake,
+        Count,
+    };
+
+    constexpr std::array<TelemetryArchive::Channel, Count> Table{ {
+        { "PosX", 0.001f }, { "PosY", 0.001f }, { "PosZ", 0.001f },
+        { "Speed", 0.001f },
+        { "VelX", 0.001f }, { "VelY", 0.001f }, { "VelZ", 0.001f },
+        { "Pitch", 0.01f }, { "Roll", 0.01f }, { "Yaw", 0.01f },
+        { "SuspPosFL", 0.0001f }, { "SuspPosFR", 0.0001f }, { "SuspPosRL", 0.0001f }, { "SuspPosRR", 0.0001f },
+        { "SuspVelFL", 0.001f }, { "SuspVelFR", 0.001f }, { "SuspVelRL", 0.001f }, { "SuspVelRR", 0.001f },
+        { "WheelSpeedFL", 0.001f }, { "WheelSpeedFR", 0.001f }, { "WheelSpeedRL", 0.001f }, { "WheelSpeedRR", 0.001f },
+        { "Throttle", 0.001f }, { "Steer", 0.001f }, { "Brake", 0.001f }, { "Clutch", 0.001f },
+        { "Gear", 1.0f },
+        { "AccelLat", 0.001f }, { "AccelLong", 0.001f },
+        { "EngineRevs", 1.0f }, { "MaxRpm", 1.0f }, { "IdleRpm", 1.0f }, { "MaxGears", 1.0f },
+        { "Fuel", 0.001f },
+        { "RPM", 0.0001f }, { "GameThrottle", 0.001f }, { "GameClutch", 0.001f }, { "Turbo", 0.001f },
+        { "SteeringAngle", 0.0001f }, { "GearNext", 1.0f }, { "Handbrake", 1.0f },
+    } };
+}
@@ -1,5 +1,6 @@
 #include "UDPTelemetry.h"
-#include "TelemetryPacket.h"
+#include "TelemetryChannels.h"
+#include "../Util/NativeCache.h"
 
 #include <GTAVCustomTorqueMap/GTAVCustomTorqueMap/CustomTorqueMap.hpp>
 #include <inc/natives.h>
@@ -12,13 +13,12 @@ namespace {
     const float DefaultRPMScale = 8000.0f;
 }
 
-void UDPTelemetry::UpdatePacket(Socket& socket, Vehicle vehicle, const VehicleData& vehData,
-                                const CarControls& controls) {
+TelemetryPacket UDPTelemetry::BuildPacket(Vehicle vehicle, const VehicleData& vehData, const CarControls& controls) {
     TelemetryPacket packet{};
 
     packet.Time = static_cast<float>(MISC::GET_GAME_TIMER()) / 1000.0f;
 
-    auto worldPos = ENTITY::GET_ENTITY_COORDS(vehicle, true);
+    auto worldPos = NativeCache::GetEntityCoords(vehicle);
     auto worldSpeed = ENTITY::GET_ENTITY_VELOCITY(vehicle);
     auto relRotation = ENTITY::GET_ENTITY_ROTATION(vehicle, 0);
     packet.X = worldPos.x;
@@ -81,5 +81,51 @@ void UDPTelemetry::UpdatePacket(Socket& socket, Vehicle vehicle, const VehicleDa
     packet.FuelCapacity = 65.0f;
     packet.FuelRemaining = VExt::GetFuelLevel(vehicle);
 
-    socket.SendPacket(reinterpret_cast<char*>(&packet), sizeof(packet));
+    return packet;
+}
+
+void UDPTelemetry::SendPacket(Socket& socket, const TelemetryPacket& packet) {
+    socket.SendPacket(reinterpret_cast<const char*>(&packet), sizeof(packet));
+}
+
+void UDPTelemetry::RecordPacket(TelemetryArchive::Writer& archive, const TelemetryPacket& packet,
+                                const VehicleData& vehData) {
+    using namespace TelemetryChannels;
+    std::array<float, Count> values{
+        packet.X, packet.Y, packet.Z,
+        packet.Speed,
+        packet.WorldSpeedX, packet.WorldSpeedY, packet.WorldSpeedZ,
+        packet.XR, packet.Roll, packet.ZR,
+        packet.SuspensionPositionFrontLeft, packet.SuspensionPositionFrontRight,
+        packet.SuspensionPositionRearLeft, packet.SuspensionPositionRearRight,
+        packet.SuspensionVelocityFrontLeft, packet.SuspensionVelocityFrontRight,
+        packet.SuspensionVelocityRearLeft, packet.SuspensionVelocityRearRight,
+        packet.WheelSpeedFrontLeft, packet.WheelSpeedFrontRight,
+        packet.WheelSpeedRearLeft, packet.WheelSpeedRearRight,
+        packet.Throttle, packet.Steer, packet.Brake, packet.Clutch,
+        packet.Gear,
+        packet.LateralAcceleration, packet.LongitudinalAcceleration,
+        packet.EngineRevs, packet.MaxRpm, packet.IdleRpm, packet.MaxGears,
+        packet.FuelRemaining,
+        vehData.mRPM, vehData.mThrottle, vehData.mClutch, vehData.mTurbo,
+        vehData.mSteeringAngle, static_cast<float>(vehData.mGearNext), vehData.mHandbrake ? 1.0f : 0.0f,
+    };
+
+    // Game time, not packet.Time: a float loses the milliseconds within hours.
+    archive.Add(MISC::GET_GAME_TIMER(), values.data());
+}
+
+void UDPTelemetry::PublishPacket(SharedTelemetry::Publisher& publisher, const TelemetryPacket& packet,
+                                 const VehicleData& vehData) {
+    SharedTelemetry::Sample sample{};
+    sample.GameTimeMs = MISC::GET_GAME_TIMER();
+    sample.Packet = packet;
+    sample.RPM = vehData.mRPM;
+    sample.GameThrottle = vehData.mThrottle;
+    sample.GameClutch = vehData.mClutch;
+    sample.Turbo = vehData.mTurbo;
+    sample.SteeringAngle = vehData.mSteeringAngle;
+    sample.GearNext = static_cast<float>(vehData.mGearNext);
+    sample.Handbrake = vehData.mHandbrake ? 1.0f : 0.0f;
+    publisher.Publish(sample);
 }
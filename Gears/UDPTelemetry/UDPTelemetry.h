@@ -1,10 +1,22 @@
 #pragma once
 
+#include "SharedTelemetry.h"
 #include "Socket.h"
+#include "TelemetryArchive.h"
+#include "TelemetryPacket.h"
 #include "../VehicleData.hpp"
 #include "../Input/CarControls.hpp"
 
 namespace UDPTelemetry {
-    void UpdatePacket(Socket& socket, Vehicle vehicle, const VehicleData& vehData,
-                      const CarControls& controls);
+    TelemetryPacket BuildPacket(Vehicle vehicle, const VehicleData& vehData, const CarControls& controls);
+
+    void SendPacket(Socket& socket, const TelemetryPacket& packet);
+
+    // Adds the packet and extra vehicle data as one record, see TelemetryChannels.
+    void RecordPacket(TelemetryArchive::Writer& archive, const TelemetryPacket& packet,
+                      const VehicleData& vehData);
+
+    // Publishes the packet and the same extra vehicle data as RecordPacket.
+    void PublishPacket(SharedTelemetry::Publisher& publisher, const TelemetryPacket& packet,
+                       const VehicleData& vehData);
 }
@@ -1,24 +1,341 @@
 #include "AddonSpawnerCache.h"
 #include "Paths.h"
+#include "Logger.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
 
 namespace {
-    std::unordered_map<Hash, std::string> hashCache;
-}
+    constexpr uint32_t indexMagic = 0x5341544D; // "MTAS"
+    constexpr uint32_t indexVersion = 1;
+
+    // Without a hashes.cache, Find() looks for one again at most this often.
+    constexpr auto retryInterval = std::chrono::seconds(1);
+
+    // Followed by uint32_t Hashes[Count] (ascending), uint32_t Offsets[Count + 1]
+    // into the pool, and char Pool[PoolSize]. Names are not null-terminated.
+    struct IndexHeader {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t Count;
+        uint32_t PoolSize;
+        uint64_t SourceSize;
+        int64_t SourceTime;
+    };
+
+    struct IndexView {
+        const uint32_t* Hashes = nullptr;
+        const uint32_t* Offsets = nullptr;
+        const char* Pool = nullptr;
+        uint32_t Count = 0;
+    };
+
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile() { Close(); }
+
+        bool Open(const std::string& file);
+        void Close();
+
+        const uint8_t* Data() const { return mData; }
+        size_t Size() const { return mSize; }
+
+    private:
+        const uint8_t* mData = nullptr;
+        size_t mSize = 0;
+#ifdef _WIN32
+        HANDLE mFile = INVALID_HANDLE_VALUE;
+        HANDLE mMapping = nullptr;
+#endif
+    };
+
+#ifdef _WIN32
+    bool MappedFile::Open(const std::string& file) {
+        Close();
+        mFile = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (mFile == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(mFile, &size) || size.QuadPart == 0) {
+            Close();
+            return false;
+        }
+
+        mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mMapping == nullptr) {
+            Close();
+            return false;
+        }
+
+        mData = static_cast<const uint8_t*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+        if (mData == nullptr) {
+            Close();
+            return false;
+        }
+        mSize = static_cast<size_t>(size.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (mData)
+            UnmapViewOfFile(mData);
+        if (mMapping)
+            CloseHandle(mMapping);
+        if (mFile != INVALID_HANDLE_VALUE)
+            CloseHandle(mFile);
+        mData = nullptr;
+        mSize = 0;
+        mMapping = nullptr;
+        mFile = INVALID_HANDLE_VALUE;
+    }
+#else
+    bool MappedFile::Open(const std::string& file) {
+        Close();
+        int fd = open(file.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat st {};
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            return false;
+        }
+
+        void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+            return false;
+
+        mData = static_cast<const uint8_t*>(data);
+        mSize = static_cast<size_t>(st.st_size);
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (mData)
+            munmap(const_cast<uint8_t*>(mData), mSize);
+        mData = nullptr;
+        mSize = 0;
+    }
+#endif
+
+    // Checks the header, that all tables fit in the data and that the names stay in the pool.
+    bool viewIndex(const uint8_t* data, size_t size, IndexView& view) {
+        if (size < sizeof(IndexHeader))
+            return false;
+
+        IndexHeader header;
+        memcpy(&header, data, sizeof(header));
+        if (header.Magic != indexMagic || header.Version != indexVersion)
+            return false;
+
+        uint64_t expected = sizeof(IndexHeader) +
+            sizeof(uint32_t) * (2ull * header.Count + 1) + header.PoolSize;
+        if (size != expected)
+            return false;
+
+        view.Count = header.Count;
+        view.Hashes = reinterpret_cast<const uint32_t*>(data + sizeof(IndexHeader));
+        view.Offsets = view.Hashes + header.Count;
+        view.Pool = reinterpret_cast<const char*>(view.Offsets + header.Count + 1);
+        if (view.Offsets[0] != 0 || view.Offsets[header.Count] != header.PoolSize)
+            return false;
+        for (uint32_t i = 0; i < header.Count; ++i) {
+            if (view.Offsets[i] > view.Offsets[i + 1])
+                return false;
+        }
+        return true;
+    }
+
+    // Same whitespace-separated "hash name" pairs Add-on Spawner writes.
+    std::vector<uint8_t> buildIndex(const std::string& text, uint64_t sourceSize, int64_t sourceTime) {
+        struct Entry {
+            uint32_t Hash;
+            size_t Offset;
+            size_t Length;
+        };
+        std::vector<Entry> entries;
+
+        const char* begin = text.c_str();
+        const char* end = begin + text.size();
+        const char* p = begin;
+        auto isSpace = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; };
+        while (true) {
+            while (p < end && isSpace(*p)) ++p;
+            if (p >= end)
+                break;
+
+            char* hashEnd = nullptr;
+            uint32_t hash = static_cast<uint32_t>(strtoul(p, &hashEnd, 10));
+            if (hashEnd == p)
+                break;
+            p = hashEnd;
+
+            while (p < end && isSpace(*p)) ++p;
+            const char* name = p;
+            while (p < end && !isSpace(*p)) ++p;
+            if (p == name)
+                break;
+
+            entries.push_back({ hash, static_cast<size_t>(name - begin), static_cast<size_t>(p - name) });
+        }
+
+        // First occurrence wins on duplicates.
+        std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            return a.Hash < b.Hash;
+        });
+        entries.erase(std::unique(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            return a.Hash == b.Hash;
+        }), entries.end());
+
+        size_t poolSize = 0;
+        for (const auto& entry : entries)
+            poolSize += entry.Length;
+
+        IndexHeader header{};
+        header.Magic = indexMagic;
+        header.Version = indexVersion;
+        header.Count = static_cast<uint32_t>(entries.size());
+        header.PoolSize = static_cast<uint32_t>(poolSize);
+        header.SourceSize = sourceSize;
+        header.SourceTime = sourceTime;
+
+        std::vector<uint8_t> index(sizeof(IndexHeader) +
+            sizeof(uint32_t) * (2 * entries.size() + 1) + poolSize);
+        memcpy(index.data(), &header, sizeof(header));
+
+        auto* hashes = reinterpret_cast<uint32_t*>(index.data() + sizeof(IndexHeader));
+        auto* offsets = hashes + entries.size();
+        auto* pool = reinterpret_cast<char*>(offsets + entries.size() + 1);
+        uint32_t offset = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            hashes[i] = entries[i].Hash;
+            offsets[i] = offset;
+            memcpy(pool + offset, begin + entries[i].Offset, entries[i].Length);
+            offset += static_cast<uint32_t>(entries[i].Length);
+        }
+        offsets[entries.size()] = offset;
+        return index;
+    }
+
+    struct CacheState {
+        // A source was indexed. Until then, Find() retries.
+        bool Loaded = false;
+        std::chrono::steady_clock::time_point NextAttempt{};
+        MappedFile File;
+        // Used when the index couldn't be written to disk
+        std::vector<uint8_t> Memory;
+        IndexView View;
+    } cache;
+
+    bool matchesSource(const uint8_t* data, size_t size, uint64_t sourceSize, int64_t sourceTime) {
+        IndexView view;
+        if (!viewIndex(data, size, view))
+            return false;
+        IndexHeader header;
+        memcpy(&header, data, sizeof(header));
+        return header.SourceSize == sourceSize && header.SourceTime == sourceTime;
+    }
+
+    void load(const std::string& sourceFile, const std::string& indexFile) {
+        cache.Loaded = false;
+        cache.File.Close();
+        cache.Memory.clear();
+        cache.View = IndexView();
+
+        std::error_code ec;
+        uint64_t sourceSize = fs::file_size(sourceFile, ec);
+        if (ec)
+            return;
+        int64_t sourceTime = static_cast<int64_t>(fs::last_write_time(sourceFile, ec).time_since_epoch().count());
+        if (ec)
+            return;
+
+        if (cache.File.Open(indexFile)) {
+            if (matchesSource(cache.File.Data(), cache.File.Size(), sourceSize, sourceTime) &&
+                viewIndex(cache.File.Data(), cache.File.Size(), cache.View)) {
+                cache.Loaded = true;
+                return;
+            }
+            cache.File.Close();
+            cache.View = IndexView();
+        }
+
+        std::ifstream source(sourceFile, std::ios::binary);
+        if (!source.is_open())
+            return;
+        std::string text((std::istreambuf_iterator<char>(source)), std::istreambuf_iterator<char>());
+        std::vector<uint8_t> index = buildIndex(text, sourceSize, sourceTime);
+
+        // Write aside and swap in, so a half-written index never gets mapped.
+        const std::string tempFile = indexFile + ".tmp";
+        {
+            std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size()));
+        }
+        fs::rename(tempFile, indexFile, ec);
 
-std::unordered_map<Hash, std::string> ASCache::Get() {
-    if (!hashCache.empty())
-        return hashCache;
+        if (!ec && cache.File.Open(indexFile) && viewIndex(cache.File.Data(), cache.File.Size(), cache.View)) {
+            logger.Write(DEBUG, "[ASCache] Built index with %u models", cache.View.Count);
+            cache.Loaded = true;
+            return;
+        }
+
+        logger.Write(WARN, "[ASCache] Failed to write %s, keeping index in memory", indexFile.c_str());
+        fs::remove(tempFile, ec);
+        cache.File.Close();
+        cache.Memory = std::move(index);
+        cache.Loaded = viewIndex(cache.Memory.data(), cache.Memory.size(), cache.View);
+    }
+}
 
-    std::string cacheFile = Paths::GetModuleFolder(Paths::GetOurModuleHandle()) + "\\AddonSpawner\\hashes.cache";
-    std::ifstream infile(cacheFile);
-    if (infile.is_open()) {
-        Hash hash;
-        std::string name;
-        while (infile >> hash >> name) {
-            hashCache.insert({ hash, name });
+std::string_view ASCache::Find(Hash model) {
+    // Add-on Spawner may create its cache after we first looked.
+    if (!cache.Loaded) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= cache.NextAttempt) {
+            cache.NextAttempt = now + retryInterval;
+            load(Paths::GetModuleFolder(Paths::GetOurModuleHandle()) + "\\AddonSpawner\\hashes.cache",
+                Paths::GetModPath() + "\\AddonSpawnerHashes.idx");
         }
     }
-    return hashCache;
+
+    const IndexView& view = cache.View;
+    const uint32_t hash = static_cast<uint32_t>(model);
+    const uint32_t* first = view.Hashes;
+    const uint32_t* last = view.Hashes + view.Count;
+    const uint32_t* it = std::lower_bound(first, last, hash);
+    if (it == last || *it != hash)
+        return {};
+
+    size_t i = static_cast<size_t>(it - first);
+    return { view.Pool + view.Offsets[i], view.Offsets[i + 1] - view.Offsets[i] };
+}
+
+size_t ASCache::Load(const std::string& sourceFile, const std::string& indexFile) {
+    load(sourceFile, indexFile);
+    return cache.View.Count;
 }
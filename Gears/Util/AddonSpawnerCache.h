@@ -1,8 +1,21 @@
 #pragma once
 #include <inc/types.h>
 #include <string>
-#include <unordered_map>
+#include <string_view>
 
+/*
+ * Model names from Add-on Spawner's hashes.cache.
+ * The text cache is converted once into a binary index in our mod folder
+ * (sorted hashes, name offsets and a string pool) which is memory-mapped
+ * read-only, so lookups are a binary search without copying anything.
+ * The index is rebuilt when hashes.cache changes size or modification time.
+ */
 namespace ASCache {
-    std::unordered_map<Hash, std::string> Get();
-}
\ No newline at end of file
+    // Empty if the model is unknown. Stays valid until the script unloads or Load() is called.
+    std::string_view Find(Hash model);
+
+    // Maps the index of sourceFile at indexFile, building it first if it's missing,
+    // invalid or stale. Find() loads the Add-on Spawner cache on first use, and
+    // retries now and then while there is none. Returns the number of models.
+    size_t Load(const std::string& sourceFile, const std::string& indexFile);
+}
@@ -0,0 +1,18 @@
+#include "CachedText.h"
+
+uint32_t UI::detail::textRequests = 0;
+uint32_t UI::detail::textFormats = 0;
+
+namespace {
+    UI::TextStats lastStats{};
+}
+
+void UI::NewTextFrame() {
+    lastStats = { detail::textRequests, detail::textFormats };
+    detail::textRequests = 0;
+    detail::textFormats = 0;
+}
+
+UI::TextStats UI::GetLastTextStats() {
+    return lastStats;
+}
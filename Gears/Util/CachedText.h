@@ -0,0 +1,60 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+/*
+ * Retained HUD text.
+ * A CachedText keeps its formatted string and only runs the format function
+ * again when the key changes. Build the key from what's displayed, with floats
+ * quantized to their display precision (Quantize), so values that would print
+ * the same don't reformat. Drawing still happens every frame, from the cache.
+ */
+namespace UI {
+    namespace detail {
+        extern uint32_t textRequests;
+        extern uint32_t textFormats;
+    }
+
+    template <typename TKey>
+    class CachedText {
+    public:
+        // key: anything comparable to and assignable to TKey, e.g. std::tie() of
+        // the arguments, so unchanged strings aren't copied just to compare them.
+        template <typename K, typename Fn>
+        const std::string& Get(const K& key, Fn&& format) {
+            ++detail::textRequests;
+            if (!mValid || !(key == mKey)) {
+                mText = format();
+                mKey = key;
+                mValid = true;
+                ++detail::textFormats;
+            }
+            return mText;
+        }
+
+        void Invalidate() {
+            mValid = false;
+        }
+
+    private:
+        std::string mText;
+        TKey mKey{};
+        bool mValid = false;
+    };
+
+    // Equal results print the same with this many decimals.
+    inline int64_t Quantize(float value, int decimals) {
+        return std::llround(static_cast<double>(value) * std::pow(10.0, decimals));
+    }
+
+    struct TextStats {
+        uint32_t Requests = 0;
+        uint32_t Formats = 0; // Actual reformats
+    };
+
+    // Call once per frame, before the HUD draws.
+    void NewTextFrame();
+    // Counters of the previous, completed frame.
+    TextStats GetLastTextStats();
+}
@@ -0,0 +1,84 @@
+#include "LazyValue.h"
+
+#include <algorithm>
+
+namespace {
+    uint32_t currentTick = 1;
+
+    // Node whose compute function is running, dependencies get attached to it.
+    LazyGraph::Node* computing = nullptr;
+
+    std::vector<LazyGraph::Node*>& nodes() {
+        // Function-local: nodes may be constructed during static initialization.
+        static std::vector<LazyGraph::Node*> registered;
+        return registered;
+    }
+}
+
+LazyGraph::Node::Node(const char* name)
+    : mName(name) {
+    nodes().push_back(this);
+}
+
+LazyGraph::Node::~Node() {
+    auto& registered = nodes();
+    registered.erase(std::remove(registered.begin(), registered.end(), this), registered.end());
+    for (auto* node : registered) {
+        auto& deps = node->mDependents;
+        deps.erase(std::remove(deps.begin(), deps.end(), this), deps.end());
+    }
+}
+
+void LazyGraph::Node::Invalidate() {
+    if (mTick == 0)
+        return;
+
+    mTick = 0;
+    for (auto* dependent : mDependents)
+        dependent->Invalidate();
+}
+
+void LazyGraph::Node::Hold() {
+    if (mTick != 0 && mTick + 1 == currentTick)
+        mTick = currentTick;
+}
+
+bool LazyGraph::Node::valid() const {
+    return mTick == currentTick;
+}
+
+void LazyGraph::Node::track() {
+    if (computing == nullptr || computing == this)
+        return;
+
+    if (std::find(mDependents.begin(), mDependents.end(), computing) == mDependents.end())
+        mDependents.push_back(computing);
+}
+
+void LazyGraph::Node::beginCompute() {
+    mParent = computing;
+    computing = this;
+}
+
+void LazyGraph::Node::endCompute() {
+    computing = mParent;
+    mParent = nullptr;
+    mTick = currentTick;
+    ++mTickComputes;
+}
+
+void LazyGraph::NewTick() {
+    for (auto* node : nodes()) {
+        node->mLastTickComputes = node->mTickComputes;
+        node->mTickComputes = 0;
+    }
+
+    ++currentTick;
+    // 0 marks invalidated nodes
+    if (currentTick == 0)
+        currentTick = 1;
+}
+
+const std::vector<LazyGraph::Node*>& LazyGraph::GetNodes() {
+    return nodes();
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/*
+ * Per-tick lazily evaluated values.
+ * A LazyValue computes on the first Get() of a tick and returns the stored result
+ * until LazyGraph::NewTick(), which the main script calls once per WAIT(0).
+ * Values read from inside another value's compute function are recorded as its
+ * dependencies, so Invalidate() on one also invalidates everything derived from it.
+ * Only use from the main script thread, like NativeCache.
+ */
+namespace LazyGraph {
+    class Node {
+    public:
+        explicit Node(const char* name);
+        virtual ~Node();
+
+        Node(const Node&) = delete;
+        Node& operator=(const Node&) = delete;
+
+        // Forces a recompute on next access, including all dependent nodes.
+        void Invalidate();
+        // Keeps the result of the previous tick for this tick as well, if there is one.
+        // For values refreshed at a lower rate than the frame rate.
+        void Hold();
+
+        const char* Name() const { return mName; }
+        // Computations of the previous, completed tick.
+        uint32_t LastTickComputes() const { return mLastTickComputes; }
+
+    protected:
+        bool valid() const;
+        // Registers the node currently computing (if any) as dependent of this one.
+        void track();
+        void beginCompute();
+        void endCompute();
+
+    private:
+        friend void NewTick();
+
+        const char* mName;
+        uint32_t mTick = 0;
+        uint32_t mTickComputes = 0;
+        uint32_t mLastTickComputes = 0;
+        std::vector<Node*> mDependents;
+        Node* mParent = nullptr;
+    };
+
+    void NewTick();
+
+    // Nodes in construction order.
+    const std::vector<Node*>& GetNodes();
+}
+
+template <typename T>
+class LazyValue : public LazyGraph::Node {
+public:
+    LazyValue(const char* name, std::function<T()> compute)
+        : Node(name)
+        , mCompute(std::move(compute)) {
+    }
+
+    const T& Get() {
+        track();
+        if (!valid()) {
+            beginCompute();
+            mValue = mCompute();
+            endCompute();
+        }
+        return mValue;
+    }
+
+private:
+    std::function<T()> mCompute;
+    T mValue{};
+};
@@ -0,0 +1,142 @@
+#include "LeadTracker.h"
+
+#include <algorithm>
+
+namespace {
+    // Hits closer together than this don't give a usable range rate.
+    constexpr float minMeasurementInterval = 0.001f;
+}
+
+Cruise::ProbeScheduler::ProbeScheduler(RaySource& source, uint32_t numRays)
+    : mSource(source)
+    , mNumRays(numRays) {
+    mPending.reserve(numRays);
+}
+
+void Cruise::ProbeScheduler::Update(uint32_t budget, std::vector<ProbeResult>& completed) {
+    for (auto it = mPending.begin(); it != mPending.end();) {
+        ProbeResult result;
+        result.Ray = it->Ray;
+        switch (mSource.Poll(it->Handle, result)) {
+            case RaySource::EStatus::Pending:
+                ++it;
+                continue;
+            case RaySource::EStatus::Ready:
+                completed.push_back(result);
+                break;
+            case RaySource::EStatus::Failed:
+                break;
+        }
+        it = mPending.erase(it);
+    }
+
+    // Skip rays still in flight, but don't go around more than once.
+    uint32_t started = 0;
+    for (uint32_t tried = 0; tried < mNumRays && started < budget; ++tried) {
+        uint32_t ray = mNextRay;
+        mNextRay = (mNextRay + 1) % mNumRays;
+        if (inFlight(ray))
+            continue;
+
+        int handle = mSource.Start(ray);
+        if (handle != 0) {
+            mPending.push_back({ ray, handle });
+            ++started;
+        }
+    }
+}
+
+void Cruise::ProbeScheduler::Reset() {
+    mPending.clear();
+    mNextRay = 0;
+}
+
+bool Cruise::ProbeScheduler::inFlight(uint32_t ray) const {
+    return std::any_of(mPending.begin(), mPending.end(),
+        [ray](const PendingRay& pending) { return pending.Ray == ray; });
+}
+
+Cruise::LeadTracker::LeadTracker(LeadTrackerParams params)
+    : mParams(params) {
+}
+
+const Cruise::LeadTarget& Cruise::LeadTracker::Update(float dt, float ownSpeed, const std::vector<ProbeResult>& results) {
+    mTime += dt;
+    if (mTarget.Valid)
+        mTarget.SinceHit += dt;
+
+    const ProbeResult* closest = nullptr;
+    bool targetHit = false;
+    for (const auto& result : results) {
+        if (!result.Hit || result.Entity == 0)
+            continue;
+        if (!closest || result.Distance < closest->Distance)
+            closest = &result;
+        if (mTarget.Valid && result.Entity == mTarget.Entity) {
+            measure(result);
+            targetHit = true;
+        }
+    }
+
+    // Something cutting in between takes over, a vehicle further away only once the target is lost.
+    if (closest && closest->Entity != mTarget.Entity &&
+        (!mTarget.Valid || closest->Distance + mParams.SwitchMargin < mTarget.Distance)) {
+        acquire(*closest);
+    }
+    else if (mTarget.Valid && !targetHit && mTarget.SinceHit > mParams.LostTime) {
+        Reset();
+    }
+
+    if (mTarget.Valid)
+        updateDistance();
+
+    mTarget.Speed = mTarget.Valid ? ownSpeed + mTarget.RangeRate : 0.0f;
+    return mTarget;
+}
+
+void Cruise::LeadTracker::Reset() {
+    mTarget = {};
+    mRayHits.clear();
+    mHasRate = false;
+}
+
+void Cruise::LeadTracker::acquire(const ProbeResult& hit) {
+    Reset();
+    mTarget.Valid = true;
+    mTarget.Entity = hit.Entity;
+    measure(hit);
+}
+
+void Cruise::LeadTracker::measure(const ProbeResult& hit) {
+    if (hit.Ray >= mRayHits.size())
+        mRayHits.resize(hit.Ray + 1);
+
+    RayHit& last = mRayHits[hit.Ray];
+    float interval = mTime - last.Time;
+    if (last.Valid && interval >= minMeasurementInterval) {
+        float rate = (hit.Distance - last.Distance) / interval;
+        mTarget.RangeRate = mHasRate ? mTarget.RangeRate + mParams.RateGain * (rate - mTarget.RangeRate) : rate;
+        mHasRate = true;
+    }
+
+    last = { true, hit.Distance, mTime };
+    mTarget.SinceHit = 0.0f;
+}
+
+// Closest of the recent per-ray hits, each moved forward by the range rate.
+void Cruise::LeadTracker::updateDistance() {
+    bool any = false;
+    float distance = 0.0f;
+    for (const auto& rayHit : mRayHits) {
+        float age = mTime - rayHit.Time;
+        if (!rayHit.Valid || age > mParams.LostTime)
+            continue;
+
+        float predicted = std::max(0.0f, rayHit.Distance + mTarget.RangeRate * age);
+        if (!any || predicted < distance)
+            distance = predicted;
+        any = true;
+    }
+    if (any)
+        mTarget.Distance = distance;
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/*
+ * Non-blocking probing for adaptive cruise control.
+ * ProbeScheduler spreads a fan of rays over frames: each update it collects
+ * the rays that finished and starts at most a budget of new ones, round-robin.
+ * LeadTracker fuses those hits over time into one lead vehicle with a smoothed
+ * distance and estimated speed, so frames without fresh hits still have a target.
+ * Neither touches natives: the game implements RaySource with async shape tests.
+ */
+namespace Cruise {
+    struct ProbeResult {
+        uint32_t Ray = 0;       // Index in the fan
+        bool Hit = false;
+        int Entity = 0;
+        float Distance = 0.0f;  // m, from the ray origin
+    };
+
+    class RaySource {
+    public:
+        enum class EStatus {
+            Pending,
+            Ready,
+            Failed,
+        };
+
+        virtual ~RaySource() = default;
+
+        // Returns a handle, 0 if the ray couldn't be started.
+        virtual int Start(uint32_t ray) = 0;
+        // On Ready, fills Hit, Entity and Distance of result.
+        virtual EStatus Poll(int handle, ProbeResult& result) = 0;
+    };
+
+    class ProbeScheduler {
+    public:
+        ProbeScheduler(RaySource& source, uint32_t numRays);
+
+        // Appends rays completed since the last update to completed,
+        // then starts up to budget rays that aren't in flight yet.
+        void Update(uint32_t budget, std::vector<ProbeResult>& completed);
+
+        // Forgets rays in flight, their results are never collected.
+        void Reset();
+
+        uint32_t InFlight() const {
+            return static_cast<uint32_t>(mPending.size());
+        }
+
+    private:
+        struct PendingRay {
+            uint32_t Ray;
+            int Handle;
+        };
+
+        bool inFlight(uint32_t ray) const;
+
+        RaySource& mSource;
+        uint32_t mNumRays;
+        uint32_t mNextRay = 0;
+        std::vector<PendingRay> mPending;
+    };
+
+    struct LeadTrackerParams {
+        float RateGain = 0.3f;      // How much of a new range rate measurement is taken over
+        float SwitchMargin = 2.0f;  // m, another vehicle must be this much closer to take over
+        float LostTime = 0.5f;      // s without hits before the target is dropped
+    };
+
+    struct LeadTarget {
+        bool Valid = false;
+        int Entity = 0;
+        float Distance = 0.0f;      // m, closest ray. Predicted between hits.
+        float RangeRate = 0.0f;     // m/s, negative when closing in
+        float Speed = 0.0f;         // m/s, own speed + range rate
+        float SinceHit = 0.0f;      // s
+    };
+
+    class LeadTracker {
+    public:
+        explicit LeadTracker(LeadTrackerParams params = {});
+
+        // dt: frame time. ownSpeed: own forward speed, m/s.
+        // results: probes that completed this frame, hits and misses.
+        const LeadTarget& Update(float dt, float ownSpeed, const std::vector<ProbeResult>& results);
+        void Reset();
+
+        const LeadTarget& Target() const {
+            return mTarget;
+        }
+
+    private:
+        // Last hit of each ray on the target. Rays hit different points of the
+        // vehicle, so the range rate is only derived from the same ray's hits.
+        struct RayHit {
+            bool Valid = false;
+            float Distance = 0.0f;
+            float Time = 0.0f;
+        };
+
+        void acquire(const ProbeResult& hit);
+        void measure(const ProbeResult& hit);
+        void updateDistance();
+
+        LeadTrackerParams mParams;
+        LeadTarget mTarget;
+        std::vector<RayHit> mRayHits;
+        float mTime = 0.0f;
+        bool mHasRate = false;
+    };
+}
@@ -1,14 +1,60 @@
 #include "Logger.hpp"
 
-#include <iomanip>
-#include <Windows.h>
-#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstring>
+#include <ctime>
+
+#ifdef _WIN32
+#include <share.h>
+#endif
+
+namespace {
+    int64_t nowMs() {
+        using namespace std::chrono;
+        return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+    }
+
+    // How long the worker sleeps between batches when nothing forces a flush.
+    constexpr auto workerInterval = std::chrono::milliseconds(25);
+
+    // How long Shutdown waits for the worker before abandoning it.
+    constexpr auto shutdownTimeout = std::chrono::milliseconds(250);
+}
 
 Logger::Logger()
-    : mError(false) {
+    : mError(false)
+    , mEnqueuePos(0)
+    , mDequeuePos(0)
+    , mDropped(0)
+    , mDroppedTotal(0)
+    , mWritten(0)
+    , mFile(nullptr)
+    , mWorkerStarted(false)
+    , mWorkerExited(false)
+    , mStopping(false) {
+    for (size_t i = 0; i < SlotCount; ++i) {
+        mSlots[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+Logger::~Logger() {
+    Shutdown();
+    std::lock_guard fileLock(mFileMutex);
+    if (mFile) {
+        fclose(mFile);
+        mFile = nullptr;
+    }
 }
 
 void Logger::SetFile(const std::string &fileName) {
+    std::lock_guard fileLock(mFileMutex);
+    drainLocked();
+    if (mFile) {
+        fclose(mFile);
+        mFile = nullptr;
+    }
     file = fileName;
 }
 
@@ -17,42 +63,49 @@ void Logger::SetMinLevel(LogLevel level) {
 }
 
 void Logger::Clear() const {
-    std::lock_guard lock(mutex);
-    std::ofstream logFile(file, std::ofstream::out | std::ofstream::trunc);
-    logFile.close();
-    if (logFile.fail())
-        mError = true;
+    std::lock_guard fileLock(mFileMutex);
+    drainLocked();
+    openLocked(true);
 }
 
 void Logger::Write(LogLevel level, const std::string& text) const {
 #ifndef _DEBUG
     if (level < minLevel) return;
 #endif
-    std::lock_guard lock(mutex);
-    std::ofstream logFile(file, std::ios_base::out | std::ios_base::app);
-    SYSTEMTIME currTimeLog;
-    GetLocalTime(&currTimeLog);
-    logFile << "[" <<
-        std::setw(2) << std::setfill('0') << currTimeLog.wHour << ":" <<
-        std::setw(2) << std::setfill('0') << currTimeLog.wMinute << ":" <<
-        std::setw(2) << std::setfill('0') << currTimeLog.wSecond << "." <<
-        std::setw(3) << std::setfill('0') << currTimeLog.wMilliseconds << "] " <<
-        "[" << levelText(level) << "] " <<
-        text << "\n";
-
-    logFile.close();
-    if (logFile.fail())
-        mError = true;
+    int64_t timeMs = nowMs();
+
+    if (mStopping || text.size() > SlotTextSize) {
+        writeSync(level, timeMs, text.c_str(), text.size());
+        return;
+    }
+
+    if (!enqueue(level, timeMs, text.c_str(), text.size())) {
+        mDropped.fetch_add(1, std::memory_order_relaxed);
+        mDroppedTotal.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Shutdown may have started after the check above, and done its last drain
+    // before this line was queued. The fence pairs with the exchange in Shutdown:
+    // either its drain sees the line, or this sees mStopping and drains it.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (level == FATAL || mStopping) {
+        Flush();
+    }
 }
 
 void Logger::Write(LogLevel level, const char *fmt, ...) const {
+#ifndef _DEBUG
+    if (level < minLevel) return;
+#endif
     const int size = 1024;
     char buff[size];
     va_list args;
     va_start(args, fmt);
-    vsnprintf(buff, size, fmt, args);
+    int len = vsnprintf(buff, size, fmt, args);
     va_end(args);
-    Write(level, std::string(buff));
+    if (len < 0)
+        return;
+    Write(level, std::string(buff, std::min<size_t>(len, size - 1)));
 }
 
 bool Logger::Error() {
@@ -63,8 +116,163 @@ void Logger::ClearError() {
     mError = false;
 }
 
-std::string Logger::levelText(LogLevel level) const {
-    return levelStrings[level];
+void Logger::Flush() const {
+    std::lock_guard fileLock(mFileMutex);
+    drainLocked();
+}
+
+void Logger::Shutdown() {
+    if (mStopping.exchange(true))
+        return;
+
+    if (mWorkerStarted) {
+        std::unique_lock workerLock(mWorkerMutex);
+        mWorkerCv.notify_all();
+        // Waiting on a flag instead of join(): this may run from DllMain under the
+        // loader lock, where joining a thread that still has to exit deadlocks.
+        // The thread is detached either way, the last queued lines are drained below.
+        mWorkerCv.wait_for(workerLock, shutdownTimeout, [this] { return mWorkerExited.load(); });
+        workerLock.unlock();
+        if (mWorker.joinable())
+            mWorker.detach();
+    }
+
+    Flush();
+}
+
+bool Logger::enqueue(LogLevel level, int64_t timeMs, const char* text, size_t length) const {
+    if (!mWorkerStarted)
+        startWorker();
+
+    uint64_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+        slot = &mSlots[pos % SlotCount];
+        uint64_t seq = slot->Sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+        if (diff == 0) {
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0) {
+            // Full
+            return false;
+        }
+        else {
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->TimeMs = timeMs;
+    slot->Level = static_cast<uint32_t>(level);
+    slot->Length = static_cast<uint32_t>(length);
+    memcpy(slot->Text, text, length);
+    slot->Sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+void Logger::writeSync(LogLevel level, int64_t timeMs, const char* text, size_t length) const {
+    std::lock_guard fileLock(mFileMutex);
+    // Keep ordering: anything already queued goes first.
+    drainLocked();
+    writeLineLocked(level, timeMs, text, length);
+    if (mFile)
+        fflush(mFile);
+}
+
+// Single consumer: caller must hold mFileMutex.
+void Logger::drainLocked() const {
+    bool wroteAny = false;
+    while (true) {
+        Slot& slot = mSlots[mDequeuePos % SlotCount];
+        uint64_t seq = slot.Sequence.load(std::memory_order_acquire);
+        if (seq != mDequeuePos + 1)
+            break;
+
+        writeLineLocked(static_cast<LogLevel>(slot.Level), slot.TimeMs, slot.Text, slot.Length);
+        slot.Sequence.store(mDequeuePos + SlotCount, std::memory_order_release);
+        ++mDequeuePos;
+        wroteAny = true;
+    }
+
+    uint64_t dropped = mDropped.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        char buff[64];
+        int len = snprintf(buff, sizeof(buff), "[Logger] Dropped %llu messages", static_cast<unsigned long long>(dropped));
+        writeLineLocked(WARN, nowMs(), buff, len);
+        wroteAny = true;
+    }
+
+    if (wroteAny && mFile)
+        fflush(mFile);
+}
+
+void Logger::writeLineLocked(LogLevel level, int64_t timeMs, const char* text, size_t length) const {
+    if (!mFile) {
+        openLocked(false);
+        if (!mFile)
+            return;
+    }
+
+    std::time_t timeSec = static_cast<std::time_t>(timeMs / 1000);
+    std::tm localTime{};
+#ifdef _WIN32
+    localtime_s(&localTime, &timeSec);
+#else
+    localtime_r(&timeSec, &localTime);
+#endif
+
+    fprintf(mFile, "[%02d:%02d:%02d.%03d] [%s] ",
+        localTime.tm_hour, localTime.tm_min, localTime.tm_sec, static_cast<int>(timeMs % 1000),
+        levelStrings[level]);
+    fwrite(text, 1, length, mFile);
+    fputc('\n', mFile);
+
+    if (ferror(mFile))
+        mError = true;
+    mWritten.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Logger::openLocked(bool truncate) const {
+    if (mFile) {
+        fclose(mFile);
+        mFile = nullptr;
+    }
+    if (file.empty())
+        return;
+#ifdef _WIN32
+    // Stays open for the lifetime of the script, so allow others to read it.
+    mFile = _fsopen(file.c_str(), truncate ? "w" : "a", _SH_DENYNO);
+#else
+    mFile = fopen(file.c_str(), truncate ? "w" : "a");
+#endif
+    if (!mFile)
+        mError = true;
+}
+
+void Logger::startWorker() const {
+    bool expected = false;
+    if (!mWorkerStarted.compare_exchange_strong(expected, true))
+        return;
+
+    mWorker = std::thread([this] { workerMain(); });
+}
+
+void Logger::workerMain() const {
+    while (!mStopping) {
+        {
+            std::unique_lock workerLock(mWorkerMutex);
+            mWorkerCv.wait_for(workerLock, workerInterval, [this] { return mStopping.load(); });
+        }
+        Flush();
+    }
+
+    Flush();
+    {
+        std::lock_guard workerLock(mWorkerMutex);
+        mWorkerExited = true;
+    }
+    mWorkerCv.notify_all();
 }
 
 // Everything's gonna use this instance.
@@ -1,7 +1,12 @@
 #pragma once
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
 #include <mutex>
 #include <string>
-#include <vector>
+#include <thread>
 
 enum LogLevel {
     DEBUG,
@@ -11,10 +16,21 @@ enum LogLevel {
     FATAL,
 };
 
+/*
+ * Asynchronous logger.
+ * Callers copy their message into a bounded lock-free ring buffer (MPSC),
+ * a background thread formats the timestamp and writes batches to a
+ * persistently opened file. When the ring is full, messages are dropped and
+ * counted. FATAL messages, Flush() and Shutdown() drain the ring synchronously.
+ * Messages longer than a slot bypass the ring and are written synchronously.
+ */
 class Logger {
-
 public:
     Logger();
+    ~Logger();
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
     void SetFile(const std::string &fileName);
     void SetMinLevel(LogLevel level);
     void Clear() const;
@@ -23,19 +39,66 @@ public:
     bool Error();
     void ClearError();
 
+    // Blocks until everything queued so far is on disk.
+    void Flush() const;
+
+    // Drains the queue and stops the background thread. Further writes are synchronous.
+    void Shutdown();
+
+    uint64_t Written() const { return mWritten; }
+    uint64_t Dropped() const { return mDroppedTotal; }
+
+    static constexpr size_t SlotCount = 512;
+    static constexpr size_t SlotTextSize = 1024 - sizeof(uint64_t) - sizeof(int64_t) - 2 * sizeof(uint32_t);
+
 private:
-    mutable bool mError;
+    struct Slot {
+        std::atomic<uint64_t> Sequence;
+        int64_t TimeMs;
+        uint32_t Level;
+        uint32_t Length;
+        char Text[SlotTextSize];
+    };
+
+    bool enqueue(LogLevel level, int64_t timeMs, const char* text, size_t length) const;
+    void writeSync(LogLevel level, int64_t timeMs, const char* text, size_t length) const;
+    void drainLocked() const;
+    void writeLineLocked(LogLevel level, int64_t timeMs, const char* text, size_t length) const;
+    void openLocked(bool truncate) const;
+    void startWorker() const;
+    void workerMain() const;
+
+    mutable std::atomic<bool> mError;
     std::string file = "";
-    std::string levelText(LogLevel level) const;
-    LogLevel minLevel = INFO;
-    const std::vector<std::string> levelStrings{
+    std::atomic<LogLevel> minLevel = INFO;
+    static constexpr std::array<const char*, 5> levelStrings{
         " DEBUG ",
         " INFO  ",
         "WARNING",
         " ERROR ",
         " FATAL ",
     };
-    mutable std::mutex mutex;
+
+    // Ring buffer. Producers claim slots via mEnqueuePos, the single consumer
+    // (whoever holds mFileMutex) advances mDequeuePos.
+    mutable std::array<Slot, SlotCount> mSlots;
+    mutable std::atomic<uint64_t> mEnqueuePos;
+    mutable uint64_t mDequeuePos;
+
+    mutable std::atomic<uint64_t> mDropped;
+    mutable std::atomic<uint64_t> mDroppedTotal;
+    mutable std::atomic<uint64_t> mWritten;
+
+    // Protects mFile and consumption of the ring.
+    mutable std::mutex mFileMutex;
+    mutable FILE* mFile;
+
+    mutable std::mutex mWorkerMutex;
+    mutable std::condition_variable mWorkerCv;
+    mutable std::thread mWorker;
+    mutable std::atomic<bool> mWorkerStarted;
+    mutable std::atomic<bool> mWorkerExited;
+    mutable std::atomic<bool> mStopping;
 };
 
 extern Logger logger;
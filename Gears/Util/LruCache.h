@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+/*
+ * Fixed-capacity key-value cache that evicts the least recently used entry.
+ * Find and GetOrAdd are O(1) and count towards the hit/miss statistics.
+ * Pointers to values stay valid until their entry is evicted or the cache is cleared.
+ */
+template <typename TKey, typename TValue>
+class LruCache {
+public:
+    explicit LruCache(size_t capacity)
+        : mCapacity(capacity == 0 ? 1 : capacity) {
+    }
+
+    // Marks the entry as most recently used. nullptr on a miss.
+    TValue* Find(const TKey& key) {
+        auto it = mIndex.find(key);
+        if (it == mIndex.end()) {
+            ++mMisses;
+            return nullptr;
+        }
+
+        ++mHits;
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        return &it->second->second;
+    }
+
+    // Creates the value with make() on a miss.
+    template <typename Fn>
+    TValue& GetOrAdd(const TKey& key, Fn&& make) {
+        if (TValue* value = Find(key))
+            return *value;
+
+        if (mEntries.size() >= mCapacity) {
+            mIndex.erase(mEntries.back().first);
+            mEntries.pop_back();
+            ++mEvictions;
+        }
+
+        mEntries.emplace_front(key, make());
+        mIndex[key] = mEntries.begin();
+        return mEntries.front().second;
+    }
+
+    void Clear() {
+        mEntries.clear();
+        mIndex.clear();
+    }
+
+    size_t Size() const { return mEntries.size(); }
+    size_t Capacity() const { return mCapacity; }
+    uint64_t Hits() const { return mHits; }
+    uint64_t Misses() const { return mMisses; }
+    uint64_t Evictions() const { return mEvictions; }
+
+private:
+    using Entry = std::pair<TKey, TValue>;
+
+    size_t mCapacity;
+    // Front is the most recently used.
+    std::list<Entry> mEntries;
+    std::unordered_map<TKey, typename std::list<Entry>::iterator> mIndex;
+
+    uint64_t mHits = 0;
+    uint64_t mMisses = 0;
+    uint64_t mEvictions = 0;
+};
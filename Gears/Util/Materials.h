@@ -1,10 +1,17 @@
 #pragma once
-#include <string>
-#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
 
+/*
+ * Materials.dat material ids, as reported per wheel by GetTireContactMaterial.
+ * Names and FFB surface properties are compile-time tables indexed by the id,
+ * so looking up a wheel's surface is an array access.
+ */
 namespace Materials {
-    // Materials.dat
-    static const std::vector<const char*> Materials{
+    constexpr const char* Names[] = {
         "DEFAULT",
         "CONCRETE",
         "CONCRETE_POTHOLE",
@@ -220,10 +227,90 @@ namespace Materials {
         "TEMP_30"
     };
 
-    std::string GetMaterialName(uint16_t materialIndex) {
-        if (materialIndex >= Materials.size()) {
+    constexpr size_t Count = std::size(Names);
+
+    struct Properties {
+        // Fraction of the texture force limit, at SurfaceTexture::Generator::FullSpeed and above
+        float RumbleAmplitude = 0.0f;
+        // Bumps per meter travelled
+        float RumbleFrequency = 0.0f;
+        // 0: periodic (rumble strips, cobbles), 1: random (gravel)
+        float RumbleNoise = 0.0f;
+        // Multiplier on the self-aligning torque
+        float GripFeel = 1.0f;
+    };
+
+    // Fails to compile for names that aren't in the table.
+    constexpr uint16_t IdOf(std::string_view name) {
+        for (size_t i = 0; i < Count; ++i) {
+            if (name == Names[i])
+                return static_cast<uint16_t>(i);
+        }
+        throw "Unknown material";
+    }
+
+    // Materials not listed have no texture and neutral grip feel.
+    constexpr std::array<Properties, Count> PropertyTable = [] {
+        std::array<Properties, Count> table{};
+        auto set = [&table](std::string_view name, Properties properties) {
+            table[IdOf(name)] = properties;
+        };
+
+        //  name                          amp        freq       noise  grip
+        set("CONCRETE_POTHOLE",         { 0.30f,     1.0f,      1.0f,  1.00f });
+        set("TARMAC_POTHOLE",           { 0.30f,     1.0f,      1.0f,  1.00f });
+        set("RUMBLE_STRIP",             { 0.80f,     4.0f,      0.0f,  1.00f });
+        set("COBBLESTONE",              { 0.35f,     8.0f,      0.3f,  0.95f });
+        set("BRICK_PAVEMENT",           { 0.15f,     6.0f,      0.2f,  1.00f });
+        set("PAVING_SLAB",              { 0.10f,     2.0f,      0.0f,  1.00f });
+        set("ROCK",                     { 0.50f,     2.0f,      1.0f,  0.90f });
+        set("STONE",                    { 0.40f,     3.0f,      1.0f,  0.90f });
+        set("GRAVEL_SMALL",             { 0.30f,    10.0f,      1.0f,  0.85f });
+        set("GRAVEL_LARGE",             { 0.50f,     6.0f,      1.0f,  0.80f });
+        set("GRAVEL_DEEP",              { 0.40f,     6.0f,      1.0f,  0.70f });
+        set("GRAVEL_TRAIN_TRACK",       { 0.60f,     1.5f,      0.3f,  0.85f });
+        set("DIRT_TRACK",               { 0.20f,     3.0f,      1.0f,  0.85f });
+        set("MUD_HARD",                 { 0.15f,     2.0f,      1.0f,  0.85f });
+        set("MUD_POTHOLE",              { 0.40f,     1.0f,      1.0f,  0.80f });
+        set("MUD_SOFT",                 { 0.05f,     1.0f,      1.0f,  0.70f });
+        set("MUD_DEEP",                 { 0.05f,     1.0f,      1.0f,  0.60f });
+        set("SAND_LOOSE",               { 0.05f,     2.0f,      1.0f,  0.70f });
+        set("SAND_COMPACT",             { 0.05f,     2.0f,      1.0f,  0.85f });
+        set("SAND_TRACK",               { 0.10f,     2.0f,      1.0f,  0.85f });
+        set("SAND_DRY_DEEP",            { 0.05f,     1.0f,      1.0f,  0.60f });
+        set("SAND_WET_DEEP",            { 0.05f,     1.0f,      1.0f,  0.60f });
+        set("SOIL",                     { 0.10f,     2.0f,      1.0f,  0.85f });
+        set("GRASS_LONG",               { 0.10f,     2.0f,      1.0f,  0.75f });
+        set("GRASS",                    { 0.10f,     2.0f,      1.0f,  0.80f });
+        set("GRASS_SHORT",              { 0.05f,     2.0f,      1.0f,  0.85f });
+        set("ICE",                      { 0.00f,     0.0f,      0.0f,  0.40f });
+        set("ICE_TARMAC",               { 0.00f,     0.0f,      0.0f,  0.50f });
+        set("SNOW_LOOSE",               { 0.05f,     2.0f,      1.0f,  0.65f });
+        set("SNOW_COMPACT",             { 0.00f,     0.0f,      0.0f,  0.70f });
+        set("SNOW_DEEP",                { 0.05f,     1.0f,      1.0f,  0.60f });
+        set("SNOW_TARMAC",              { 0.00f,     0.0f,      0.0f,  0.75f });
+        set("METAL_GRILLE",             { 0.50f,    10.0f,      0.0f,  1.00f });
+        set("METAL_MANHOLE",            { 0.20f,     2.0f,      0.0f,  1.00f });
+        set("WOOD_SOLID_MEDIUM",        { 0.25f,     5.0f,      0.1f,  1.00f });
+        set("WOOD_SOLID_LARGE",         { 0.25f,     4.0f,      0.1f,  1.00f });
+        set("WOOD_OLD_CREAKY",          { 0.35f,     5.0f,      0.3f,  0.95f });
+        set("PUDDLE",                   { 0.00f,     0.0f,      0.0f,  0.90f });
+        set("OIL",                      { 0.00f,     0.0f,      0.0f,  0.50f });
+        return table;
+    }();
+
+    inline const Properties& GetProperties(uint16_t materialIndex) {
+        static constexpr Properties unknown{};
+        if (materialIndex >= Count) {
+            return unknown;
+        }
+        return PropertyTable[materialIndex];
+    }
+
+    inline const char* GetMaterialName(uint16_t materialIndex) {
+        if (materialIndex >= Count) {
             return "UNKNOWN";
         }
-        return Materials[materialIndex];
+        return Names[materialIndex];
     }
 }
@@ -0,0 +1,155 @@
+#include "NativeCache.h"
+
+#include "../Memory/VehicleExtensions.hpp"
+
+#include <inc/natives.h>
+
+namespace {
+    // Most natives are asked about the player vehicle, occasionally about one other.
+    constexpr size_t entriesPerNative = 4;
+
+    uint32_t currentTick = 1;
+
+    NativeCache::Stats tickStats{};
+    NativeCache::Stats lastTickStats{};
+
+    template <typename T>
+    struct Entry {
+        Entity Handle = 0;
+        uint32_t Tick = 0;
+        T Value{};
+    };
+
+    template <typename T>
+    struct Table {
+        std::array<Entry<T>, entriesPerNative> Entries{};
+        size_t Next = 0;
+
+        template <typename Fn>
+        T Get(NativeCache::ENative native, Entity handle, Fn&& fetch) {
+            auto& counters = tickStats[static_cast<size_t>(native)];
+            for (auto& entry : Entries) {
+                if (entry.Tick == currentTick && entry.Handle == handle) {
+                    ++counters.Hits;
+                    return entry.Value;
+                }
+            }
+
+            ++counters.Misses;
+            auto& entry = Entries[Next];
+            Next = (Next + 1) % entriesPerNative;
+            entry.Handle = handle;
+            entry.Tick = currentTick;
+            entry.Value = fetch();
+            return entry.Value;
+        }
+
+        void Invalidate(Entity handle) {
+            for (auto& entry : Entries) {
+                if (entry.Handle == handle)
+                    entry.Tick = 0;
+            }
+        }
+    };
+
+    Table<float> frameTime;
+    Table<Vector3> speedVector;
+    Table<Vector3> speedVectorWorld;
+    Table<Vector3> coords;
+    Table<Vector3> forwardVector;
+    Table<bool> engineRunning;
+    Table<uint8_t> numWheels;
+    Table<NativeMatrix4x4> entityMatrix;
+
+    const std::array<const char*, static_cast<size_t>(NativeCache::ENative::SIZEOF_ENative)> nativeNames{
+        "GET_FRAME_TIME",
+        "GET_ENTITY_SPEED_VECTOR (rel)",
+        "GET_ENTITY_SPEED_VECTOR (world)",
+        "GET_ENTITY_COORDS",
+        "GET_ENTITY_FORWARD_VECTOR",
+        "GET_IS_VEHICLE_ENGINE_RUNNING",
+        "GetNumWheels",
+        "GET_ENTITY_MATRIX",
+    };
+}
+
+void NativeCache::NewTick() {
+    lastTickStats = tickStats;
+    tickStats = {};
+    InvalidateAll();
+}
+
+void NativeCache::Invalidate(Entity entity) {
+    speedVector.Invalidate(entity);
+    speedVectorWorld.Invalidate(entity);
+    coords.Invalidate(entity);
+    forwardVector.Invalidate(entity);
+    engineRunning.Invalidate(entity);
+    numWheels.Invalidate(entity);
+    entityMatrix.Invalidate(entity);
+}
+
+void NativeCache::InvalidateAll() {
+    ++currentTick;
+    // 0 marks invalidated entries
+    if (currentTick == 0)
+        currentTick = 1;
+}
+
+const NativeCache::Stats& NativeCache::GetLastTickStats() {
+    return lastTickStats;
+}
+
+const char* NativeCache::GetNativeName(ENative native) {
+    return nativeNames[static_cast<size_t>(native)];
+}
+
+float NativeCache::GetFrameTime() {
+    return frameTime.Get(ENative::FrameTime, 0, [] {
+        return MISC::GET_FRAME_TIME();
+    });
+}
+
+Vector3 NativeCache::GetEntitySpeedVector(Entity entity, bool relative) {
+    if (relative) {
+        return speedVector.Get(ENative::EntitySpeedVector, entity, [entity] {
+            return ENTITY::GET_ENTITY_SPEED_VECTOR(entity, true);
+        });
+    }
+    return speedVectorWorld.Get(ENative::EntitySpeedVectorWorld, entity, [entity] {
+        return ENTITY::GET_ENTITY_SPEED_VECTOR(entity, false);
+    });
+}
+
+Vector3 NativeCache::GetEntityCoords(Entity entity) {
+    // The 'alive' parameter makes no difference for vehicles.
+    return coords.Get(ENative::EntityCoords, entity, [entity] {
+        return ENTITY::GET_ENTITY_COORDS(entity, true);
+    });
+}
+
+Vector3 NativeCache::GetEntityForwardVector(Entity entity) {
+    return forwardVector.Get(ENative::EntityForwardVector, entity, [entity] {
+        return ENTITY::GET_ENTITY_FORWARD_VECTOR(entity);
+    });
+}
+
+bool NativeCache::GetIsVehicleEngineRunning(Vehicle vehicle) {
+    return engineRunning.Get(ENative::IsVehicleEngineRunning, vehicle, [vehicle] {
+        return static_cast<bool>(VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(vehicle));
+    });
+}
+
+uint8_t NativeCache::GetNumWheels(Vehicle vehicle) {
+    return numWheels.Get(ENative::NumWheels, vehicle, [vehicle] {
+        return VehicleExtensions::GetNumWheels(vehicle);
+    });
+}
+
+NativeMatrix4x4 NativeCache::GetEntityMatrix(Entity entity) {
+    return entityMatrix.Get(ENative::EntityMatrix, entity, [entity] {
+        Vector3 forward, right, up, position;
+        ENTITY::GET_ENTITY_MATRIX(entity, &forward, &right, &up, &position);
+        return EntityMatrix(right, forward, up, position);
+    });
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "../Memory/NativeMatrix.h"
+#include <inc/types.h>
+#include <array>
+#include <cstdint>
+
+/*
+ * Per-tick memoization of natives that many modules call on the same entity.
+ * Results are valid until NewTick(), which the main script calls once per WAIT(0),
+ * or InvalidateAll(), which it calls after the stages that may WAIT mid-tick.
+ * Only use from the main script thread: other script threads (NPC) run their own
+ * WAIT cycle and would see the previous frame's values.
+ * Invalidate an entity after changing state a cached native reports (e.g. engine on/off).
+ */
+namespace NativeCache {
+    enum class ENative {
+        FrameTime,
+        EntitySpeedVector,
+        EntitySpeedVectorWorld,
+        EntityCoords,
+        EntityForwardVector,
+        IsVehicleEngineRunning,
+        NumWheels,
+        EntityMatrix,
+        SIZEOF_ENative
+    };
+
+    struct Counters {
+        uint32_t Hits = 0;
+        uint32_t Misses = 0; // Actual native calls
+    };
+
+    using Stats = std::array<Counters, static_cast<size_t>(ENative::SIZEOF_ENative)>;
+
+    void NewTick();
+    void Invalidate(Entity entity);
+    // Drops all results, but keeps counting this tick. For after stages that may WAIT.
+    void InvalidateAll();
+
+    // Counters of the previous, completed tick
+    const Stats& GetLastTickStats();
+    const char* GetNativeName(ENative native);
+
+    float GetFrameTime();
+    Vector3 GetEntitySpeedVector(Entity entity, bool relative);
+    Vector3 GetEntityCoords(Entity entity);
+    Vector3 GetEntityForwardVector(Entity entity);
+    bool GetIsVehicleEngineRunning(Vehicle vehicle);
+    uint8_t GetNumWheels(Vehicle vehicle);
+    // Local to world transform, see EntityMatrix() in NativeMatrix.h
+    NativeMatrix4x4 GetEntityMatrix(Entity entity);
+}
@@ -0,0 +1,105 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+
+namespace {
+    // deque: references stay valid as stages get registered.
+    std::deque<Profiler::Stage> stageStorage;
+    std::vector<Profiler::Stage*> stages;
+}
+
+bool Profiler::detail::enabled = false;
+
+Profiler::Stage::Stage(const char* name)
+    : mName(name) {
+}
+
+void Profiler::Stage::EndTick() {
+    // Stages that didn't run this tick shouldn't drag the stats down.
+    if (mTickCalls == 0)
+        return;
+
+    mWindow[mHead] = static_cast<float>(mTickNs) / 1000.0f;
+    mHead = (mHead + 1) % WindowSize;
+    mCount = std::min(mCount + 1, WindowSize);
+    mTickNs = 0;
+    mTickCalls = 0;
+}
+
+void Profiler::Stage::Reset() {
+    mTickNs = 0;
+    mTickCalls = 0;
+    mHead = 0;
+    mCount = 0;
+}
+
+Profiler::Stats Profiler::Stage::GetStats() const {
+    Stats stats;
+    if (mCount == 0)
+        return stats;
+
+    std::array<float, WindowSize> sorted;
+    std::copy_n(mWindow.begin(), mCount, sorted.begin());
+    auto first = sorted.begin();
+    auto last = sorted.begin() + mCount;
+
+    float sum = 0.0f;
+    for (auto it = first; it != last; ++it)
+        sum += *it;
+
+    size_t p99Idx = std::min(mCount - 1, (mCount * 99) / 100);
+    std::nth_element(first, first + p99Idx, last);
+
+    stats.P99 = sorted[p99Idx];
+    stats.Min = *std::min_element(first, last);
+    stats.Max = *std::max_element(first, last);
+    stats.Avg = sum / static_cast<float>(mCount);
+    stats.Last = mWindow[(mHead + WindowSize - 1) % WindowSize];
+    stats.Samples = mCount;
+    return stats;
+}
+
+void Profiler::SetEnabled(bool enabled) {
+    if (enabled && !detail::enabled)
+        Reset();
+    detail::enabled = enabled;
+}
+
+Profiler::Stage& Profiler::Register(const char* name) {
+    Stage& stage = stageStorage.emplace_back(name);
+    stages.push_back(&stage);
+    return stage;
+}
+
+void Profiler::EndTick() {
+    if (!Enabled())
+        return;
+
+    for (auto* stage : stages)
+        stage->EndTick();
+}
+
+void Profiler::Reset() {
+    for (auto* stage : stages)
+        stage->Reset();
+}
+
+const std::vector<Profiler::Stage*>& Profiler::GetStages() {
+    return stages;
+}
+
+bool Profiler::DumpCSV(const std::string& file) {
+    std::ofstream csv(file, std::ofstream::out | std::ofstream::trunc);
+    if (!csv.is_open())
+        return false;
+
+    csv << "stage,samples,min_us,avg_us,p99_us,max_us\n";
+    for (const auto* stage : stages) {
+        Stats stats = stage->GetStats();
+        csv << "\"" << stage->Name() << "\"," << stats.Samples << ","
+            << stats.Min << "," << stats.Avg << "," << stats.P99 << "," << stats.Max << "\n";
+    }
+    return !csv.fail();
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * Per-stage tick profiler.
+ * PROFILE_SCOPE("name") times the enclosing scope, PROFILE_CALL(fn()) times a call.
+ * Time spent per stage is summed over a tick, and Profiler::EndTick() pushes the
+ * totals into a rolling window from which min/avg/p99/max are derived on request.
+ * When disabled at runtime the cost is a single branch, defining MT_NO_PROFILER
+ * compiles it out entirely.
+ */
+namespace Profiler {
+    constexpr size_t WindowSize = 256;
+
+    struct Stats {
+        float Min = 0.0f; // microseconds
+        float Avg = 0.0f;
+        float P99 = 0.0f;
+        float Max = 0.0f;
+        float Last = 0.0f;
+        size_t Samples = 0;
+    };
+
+    class Stage {
+    public:
+        explicit Stage(const char* name);
+
+        void Add(int64_t nanoseconds) {
+            mTickNs += nanoseconds;
+            ++mTickCalls;
+        }
+
+        // Commits the accumulated time of this tick to the window.
+        void EndTick();
+        void Reset();
+        Stats GetStats() const;
+        const char* Name() const { return mName; }
+
+    private:
+        const char* mName;
+        int64_t mTickNs = 0;
+        uint32_t mTickCalls = 0;
+        std::array<float, WindowSize> mWindow{};
+        size_t mHead = 0;
+        size_t mCount = 0;
+    };
+
+    namespace detail {
+        extern bool enabled;
+    }
+
+    inline bool Enabled() {
+        return detail::enabled;
+    }
+
+    void SetEnabled(bool enabled);
+
+    // Stages live until the script unloads. Call once per site (function-local static).
+    Stage& Register(const char* name);
+
+    void EndTick();
+    void Reset();
+
+    // Stages in registration order.
+    const std::vector<Stage*>& GetStages();
+
+    bool DumpCSV(const std::string& file);
+
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(Stage& stage)
+            : mStage(Enabled() ? &stage : nullptr) {
+            if (mStage)
+                mStart = std::chrono::steady_clock::now();
+        }
+
+        ~ScopedTimer() {
+            if (mStage) {
+                auto elapsed = std::chrono::steady_clock::now() - mStart;
+                mStage->Add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            }
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        Stage* mStage;
+        std::chrono::steady_clock::time_point mStart;
+    };
+}
+
+#define PROFILER_CONCAT_IMPL(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_IMPL(a, b)
+
+#ifndef MT_NO_PROFILER
+#define PROFILE_SCOPE(name) \
+    static Profiler::Stage& PROFILER_CONCAT(profilerStage_, __LINE__) = Profiler::Register(name); \
+    Profiler::ScopedTimer PROFILER_CONCAT(profilerTimer_, __LINE__)(PROFILER_CONCAT(profilerStage_, __LINE__))
+#else
+#define PROFILE_SCOPE(name) do {} while (0)
+#endif
+
+#define PROFILE_CALL(call) \
+    do { PROFILE_SCOPE(#call); call; } while (0)
@@ -0,0 +1,66 @@
+#include "Scheduler.h"
+
+#include <algorithm>
+
+namespace {
+    std::vector<Scheduler::Task*>& tasks() {
+        // Function-local: tasks may be constructed during static initialization.
+        static std::vector<Scheduler::Task*> registered;
+        return registered;
+    }
+}
+
+Scheduler::Task::Task(const char* name, float rateHz)
+    : mName(name)
+    , mRate(rateHz)
+    , mDt(rateHz > 0.0f ? 1.0f / rateHz : 0.0f) {
+    tasks().push_back(this);
+}
+
+Scheduler::Task::~Task() {
+    auto& registered = tasks();
+    registered.erase(std::remove(registered.begin(), registered.end(), this), registered.end());
+}
+
+uint32_t Scheduler::Task::Advance(float frameTime) {
+    if (mRate <= 0.0f) {
+        mDt = frameTime;
+        mSteps = 1;
+        return mSteps;
+    }
+
+    mAccumulator += std::max(frameTime, 0.0f);
+    mSteps = static_cast<uint32_t>(mAccumulator / mDt);
+    mAccumulator -= static_cast<float>(mSteps) * mDt;
+
+    // Slow frames are made up over the next frames. A hitch carries at most
+    // MaxStepsPerFrame steps over, not seconds of them.
+    if (mSteps > MaxStepsPerFrame) {
+        float carry = static_cast<float>(mSteps - MaxStepsPerFrame) * mDt;
+        mAccumulator = std::min(mAccumulator + carry, static_cast<float>(MaxStepsPerFrame) * mDt);
+        mSteps = MaxStepsPerFrame;
+    }
+    return mSteps;
+}
+
+void Scheduler::Task::SetRate(float rateHz) {
+    if (rateHz == mRate)
+        return;
+    mRate = rateHz;
+    mDt = rateHz > 0.0f ? 1.0f / rateHz : 0.0f;
+}
+
+void Scheduler::Task::Reset() {
+    mAccumulator = 0.0f;
+    mSteps = 0;
+}
+
+float Scheduler::Task::Alpha() const {
+    if (mRate <= 0.0f)
+        return 1.0f;
+    return std::clamp(mAccumulator / mDt, 0.0f, 1.0f);
+}
+
+const std::vector<Scheduler::Task*>& Scheduler::GetTasks() {
+    return tasks();
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+/*
+ * Fixed-rate stepping, decoupled from the render frame rate.
+ * A Task accumulates frame time in Advance() and runs as many fixed steps as fit,
+ * carrying the remainder over to the next frame.
+ * - Samplers that only need to run "at most N Hz" check Steps() and hold their
+ *   previous output on frames without a step.
+ * - Integrators use Elapsed() (Steps() * Dt()) instead of the frame time, so they
+ *   progress in the same increments at 30 or 240 FPS.
+ * A rate of 0 steps once every frame with the frame time as Dt().
+ * Advance a task from one script thread only, once per WAIT(0) of that thread.
+ */
+namespace Scheduler {
+    class Task {
+    public:
+        Task(const char* name, float rateHz);
+        ~Task();
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        // Returns the number of steps due this frame.
+        uint32_t Advance(float frameTime);
+        // For rates that come from the settings. Keeps the accumulated time.
+        void SetRate(float rateHz);
+        // Drops accumulated time, e.g. after a vehicle switch.
+        void Reset();
+
+        uint32_t Steps() const { return mSteps; }
+        float Dt() const { return mDt; }
+        float Elapsed() const { return static_cast<float>(mSteps) * mDt; }
+        // How far the frame is between the last step and the next, 0 to 1.
+        // For interpolating held outputs.
+        float Alpha() const;
+
+        const char* Name() const { return mName; }
+        float Rate() const { return mRate; }
+
+    private:
+        const char* mName;
+        float mRate;
+        float mDt;
+        float mAccumulator = 0.0f;
+        uint32_t mSteps = 0;
+    };
+
+    // After a hitch (loading, pause menu) don't try to catch up on seconds of steps.
+    // Steps over this are carried to the next frames, up to this many.
+    constexpr uint32_t MaxStepsPerFrame = 4;
+
+    // Tasks in construction order.
+    const std::vector<Task*>& GetTasks();
+}
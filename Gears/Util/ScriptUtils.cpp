@@ -2,6 +2,7 @@
 
 #include "MathExt.h"
 #include "../Memory/VehicleExtensions.hpp"
+#include "../Memory/NativeMatrix.h"
 
 #include <inc/natives.h>
 #include <fmt/format.h>
@@ -34,20 +35,9 @@ bool Util::IsPedOnSeat(Vehicle vehicle, Ped ped, int seat) {
         VEHICLE::GET_PED_IN_VEHICLE_SEAT(pedVehicle, seat, 0) == ped;
 }
 
-// TODO: Would be neat if natives could be ditched.
 std::vector<Vector3> Util::GetWheelCoords(Vehicle handle) {
-    std::vector<Vector3> worldCoords;
-    std::vector<Vector3> positions = VehicleExtensions::GetWheelOffsets(handle);
-    Vector3 position = ENTITY::GET_ENTITY_COORDS(handle, true);
-    Vector3 rotation = ENTITY::GET_ENTITY_ROTATION(handle, 0);
-    rotation.x = deg2rad(rotation.x);
-    rotation.y = deg2rad(rotation.y);
-    rotation.z = deg2rad(rotation.z);
-    Vector3 direction = ENTITY::GET_ENTITY_FORWARD_VECTOR(handle);
-
-    worldCoords.reserve(positions.size());
-    for (const auto& wheelPos : positions) {
-        worldCoords.emplace_back(GetOffsetInWorldCoords(position, rotation, direction, wheelPos));
-    }
-    return worldCoords;
+    Vector3 forward, right, up, position;
+    ENTITY::GET_ENTITY_MATRIX(handle, &forward, &right, &up, &position);
+    return TransformPoints(EntityMatrix(right, forward, up, position),
+        VehicleExtensions::GetWheelOffsets(handle));
 }
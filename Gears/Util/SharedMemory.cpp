@@ -0,0 +1,124 @@
+#include "SharedMemory.h"
+
+#include "Logger.hpp"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SharedMemory::~SharedMemory() {
+    Close();
+}
+
+bool SharedMemory::Create(const std::string& name, size_t size) {
+    return map(name, size, true);
+}
+
+bool SharedMemory::Open(const std::string& name, size_t size) {
+    return map(name, size, false);
+}
+
+#ifdef _WIN32
+bool SharedMemory::map(const std::string& name, size_t size, bool create) {
+    Close();
+    std::string fullName = "Local\\" + name;
+
+    HANDLE handle;
+    if (create) {
+        uint64_t size64 = size;
+        handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+            static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64 & 0xFFFFFFFF), fullName.c_str());
+    }
+    else {
+        handle = OpenFileMappingA(FILE_MAP_READ, FALSE, fullName.c_str());
+    }
+
+    if (!handle) {
+        if (create)
+            logger.Write(ERROR, "[SharedMemory] Failed to create [%s]: %lu", fullName.c_str(), GetLastError());
+        return false;
+    }
+
+    void* data = MapViewOfFile(handle, create ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+    if (!data) {
+        logger.Write(ERROR, "[SharedMemory] Failed to map [%s]: %lu", fullName.c_str(), GetLastError());
+        CloseHandle(handle);
+        return false;
+    }
+
+    mHandle = handle;
+    mData = data;
+    mSize = size;
+    mName = fullName;
+    mOwner = create;
+    return true;
+}
+
+void SharedMemory::Close() {
+    if (mData)
+        UnmapViewOfFile(mData);
+    if (mHandle)
+        CloseHandle(static_cast<HANDLE>(mHandle));
+    mData = nullptr;
+    mHandle = nullptr;
+    mSize = 0;
+    mOwner = false;
+}
+#else
+bool SharedMemory::map(const std::string& name, size_t size, bool create) {
+    Close();
+    std::string fullName = "/" + name;
+
+    int fd = create
+        ? shm_open(fullName.c_str(), O_CREAT | O_RDWR, 0644)
+        : shm_open(fullName.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        if (create)
+            logger.Write(ERROR, "[SharedMemory] Failed to create [%s]", fullName.c_str());
+        return false;
+    }
+
+    struct stat info{};
+    bool sizeOk = fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= size;
+    if (!sizeOk && create)
+        sizeOk = ftruncate(fd, static_cast<off_t>(size)) == 0;
+    if (!sizeOk) {
+        if (create)
+            logger.Write(ERROR, "[SharedMemory] Failed to size [%s] to %zu bytes", fullName.c_str(), size);
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, size, create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        logger.Write(ERROR, "[SharedMemory] Failed to map [%s]", fullName.c_str());
+        close(fd);
+        return false;
+    }
+
+    mFd = fd;
+    mData = data;
+    mSize = size;
+    mName = fullName;
+    mOwner = create;
+    return true;
+}
+
+void SharedMemory::Close() {
+    if (mData)
+        munmap(mData, mSize);
+    if (mFd >= 0)
+        close(mFd);
+    if (mOwner)
+        shm_unlink(mName.c_str());
+    mData = nullptr;
+    mFd = -1;
+    mSize = 0;
+    mOwner = false;
+}
+#endif
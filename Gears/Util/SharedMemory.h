@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+/*
+ * Named shared memory, mapped into this process.
+ * Windows: a pagefile-backed file mapping in the session namespace ("Local\name").
+ * Elsewhere: a POSIX shm_open object ("/name").
+ * The creator owns the name: on POSIX it's unlinked on Close(), on Windows it
+ * goes away with the last handle. Memory is zeroed when first created.
+ */
+class SharedMemory {
+public:
+    SharedMemory() = default;
+    ~SharedMemory();
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory& operator=(const SharedMemory&) = delete;
+
+    // Read-write, creates the mapping or attaches to an existing one of at least size bytes.
+    bool Create(const std::string& name, size_t size);
+    // Read-only, fails if the mapping doesn't exist (yet).
+    bool Open(const std::string& name, size_t size);
+    void Close();
+
+    bool IsOpen() const { return mData != nullptr; }
+    void* Data() const { return mData; }
+    size_t Size() const { return mSize; }
+
+private:
+    bool map(const std::string& name, size_t size, bool create);
+
+    void* mData = nullptr;
+    size_t mSize = 0;
+    std::string mName;
+    bool mOwner = false;
+#ifdef _WIN32
+    void* mHandle = nullptr;
+#else
+    int mFd = -1;
+#endif
+};
@@ -0,0 +1,197 @@
+#include "SpeedTimers.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+    struct Unit {
+        const char* Name;
+        SpeedTimers::EKind Kind;
+        float ToSI;
+    };
+
+    constexpr std::array<Unit, 5> units{ {
+        { "kph", SpeedTimers::EKind::Speed, 1.0f / 3.6f },
+        { "mph", SpeedTimers::EKind::Speed, 0.44704f },
+        { "m/s", SpeedTimers::EKind::Speed, 1.0f },
+        { "m",   SpeedTimers::EKind::Distance, 1.0f },
+        { "ft",  SpeedTimers::EKind::Distance, 0.3048f },
+    } };
+
+    // Time into a tick where the distance reaches target, with speed linear over the tick.
+    double distanceCrossing(double d0, float v0, float v1, double dt, double target) {
+        double remaining = target - d0;
+        double accel = (v1 - v0) / dt;
+        if (std::abs(accel) < 1e-6)
+            return v0 > 0.0f ? remaining / v0 : dt;
+
+        double disc = static_cast<double>(v0) * v0 + 2.0 * accel * remaining;
+        double tau = (-v0 + std::sqrt(std::max(0.0, disc))) / accel;
+        return std::clamp(tau, 0.0, dt);
+    }
+}
+
+bool SpeedTimers::MakeWindow(const std::string& unit, float limA, float limB, float tolerance, Window& window) {
+    auto it = std::find_if(units.begin(), units.end(), [&](const Unit& u) { return unit == u.Name; });
+    if (it == units.end())
+        return false;
+
+    window.Kind = it->Kind;
+    window.From = limA * it->ToSI;
+    window.To = limB * it->ToSI;
+    // Distance windows start from standstill, tolerance is a speed in m/s there.
+    window.Tolerance = it->Kind == EKind::Speed ? tolerance * it->ToSI : tolerance;
+    window.Label = fmt::format("{} - {} {}", limA, limB, unit);
+    return true;
+}
+
+void SpeedTimers::Engine::Configure(std::vector<Window> windows) {
+    mWindows = std::move(windows);
+    mStates.assign(mWindows.size(), State{});
+    mHasSample = false;
+    mHasSlope = false;
+    mNumResults = 0;
+}
+
+void SpeedTimers::Engine::Reset() {
+    std::fill(mStates.begin(), mStates.end(), State{});
+    mHasSample = false;
+    mHasSlope = false;
+}
+
+void SpeedTimers::Engine::Update(double time, float speed) {
+    if (mHasSample && time > mLastTime) {
+        for (size_t i = 0; i < mWindows.size(); ++i)
+            updateWindow(mWindows[i], mStates[i], mLastTime, mLastSpeed, time, speed);
+        mLastSlope = static_cast<float>((speed - mLastSpeed) / (time - mLastTime));
+        mHasSlope = true;
+    }
+    mHasSample = true;
+    mLastTime = time;
+    mLastSpeed = speed;
+}
+
+void SpeedTimers::Engine::updateWindow(const Window& window, State& state, double t0, float v0, double t1, float v1) {
+    const double dt = t1 - t0;
+
+    // Progress past the start speed. Distance windows start from standstill.
+    const bool isSpeed = window.Kind == EKind::Speed;
+    const float startSpeed = isSpeed ? window.From : 0.0f;
+    const float dir = isSpeed && window.To < window.From ? -1.0f : 1.0f;
+    float p0 = dir * (v0 - startSpeed);
+    const float p1 = dir * (v1 - startSpeed);
+    const float tol = window.Tolerance;
+
+    if (state.Phase == EPhase::Idle) {
+        if (p1 <= tol)
+            state.Phase = EPhase::Armed;
+        return;
+    }
+
+    if (state.Phase == EPhase::Armed) {
+        if (!(p1 > 0.0f && p0 <= tol && (p0 <= 0.0f || p1 > tol)))
+            return;
+
+        state.Phase = EPhase::Running;
+        state.Start = p0 <= 0.0f ? t0 + (-p0) / (p1 - p0) * dt : t0;
+        state.Refine = std::abs(p0) <= tol;
+        state.RefineMin = t0;
+        state.RefineMax = t1;
+        state.MarkTime = -1.0;
+        // The window may already end within this tick: continue from the start.
+        if (p0 <= 0.0f) {
+            t0 = state.Start;
+            v0 = startSpeed;
+            p0 = 0.0f;
+        }
+        state.Distance = 0.5 * (v0 + v1) * (t1 - t0);
+    }
+    else {
+        if (state.Refine) {
+            state.Refine = false;
+            float slope = (p1 - p0) / static_cast<float>(dt);
+            if (slope > 0.0f) {
+                state.Start = std::clamp(t0 - p0 / slope, state.RefineMin, state.RefineMax);
+                state.Distance = 0.5 * (startSpeed + v0) * (t0 - state.Start);
+            }
+        }
+
+        // Fell back before the start: re-arm and wait for the next launch.
+        if (p1 <= 0.0f) {
+            state.Phase = EPhase::Armed;
+            return;
+        }
+
+        if (!isSpeed)
+            state.Distance += 0.5 * (v0 + v1) * dt;
+    }
+
+    if (isSpeed) {
+        const float length = std::abs(window.To - window.From);
+        if (p1 >= length) {
+            double end = std::abs(p1 - length) <= tol ?
+                stopCrossing(t0, t1, p0, length, dir) :
+                t0 + (length - p0) / (p1 - p0) * (t1 - t0);
+            record(window, end - state.Start, window.To);
+            state.Phase = EPhase::Idle;
+        }
+        return;
+    }
+
+    // Distance reached this tick, see where in the tick it happened.
+    const double tickDistance = 0.5 * (v0 + v1) * (t1 - t0);
+    const double d0 = state.Distance - tickDistance;
+    if (window.From > 0.0f && state.MarkTime < 0.0 && state.Distance >= window.From)
+        state.MarkTime = t0 + distanceCrossing(d0, v0, v1, t1 - t0, window.From);
+
+    if (state.Distance >= window.To) {
+        double tau = distanceCrossing(d0, v0, v1, t1 - t0, window.To);
+        double from = window.From > 0.0f ? state.MarkTime : state.Start;
+        float endSpeed = v0 + static_cast<float>((v1 - v0) * tau / (t1 - t0));
+        record(window, t0 + tau - from, endSpeed);
+        state.Phase = EPhase::Idle;
+    }
+}
+
+double SpeedTimers::Engine::stopCrossing(double t0, double t1, float p0, float length, float dir) const {
+    float slope = dir * mLastSlope;
+    if (!mHasSlope || slope <= 0.0f)
+        return t1;
+    return std::clamp(t0 + (length - p0) / slope, t0, t1);
+}
+
+void SpeedTimers::Engine::record(const Window& window, double time, float endSpeed) {
+    // Oldest results are kept, the caller drains every tick anyway.
+    if (mNumResults >= MaxResults)
+        return;
+    mResults[mNumResults++] = { window.Label.c_str(), window.Kind, time, endSpeed };
+}
+
+bool SpeedTimers::AppendResult(const std::string& file, const std::string& vehicle, const Result& result) {
+    bool newFile = !std::filesystem::exists(file);
+    std::ofstream csv(file, std::ofstream::out | std::ofstream::app);
+    if (!csv.is_open())
+        return false;
+
+    if (newFile)
+        csv << "date,vehicle,window,time_s,end_speed_ms\n";
+
+    std::time_t now = std::time(nullptr);
+    std::tm localTime{};
+#ifdef _WIN32
+    localtime_s(&localTime, &now);
+#else
+    localtime_r(&now, &localTime);
+#endif
+    char date[32];
+    strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", &localTime);
+
+    csv << date << ",\"" << vehicle << "\",\"" << result.Label << "\","
+        << fmt::format("{:.4f},{:.2f}", result.Time, result.EndSpeed) << "\n";
+    return !csv.fail();
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/*
+ * Acceleration timing over speed windows (0-100 kph) and distance windows
+ * (quarter mile from standstill). All windows are evaluated in one pass per
+ * tick without allocating. Crossing times are interpolated between samples
+ * assuming linear speed over a tick, and a standing start is extrapolated back
+ * from the first moving tick (and a stop forward from the last braking tick),
+ * so results don't depend on the frame rate.
+ */
+namespace SpeedTimers {
+    enum class EKind {
+        Speed,
+        Distance,
+    };
+
+    struct Window {
+        EKind Kind = EKind::Speed;
+        // Speed: m/s. Distance: m, traveled since leaving standstill.
+        float From = 0.0f;
+        float To = 0.0f;
+        float Tolerance = 0.0f; // m/s, how close to the start speed arms the window
+        std::string Label;
+    };
+
+    // Units: kph, mph, m/s for speed, m, ft for distance.
+    bool MakeWindow(const std::string& unit, float limA, float limB, float tolerance, Window& window);
+
+    struct Result {
+        const char* Label = nullptr;    // Owned by the engine's windows
+        EKind Kind = EKind::Speed;
+        double Time = 0.0;              // s
+        float EndSpeed = 0.0f;          // m/s
+    };
+
+    class Engine {
+    public:
+        static constexpr size_t MaxResults = 16;
+
+        void Configure(std::vector<Window> windows);
+        // Drops runs in progress, e.g. on vehicle change.
+        void Reset();
+
+        // time: s, monotonic. speed: m/s.
+        void Update(double time, float speed);
+
+        // Runs completed since ClearResults().
+        size_t NumResults() const { return mNumResults; }
+        const Result& GetResult(size_t index) const { return mResults[index]; }
+        void ClearResults() { mNumResults = 0; }
+
+        bool Empty() const { return mWindows.empty(); }
+
+    private:
+        enum class EPhase {
+            Idle,
+            Armed,
+            Running,
+        };
+
+        struct State {
+            EPhase Phase = EPhase::Idle;
+            double Start = 0.0;
+            // Standing start: pinned down with the next tick's slope.
+            bool Refine = false;
+            double RefineMin = 0.0;
+            double RefineMax = 0.0;
+            // Distance windows
+            double Distance = 0.0;
+            double MarkTime = -1.0;
+        };
+
+        void updateWindow(const Window& window, State& state, double t0, float v0, double t1, float v1);
+        // Ending exactly on the limit (stopped): the tick before had the real slope.
+        double stopCrossing(double t0, double t1, float p0, float length, float dir) const;
+        void record(const Window& window, double time, float endSpeed);
+
+        std::vector<Window> mWindows;
+        std::vector<State> mStates;
+        bool mHasSample = false;
+        double mLastTime = 0.0;
+        float mLastSpeed = 0.0f;
+        bool mHasSlope = false;
+        float mLastSlope = 0.0f;   // m/s^2, of the previous tick
+        std::array<Result, MaxResults> mResults{};
+        size_t mNumResults = 0;
+    };
+
+    // Appends a CSV line to file, with a header if it's new.
+    bool AppendResult(const std::string& file, const std::string& vehicle, const Result& result);
+}
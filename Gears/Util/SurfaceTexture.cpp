@@ -0,0 +1,68 @@
+#include "SurfaceTexture.h"
+
+#include "Materials.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float twoPi = 6.28318530718f;
+
+    // Above this fraction of the update rate the oscillator would alias into a
+    // slow wobble, so fast bumps are capped to a buzz at the highest rate we can show.
+    constexpr float maxCyclesPerStep = 0.45f;
+}
+
+SurfaceTexture::Generator::Generator(uint32_t seed)
+    : mSeed(seed == 0 ? 1 : seed)
+    , mState(mSeed) {
+    Reset();
+}
+
+float SurfaceTexture::Generator::Step(const WheelSample* wheels, size_t count, float dt) {
+    count = std::min(count, MaxWheels);
+    if (dt <= 0.0f)
+        return 0.0f;
+
+    float mixed = 0.0f;
+
+    for (size_t i = 0; i < count; ++i) {
+        const auto& wheel = wheels[i];
+        auto& osc = mOscillators[i];
+        const auto& surface = Materials::GetProperties(wheel.Material);
+
+        float speed = std::abs(wheel.Speed);
+        if (!wheel.OnGround || surface.RumbleAmplitude <= 0.0f || surface.RumbleFrequency <= 0.0f || speed <= 0.0f)
+            continue;
+
+        float cycles = std::min(surface.RumbleFrequency * speed * dt, maxCyclesPerStep);
+        osc.Phase += cycles;
+        if (osc.Phase >= 1.0f) {
+            osc.Phase -= std::floor(osc.Phase);
+            // Next bump: periodic surfaces keep full height, noisy ones vary.
+            osc.BumpScale = 1.0f - surface.RumbleNoise + surface.RumbleNoise * random();
+        }
+
+        float amplitude = surface.RumbleAmplitude * std::min(speed / FullSpeed, 1.0f);
+        mixed += wheel.Side * wheel.Weight * amplitude * osc.BumpScale * std::sin(twoPi * osc.Phase);
+    }
+
+    return std::clamp(mixed, -1.0f, 1.0f);
+}
+
+void SurfaceTexture::Generator::Reset() {
+    mState = mSeed;
+    // Spread the starting phases, so wheels hitting the same strip don't cancel out.
+    for (auto& osc : mOscillators) {
+        osc.Phase = random();
+        osc.BumpScale = 1.0f;
+    }
+}
+
+float SurfaceTexture::Generator::random() {
+    // xorshift32, deterministic so replays give the same output
+    mState ^= mState << 13;
+    mState ^= mState >> 17;
+    mState ^= mState << 5;
+    return static_cast<float>(mState >> 8) / static_cast<float>(1u << 24);
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Road surface feel for FFB: rumble strips, cobbles, gravel and the like.
+ * Each wheel runs an oscillator whose frequency follows the wheel speed and the
+ * bump spacing of the material under it (Materials::PropertyTable), with a random
+ * amplitude per bump on noisy surfaces. The per-wheel signals are mixed into one
+ * value to add to the constant force, once per FFB update.
+ * Doesn't touch natives, so recorded material sequences can be replayed through it.
+ */
+namespace SurfaceTexture {
+    constexpr size_t MaxWheels = 10;
+
+    struct WheelSample {
+        uint16_t Material = 0;
+        float Speed = 0.0f;     // m/s, tyre surface speed
+        float Side = 0.0f;      // -1: pulls the rim left, 1: pulls it right
+        float Weight = 1.0f;    // Share in the mix, e.g. less for unsteered wheels
+        bool OnGround = false;
+    };
+
+    class Generator {
+    public:
+        explicit Generator(uint32_t seed = 0x9E3779B9u);
+
+        // Advances all oscillators by dt seconds and returns the mixed texture,
+        // -1 to 1 of the texture force limit. Wheels past MaxWheels are ignored.
+        float Step(const WheelSample* wheels, size_t count, float dt);
+
+        // Forgets oscillator phases, e.g. after a vehicle switch.
+        void Reset();
+
+        // Amplitude ramps up linearly from standstill to this speed.
+        static constexpr float FullSpeed = 10.0f; // m/s
+
+    private:
+        struct Oscillator {
+            float Phase = 0.0f;         // 0 to 1, a full period is one bump
+            float BumpScale = 1.0f;     // Random amplitude of the current bump
+        };
+
+        float random();
+
+        std::array<Oscillator, MaxWheels> mOscillators{};
+        uint32_t mSeed;
+        uint32_t mState;
+    };
+}
@@ -0,0 +1,221 @@
+#include "TaskPool.h"
+
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using TaskPool::detail::Job;
+
+namespace {
+    struct Worker {
+        std::mutex Mutex;
+        std::array<std::deque<std::unique_ptr<Job>>, TaskPool::PriorityCount> Queues;
+        std::thread Thread;
+    };
+
+    // How long Shutdown waits for running jobs before abandoning the workers.
+    constexpr auto shutdownTimeout = std::chrono::milliseconds(250);
+
+    constexpr size_t notAWorker = static_cast<size_t>(-1);
+
+    std::array<Worker, TaskPool::MaxWorkers> workers;
+    size_t workerCount = 0;
+    std::once_flag startFlag;
+
+    std::atomic<size_t> nextWorker = 0;
+    // Jobs in any queue. Sleeping workers wake up when this goes above 0.
+    std::atomic<size_t> pending = 0;
+    std::atomic<bool> stopping = false;
+
+    std::mutex sleepMutex;
+    std::condition_variable sleepCv;
+    size_t exitedWorkers = 0;
+
+    // Shared by all CancelToken::WaitFor calls, cancelling is rare enough.
+    std::mutex cancelMutex;
+    std::condition_variable cancelCv;
+
+    std::atomic<uint64_t> submitted = 0;
+    std::atomic<uint64_t> executed = 0;
+    std::atomic<uint64_t> stolen = 0;
+    std::atomic<uint64_t> cancelled = 0;
+
+    thread_local size_t currentWorker = notAWorker;
+
+    // Without Shutdown(), e.g. on process exit, destroying a joinable thread terminates.
+    struct DetachOnExit {
+        ~DetachOnExit() {
+            stopping = true;
+            sleepCv.notify_all();
+            for (auto& worker : workers) {
+                if (worker.Thread.joinable())
+                    worker.Thread.detach();
+            }
+        }
+    } detachOnExit;
+
+    // Own queues newest first, then the oldest job of the others, per priority.
+    std::unique_ptr<Job> take(size_t self) {
+        for (size_t priority = 0; priority < TaskPool::PriorityCount; ++priority) {
+            {
+                Worker& own = workers[self];
+                std::lock_guard lock(own.Mutex);
+                auto& queue = own.Queues[priority];
+                if (!queue.empty()) {
+                    auto job = std::move(queue.back());
+                    queue.pop_back();
+                    --pending;
+                    return job;
+                }
+            }
+
+            for (size_t i = 1; i < workerCount; ++i) {
+                Worker& victim = workers[(self + i) % workerCount];
+                std::lock_guard lock(victim.Mutex);
+                auto& queue = victim.Queues[priority];
+                if (!queue.empty()) {
+                    auto job = std::move(queue.front());
+                    queue.pop_front();
+                    --pending;
+                    ++stolen;
+                    return job;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    void workerMain(size_t index) {
+        currentWorker = index;
+        while (!stopping) {
+            if (auto job = take(index)) {
+                if (job->Run())
+                    ++executed;
+                else
+                    ++cancelled;
+                continue;
+            }
+
+            std::unique_lock lock(sleepMutex);
+            sleepCv.wait(lock, [] { return pending > 0 || stopping; });
+        }
+
+        // Notified under the lock, so Shutdown can't return and let the process tear
+        // down sleepCv while this is still in notify_all.
+        std::lock_guard lock(sleepMutex);
+        ++exitedWorkers;
+        sleepCv.notify_all();
+    }
+
+    void start() {
+        unsigned hardwareThreads = std::thread::hardware_concurrency();
+        // Leave most cores to the game, this is background work.
+        workerCount = std::clamp<size_t>(hardwareThreads / 2, 1, TaskPool::MaxWorkers);
+        for (size_t i = 0; i < workerCount; ++i) {
+            workers[i].Thread = std::thread([i] { workerMain(i); });
+        }
+        logger.Write(DEBUG, "[TaskPool] Started %zu workers", workerCount);
+    }
+}
+
+TaskPool::CancelToken::CancelToken()
+    : mCancelled(std::make_shared<std::atomic<bool>>(false)) {}
+
+bool TaskPool::CancelToken::IsCancelled() const {
+    return *mCancelled || stopping;
+}
+
+void TaskPool::CancelToken::Cancel() const {
+    {
+        std::lock_guard lock(cancelMutex);
+        *mCancelled = true;
+    }
+    cancelCv.notify_all();
+}
+
+bool TaskPool::CancelToken::WaitFor(std::chrono::milliseconds duration) const {
+    std::unique_lock lock(cancelMutex);
+    return cancelCv.wait_for(lock, duration, [this] { return IsCancelled(); });
+}
+
+void TaskPool::detail::Enqueue(std::unique_ptr<Job> job, Priority priority) {
+    ++submitted;
+    // Don't start workers after Shutdown
+    if (stopping) {
+        job->Abandon();
+        ++cancelled;
+        return;
+    }
+
+    std::call_once(startFlag, start);
+
+    size_t index = currentWorker != notAWorker ? currentWorker : nextWorker++ % workerCount;
+    {
+        Worker& worker = workers[index];
+        std::lock_guard lock(worker.Mutex);
+        // Checked under the queue lock, so Shutdown can't miss a job pushed concurrently.
+        if (stopping) {
+            job->Abandon();
+            ++cancelled;
+            return;
+        }
+        worker.Queues[static_cast<size_t>(priority)].push_back(std::move(job));
+        ++pending;
+    }
+
+    std::lock_guard lock(sleepMutex);
+    sleepCv.notify_one();
+}
+
+size_t TaskPool::WorkerCount() {
+    return workerCount;
+}
+
+TaskPool::Stats TaskPool::GetStats() {
+    return Stats{ submitted, executed, stolen, cancelled };
+}
+
+void TaskPool::Shutdown() {
+    if (stopping.exchange(true))
+        return;
+
+    {
+        std::lock_guard lock(cancelMutex);
+    }
+    cancelCv.notify_all();
+
+    std::unique_lock lock(sleepMutex);
+    sleepCv.notify_all();
+    // Waiting on a count instead of join(): this runs from DllMain under the loader
+    // lock, where joining a thread that still has to exit deadlocks. A job that ignores
+    // its CancelToken keeps its worker busy, that worker is left behind detached.
+    sleepCv.wait_for(lock, shutdownTimeout, [] { return exitedWorkers == workerCount; });
+    size_t busyWorkers = workerCount - exitedWorkers;
+    lock.unlock();
+
+    for (size_t i = 0; i < workerCount; ++i) {
+        Worker& worker = workers[i];
+        if (worker.Thread.joinable())
+            worker.Thread.detach();
+
+        std::lock_guard queueLock(worker.Mutex);
+        for (auto& queue : worker.Queues) {
+            for (auto& job : queue) {
+                job->Abandon();
+                ++cancelled;
+            }
+            queue.clear();
+        }
+    }
+    pending = 0;
+
+    if (busyWorkers > 0)
+        logger.Write(WARN, "[TaskPool] Shutdown: %zu of %zu workers still busy", busyWorkers, workerCount);
+    logger.Write(DEBUG, "[TaskPool] Shutdown: %llu submitted, %llu executed, %llu stolen, %llu cancelled",
+        submitted.load(), executed.load(), stolen.load(), cancelled.load());
+}
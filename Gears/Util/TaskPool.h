@@ -0,0 +1,176 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Process-wide pool for background work: pattern scans, config parsing, file I/O,
+ * update checks. A fixed number of workers each own a deque per priority. Workers
+ * pop their own newest job first and steal the oldest job of others when idle,
+ * higher priorities always before lower ones. Jobs submitted from a worker stay on
+ * that worker, jobs from other threads are spread round-robin.
+ * Submit() returns a Handle with a future for the result. Cancelling a job that
+ * hasn't started drops it, its future throws Cancelled. A running job only stops
+ * if it checks the CancelToken it can take as argument.
+ * Workers start on the first Submit(). Shutdown() cancels everything, later
+ * submissions are cancelled right away.
+ * Jobs must not call natives: those only work from a script thread.
+ */
+namespace TaskPool {
+    enum class Priority {
+        High,
+        Normal,
+        Low,
+    };
+    constexpr size_t PriorityCount = 3;
+
+    constexpr size_t MaxWorkers = 4;
+
+    class Cancelled : public std::runtime_error {
+    public:
+        Cancelled() : std::runtime_error("Task cancelled") {}
+    };
+
+    class CancelToken {
+    public:
+        CancelToken();
+
+        // Also true once the pool is shutting down.
+        bool IsCancelled() const;
+        void Cancel() const;
+
+        // Interruptible sleep. Returns true if cancelled before the time ran out.
+        bool WaitFor(std::chrono::milliseconds duration) const;
+
+    private:
+        std::shared_ptr<std::atomic<bool>> mCancelled;
+    };
+
+    template <typename T>
+    class Handle {
+    public:
+        Handle() = default;
+        Handle(std::future<T> future, CancelToken token)
+            : mFuture(std::move(future)), mToken(std::move(token)) {}
+
+        bool Valid() const { return mFuture.valid(); }
+        bool Ready() const {
+            return mFuture.valid() && mFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+        void Wait() const { mFuture.wait(); }
+        // Returns false if the job hasn't finished within duration.
+        bool WaitFor(std::chrono::milliseconds duration) const {
+            return mFuture.wait_for(duration) == std::future_status::ready;
+        }
+        // Rethrows the job's exception, or Cancelled.
+        T Get() { return mFuture.get(); }
+        void Cancel() const { mToken.Cancel(); }
+
+    private:
+        std::future<T> mFuture;
+        CancelToken mToken;
+    };
+
+    namespace detail {
+        class Job {
+        public:
+            explicit Job(CancelToken token) : mToken(std::move(token)) {}
+            virtual ~Job() = default;
+            // Runs the job, or fails its future when it was cancelled in the meantime.
+            // Returns false for the latter.
+            virtual bool Run() = 0;
+            virtual void Abandon() = 0;
+
+        protected:
+            CancelToken mToken;
+        };
+
+        template <typename TResult, typename TFunc>
+        class JobImpl : public Job {
+        public:
+            JobImpl(CancelToken token, TFunc func)
+                : Job(std::move(token)), mFunc(std::move(func)) {}
+
+            std::future<TResult> GetFuture() { return mPromise.get_future(); }
+
+            bool Run() override {
+                if (mToken.IsCancelled()) {
+                    Abandon();
+                    return false;
+                }
+                try {
+                    if constexpr (std::is_void_v<TResult>) {
+                        invoke();
+                        mPromise.set_value();
+                    }
+                    else {
+                        mPromise.set_value(invoke());
+                    }
+                }
+                catch (...) {
+                    mPromise.set_exception(std::current_exception());
+                }
+                return true;
+            }
+
+            void Abandon() override {
+                mPromise.set_exception(std::make_exception_ptr(Cancelled()));
+            }
+
+        private:
+            TResult invoke() {
+                if constexpr (std::is_invocable_v<TFunc&, const CancelToken&>)
+                    return mFunc(mToken);
+                else
+                    return mFunc();
+            }
+
+            TFunc mFunc;
+            std::promise<TResult> mPromise;
+        };
+
+        template <typename TFunc>
+        using ResultOf = typename std::conditional_t<std::is_invocable_v<TFunc&, const CancelToken&>,
+            std::invoke_result<TFunc&, const CancelToken&>,
+            std::invoke_result<TFunc&>>::type;
+
+        void Enqueue(std::unique_ptr<Job> job, Priority priority);
+    }
+
+    // func takes no arguments or a const CancelToken&.
+    template <typename TFunc>
+    auto Submit(Priority priority, TFunc&& func) {
+        using TDecayed = std::decay_t<TFunc>;
+        using TResult = detail::ResultOf<TDecayed>;
+
+        CancelToken token;
+        auto job = std::make_unique<detail::JobImpl<TResult, TDecayed>>(token, std::forward<TFunc>(func));
+        Handle<TResult> handle(job->GetFuture(), token);
+        detail::Enqueue(std::move(job), priority);
+        return handle;
+    }
+
+    template <typename TFunc>
+    auto Submit(TFunc&& func) {
+        return Submit(Priority::Normal, std::forward<TFunc>(func));
+    }
+
+    struct Stats {
+        uint64_t Submitted = 0;
+        uint64_t Executed = 0;
+        uint64_t Stolen = 0;
+        uint64_t Cancelled = 0;
+    };
+
+    size_t WorkerCount();
+    Stats GetStats();
+
+    // Cancels all jobs and stops the workers. Safe to call from DllMain.
+    void Shutdown();
+}
@@ -1,4 +1,6 @@
 #pragma once
+#include "ShiftSchedule.h"
+#include <simpleini/SimpleIni.h>
 #include <string>
 #include <vector>
 
@@ -34,10 +36,12 @@ public:
 
 class VehicleConfig {
 public:
-    VehicleConfig();
+    VehicleConfig() = default;
     void SetFiles(VehicleConfig* baseConfig, const std::string& file);
 
     void LoadSettings();
+    // Reads from an already parsed file, e.g. the general settings for the base config.
+    void LoadSettings(CSimpleIniA& ini);
     void SaveSettings();
     void SaveSettings(VehicleConfig* baseConfig, const std::string& customPath);
 
@@ -181,6 +185,8 @@ public:
 
             Tracked<float> MinDeltaBrakeMult = 2.4f; // 
             Tracked<float> MaxDeltaBrakeMult = 1.2f; // 
+
+            Tracked<int> RaysPerFrame = 3; // Shape tests started per frame, of 9
         } CruiseControl;
     } DriveAssists;
 
@@ -211,6 +217,9 @@ public:
         Tracked<float> DownshiftTimeoutMult = 1.0f;
         // Experimental new tcu
         Tracked<bool> UsingATCU = false;
+
+        // [SHIFT_SCHEDULE], hand-edited only. Replaces the load-based logic where it has a line.
+        ShiftSchedule Schedule;
     } AutoParams;
 
     // [STEERING]
@@ -236,5 +245,5 @@ private:
     std::string mFile;
 
     // Reference to one unique "master" instance.
-    VehicleConfig* mBaseConfig;
+    VehicleConfig* mBaseConfig = nullptr;
 };
@@ -0,0 +1,109 @@
+#pragma once
+#include "SettingsSchema.h"
+
+/*
+ * Every VehicleConfig option that maps one key to one member. Keys missing from a
+ * vehicle config fall back to the base config, so only overrides need to be saved.
+ * Kept out of VehicleConfig.cpp so the standalone tests can round-trip them.
+ */
+namespace VehicleConfigSchema {
+    inline constexpr auto Config = SettingsSchema::Make(
+        // [MT_OPTIONS]
+        SETTINGS_FIELD("MT_OPTIONS", "ShiftMode", MTOptions.ShiftMode),
+        SETTINGS_FIELD("MT_OPTIONS", "ClutchCatching", MTOptions.ClutchCreep),
+        SETTINGS_FIELD("MT_OPTIONS", "ClutchShiftingH", MTOptions.ClutchShiftH),
+        SETTINGS_FIELD("MT_OPTIONS", "ClutchShiftingS", MTOptions.ClutchShiftS),
+        SETTINGS_FIELD("MT_OPTIONS", "SpeedLimiter", MTOptions.SpeedLimiter.Enable),
+        SETTINGS_FIELD("MT_OPTIONS", "SpeedLimiterSpeed", MTOptions.SpeedLimiter.Speed),
+
+        // [MT_PARAMS]
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "ClutchCatchpoint", MTParams.ClutchThreshold, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "StallingRPM", MTParams.StallingRPM, 0.0f, 0.2f),
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "StallingRate", MTParams.StallingRate, 0.0f, 10.0f),
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "StallingSlip", MTParams.StallingSlip, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "RPMDamage", MTParams.RPMDamage, 0.0f, 10.0f),
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "MisshiftDamage", MTParams.MisshiftDamage, 0.0f, 100.0f),
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "EngBrakePower", MTParams.EngBrakePower, 0.0f, 5.0f),
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "EngBrakeThreshold", MTParams.EngBrakeThreshold, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "CreepIdleThrottle", MTParams.CreepIdleThrottle, 0.0f, 1.0f),
+        SETTINGS_FIELD_RANGE("MT_PARAMS", "CreepIdleRPM", MTParams.CreepIdleRPM, 0.0f, 0.5f),
+
+        // [DRIVING_ASSISTS]
+        SETTINGS_FIELD("DRIVING_ASSISTS", "ABS", DriveAssists.ABS.Enable),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "ABSFilter", DriveAssists.ABS.Filter),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "ABSFlash", DriveAssists.ABS.Flash),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "TCS", DriveAssists.TCS.Enable),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "TCSMode", DriveAssists.TCS.Mode),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "TCSSlipMin", DriveAssists.TCS.SlipMin, 1.0f, 20.0f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "TCSSlipMax", DriveAssists.TCS.SlipMax),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "TCSBrakeMult", DriveAssists.TCS.BrakeMult, 0.0f, 10.0f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "ESP", DriveAssists.ESP.Enable),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "ESPOverMin", DriveAssists.ESP.OverMin, 0.0f, 90.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "ESPOverMax", DriveAssists.ESP.OverMax, 0.0f, 90.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "ESPOverMinComp", DriveAssists.ESP.OverMinComp, 0.0f, 10.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "ESPOverMaxComp", DriveAssists.ESP.OverMaxComp, 0.0f, 10.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "ESPUnderMin", DriveAssists.ESP.UnderMin, 0.0f, 90.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "ESPUnderMax", DriveAssists.ESP.UnderMax, 0.0f, 90.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "ESPUnderMinComp", DriveAssists.ESP.UnderMinComp, 0.0f, 10.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "ESPUnderMaxComp", DriveAssists.ESP.UnderMaxComp, 0.0f, 10.0f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "LSD", DriveAssists.LSD.Enable),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "LSDViscosity", DriveAssists.LSD.Viscosity, 0.0f, 100.0f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "AWD", DriveAssists.AWD.Enable),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "AWDBiasAtMaxTransfer", DriveAssists.AWD.BiasAtMaxTransfer, 0.01f, 0.99f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "AWDUseCustomBaseBias", DriveAssists.AWD.UseCustomBaseBias),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "AWDCustomBaseBias", DriveAssists.AWD.CustomBaseBias, 0.01f, 0.99f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "AWDCustomMin", DriveAssists.AWD.CustomMin),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "AWDCustomMax", DriveAssists.AWD.CustomMax),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "AWDUseTraction", DriveAssists.AWD.UseTraction),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "AWDTractionLossMin", DriveAssists.AWD.TractionLossMin, 1.0f, 2.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "AWDTractionLossMax", DriveAssists.AWD.TractionLossMax, 1.0f, 2.0f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "AWDUseOversteer", DriveAssists.AWD.UseOversteer),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "AWDOversteerMin", DriveAssists.AWD.OversteerMin, 0.0f, 90.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "AWDOversteerMax", DriveAssists.AWD.OversteerMax, 0.0f, 90.0f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "AWDUseUndersteer", DriveAssists.AWD.UseUndersteer),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "AWDUndersteerMin", DriveAssists.AWD.UndersteerMin, 0.0f, 90.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "AWDUndersteerMax", DriveAssists.AWD.UndersteerMax, 0.0f, 90.0f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "LaunchControl", DriveAssists.LaunchControl.Enable),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "LaunchControlRPM", DriveAssists.LaunchControl.RPM, 0.3f, 0.9f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "LaunchControlSlipMin", DriveAssists.LaunchControl.SlipMin, 0.0f, 20.0f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "LaunchControlSlipMax", DriveAssists.LaunchControl.SlipMax),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "CruiseControl", DriveAssists.CruiseControl.Enable),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "CruiseControlSpeed", DriveAssists.CruiseControl.Speed),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "CruiseControlMaxAcceleration", DriveAssists.CruiseControl.MaxAcceleration, 0.5f, 40.0f),
+        SETTINGS_FIELD("DRIVING_ASSISTS", "CruiseControlAdaptive", DriveAssists.CruiseControl.Adaptive),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "CruiseControlMinFollowDistance", DriveAssists.CruiseControl.MinFollowDistance, 1.0f, 50.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "CruiseControlMaxFollowDistance", DriveAssists.CruiseControl.MaxFollowDistance, 50.0f, 200.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "CruiseControlMinDistanceSpeedMult", DriveAssists.CruiseControl.MinDistanceSpeedMult, 0.1f, 10.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "CruiseControlMaxDistanceSpeedMult", DriveAssists.CruiseControl.MaxDistanceSpeedMult, 0.1f, 10.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "CruiseControlMinDeltaBrakeMult", DriveAssists.CruiseControl.MinDeltaBrakeMult, 0.1f, 10.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "CruiseControlMaxDeltaBrakeMult", DriveAssists.CruiseControl.MaxDeltaBrakeMult, 0.1f, 10.0f),
+        SETTINGS_FIELD_RANGE("DRIVING_ASSISTS", "CruiseControlRaysPerFrame", DriveAssists.CruiseControl.RaysPerFrame, 1.0f, 9.0f),
+
+        // [STEERING]
+        SETTINGS_FIELD("STEERING", "CSUseCustomLock", Steering.CustomSteering.UseCustomLock),
+        SETTINGS_FIELD_RANGE("STEERING", "CSSoftLock", Steering.CustomSteering.SoftLock, 180.0f, 2880.0f),
+        SETTINGS_FIELD_RANGE("STEERING", "CSSteeringMult", Steering.CustomSteering.SteeringMult, 0.01f, 2.0f),
+        SETTINGS_FIELD_RANGE("STEERING", "CSSteeringReduction", Steering.CustomSteering.SteeringReduction, 0.0f, 2.0f),
+        SETTINGS_FIELD_RANGE("STEERING", "WSATMult", Steering.Wheel.SATMult, 0.05f, 10.0f),
+        SETTINGS_FIELD("STEERING", "WCurveMult", Steering.Wheel.CurveMult),
+        SETTINGS_FIELD_RANGE("STEERING", "WSoftLock", Steering.Wheel.SoftLock, 180.0f, 2880.0f),
+        SETTINGS_FIELD_RANGE("STEERING", "WSteeringMult", Steering.Wheel.SteeringMult, 0.1f, 2.0f),
+
+        // [SHIFT_OPTIONS]
+        SETTINGS_FIELD("SHIFT_OPTIONS", "UpshiftCut", ShiftOptions.UpshiftCut),
+        SETTINGS_FIELD("SHIFT_OPTIONS", "DownshiftBlip", ShiftOptions.DownshiftBlip),
+        SETTINGS_FIELD("SHIFT_OPTIONS", "DownshiftProtect", ShiftOptions.DownshiftProtect),
+        SETTINGS_FIELD_RANGE("SHIFT_OPTIONS", "ClutchRateMult", ShiftOptions.ClutchRateMult, 0.05f, 20.0f),
+        SETTINGS_FIELD_RANGE("SHIFT_OPTIONS", "RPMTolerance", ShiftOptions.RPMTolerance, 0.0f, 1.0f),
+
+        // [AUTO_PARAMS]
+        SETTINGS_FIELD_RANGE("AUTO_PARAMS", "UpshiftLoad", AutoParams.UpshiftLoad, 0.01f, 0.20f),
+        SETTINGS_FIELD_RANGE("AUTO_PARAMS", "DownshiftLoad", AutoParams.DownshiftLoad, 0.30f, 1.00f),
+        SETTINGS_FIELD_RANGE("AUTO_PARAMS", "NextGearMinRPM", AutoParams.NextGearMinRPM, 0.20f, 0.50f),
+        SETTINGS_FIELD_RANGE("AUTO_PARAMS", "CurrGearMinRPM", AutoParams.CurrGearMinRPM, 0.20f, 0.50f),
+        SETTINGS_FIELD_RANGE("AUTO_PARAMS", "EcoRate", AutoParams.EcoRate, 0.01f, 0.50f),
+        SETTINGS_FIELD_RANGE("AUTO_PARAMS", "UpshiftTimeoutMult", AutoParams.UpshiftTimeoutMult, 0.00f, 10.00f),
+        SETTINGS_FIELD_RANGE("AUTO_PARAMS", "DownshiftTimeoutMult", AutoParams.DownshiftTimeoutMult, 0.05f, 10.00f),
+        SETTINGS_FIELD("AUTO_PARAMS", "UsingATCU", AutoParams.UsingATCU)
+    );
+}
@@ -5,47 +5,36 @@
 #include "Memory/Offsets.hpp"
 #include "Memory/Versions.h"
 #include "Util/MathExt.h"
+#include "Util/NativeCache.h"
+#include "VehicleModelCache.h"
 
 #include "ScriptSettings.hpp"
 
 using VExt = VehicleExtensions;
 extern ScriptSettings g_settings;
 
-namespace {
-    bool GetIsRhd(Vehicle v) {
-        Vector3 driverSeatPos = 
-            ENTITY::GET_WORLD_POSITION_OF_ENTITY_BONE(v, ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(v, "seat_dside_f"));
-        Vector3 driverSeatPosRel = ENTITY::GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS(v, driverSeatPos);
-
-        //Vector3 dimMin, dimMax;
-        //MISC::GET_MODEL_DIMENSIONS(ENTITY::GET_ENTITY_MODEL(v), &dimMin, &dimMax);
-
-        if (driverSeatPosRel.x > 0.01f && 
-            sgn(driverSeatPosRel.x) == sgn(1.0f)) {
-            return true;
-        }
-        return false;
-    }
-}
-
 void VehicleData::SetVehicle(Vehicle v) {
     mVehicle = v;
+    mModelInfo.reset();
+    mWheelCoords.Invalidate();
+    mWorldToLocal.Invalidate();
     if (ENTITY::DOES_ENTITY_EXIST(mVehicle)) {
         mHandlingPtr = VExt::GetHandlingPtr(mVehicle);
 
-        mClass = findClass(ENTITY::GET_ENTITY_MODEL(mVehicle));
-        mDomain = findDomain(mClass);
-        auto type = VExt::GetModelType(mVehicle);
-        mIsAmphibious = (type == 6 || type == 7);
+        mModelInfo = ModelCache::Get(mVehicle);
+        mClass = mModelInfo->Class;
+        mDomain = mModelInfo->Domain;
+        mIsAmphibious = mModelInfo->IsAmphibious;
         mHasSpeedo = false;
-        mIsRhd = GetIsRhd(v);
+        mIsRhd = mModelInfo->IsRhd;
 
-        mModel = ENTITY::GET_ENTITY_MODEL(mVehicle);
-        MISC::GET_MODEL_DIMENSIONS(mVehicle, &mDimMin, &mDimMax);
+        mModel = mModelInfo->Model;
+        mDimMin = mModelInfo->DimMin;
+        mDimMax = mModelInfo->DimMax;
 
         // initialize prev's init state
-        mVelocity = ENTITY::GET_ENTITY_SPEED_VECTOR(mVehicle, true);
-        mRPM = VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(mVehicle) ?
+        mVelocity = NativeCache::GetEntitySpeedVector(mVehicle, true);
+        mRPM = NativeCache::GetIsVehicleEngineRunning(mVehicle) ?
             VExt::GetCurrentRPM(mVehicle) : 0.01f;
         mSuspensionTravel = VExt::GetWheelCompressions(mVehicle);
 
@@ -62,16 +51,16 @@ void VehicleData::SetVehicle(Vehicle v) {
         mABSType = getABSType(mModelFlags);
 
         mWheelsTcs.clear();
-        mWheelsTcs.resize(VExt::GetNumWheels(mVehicle));
+        mWheelsTcs.resize(NativeCache::GetNumWheels(mVehicle));
 
         mWheelsAbs.clear();
-        mWheelsAbs.resize(VExt::GetNumWheels(mVehicle));
+        mWheelsAbs.resize(NativeCache::GetNumWheels(mVehicle));
 
         mWheelsEspO.clear();
-        mWheelsEspO.resize(VExt::GetNumWheels(mVehicle));
+        mWheelsEspO.resize(NativeCache::GetNumWheels(mVehicle));
 
         mWheelsEspU.clear();
-        mWheelsEspU.resize(VExt::GetNumWheels(mVehicle));
+        mWheelsEspU.resize(NativeCache::GetNumWheels(mVehicle));
 
         mSuspensionTravelSpeedsHistory.clear();
         Update();
@@ -89,9 +78,9 @@ void VehicleData::Update() {
     mPrevSuspensionTravel = mSuspensionTravel;
 
     // Get current values
-    mVelocity = ENTITY::GET_ENTITY_SPEED_VECTOR(mVehicle, true);
+    mVelocity = NativeCache::GetEntitySpeedVector(mVehicle, true);
     mWorldVelocity = ENTITY::GET_ENTITY_VELOCITY(mVehicle);
-    mRPM = VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(mVehicle) ?
+    mRPM = NativeCache::GetIsVehicleEngineRunning(mVehicle) ?
         VExt::GetCurrentRPM(mVehicle) : 0.01f;
     mClutch = VExt::GetClutch(mVehicle);
     mThrottle = VExt::GetThrottle(mVehicle);
@@ -106,12 +95,16 @@ void VehicleData::Update() {
     mGearCurr = static_cast<uint8_t>(VExt::GetGearCurr(mVehicle));
     mGearNext = static_cast<uint8_t>(VExt::GetGearNext(mVehicle));
     mGearTop = VExt::GetTopGear(mVehicle);
-    mGearRatios = VExt::GetGearRatios(mVehicle);
 
     mDriveMaxFlatVel = VExt::GetDriveMaxFlatVel(mVehicle);
     mInitialDriveMaxFlatVel = VExt::GetInitialDriveMaxFlatVel(mVehicle);
 
-    mWheelCount = VExt::GetNumWheels(mVehicle);
+    // Only copies and derives when the gearbox actually changed.
+    if (mGearbox.Update(mGearTop, mDriveMaxFlatVel, VExt::GetGearRatioPtr(mVehicle, 0))) {
+        mGearRatios = mGearbox.Ratios;
+    }
+
+    mWheelCount = NativeCache::GetNumWheels(mVehicle);
     mWheelTyreSpeeds = VExt::GetTyreSpeeds(mVehicle);
 
     mWheelsOnGround = VExt::GetWheelsOnGround(mVehicle);
@@ -153,6 +146,14 @@ void VehicleData::Update() {
     mSuspensionTravelSpeeds = averageSpeeds;
 }
 
+const std::vector<Vector3>& VehicleData::GetWheelCoords() {
+    return mWheelCoords.Get();
+}
+
+const NativeMatrix4x4& VehicleData::GetWorldToLocal() {
+    return mWorldToLocal.Get();
+}
+
 std::vector<bool> VehicleData::getDrivenWheels() {
     std::vector<bool> wheelsToConsider;
     wheelsToConsider.reserve(mWheelCount);
@@ -208,7 +209,7 @@ float VehicleData::getAverageNonLockedWheelTyreSpeeds() {
 }
 
 float VehicleData::getEstimatedForwardSpeed() {
-    float accelNonLock = (mNonLockSpeed - mLastNonLockSpeed) / MISC::GET_FRAME_TIME();
+    float accelNonLock = (mNonLockSpeed - mLastNonLockSpeed) / NativeCache::GetFrameTime();
 
     // Wheels are decelerating faster than the acceleration sensor measured, so wheel speed is probably invalid.
     if (mAcceleration.y < 0.0f && 
@@ -266,7 +267,7 @@ std::vector<float> VehicleData::getSuspensionTravelSpeeds() {
     std::vector<float> suspensionTravelSpeeds(mWheelCount);
     for (size_t i = 0; i < mWheelCount; ++i) {
         suspensionTravelSpeeds[i] =
-            (mSuspensionTravel[i] - mPrevSuspensionTravel[i]) / MISC::GET_FRAME_TIME();
+            (mSuspensionTravel[i] - mPrevSuspensionTravel[i]) / NativeCache::GetFrameTime();
     }
     return suspensionTravelSpeeds;
 }
@@ -274,9 +275,9 @@ std::vector<float> VehicleData::getSuspensionTravelSpeeds() {
 Vector3 VehicleData::getAcceleration() {
     Vector3 acceleration{};
 
-    acceleration.x = (mVelocity.x - mPrevVelocity.x) / MISC::GET_FRAME_TIME();
-    acceleration.y = (mVelocity.y - mPrevVelocity.y) / MISC::GET_FRAME_TIME();
-    acceleration.z = (mVelocity.z - mPrevVelocity.z) / MISC::GET_FRAME_TIME();
+    acceleration.x = (mVelocity.x - mPrevVelocity.x) / NativeCache::GetFrameTime();
+    acceleration.y = (mVelocity.y - mPrevVelocity.y) / NativeCache::GetFrameTime();
+    acceleration.z = (mVelocity.z - mPrevVelocity.z) / NativeCache::GetFrameTime();
 
     return acceleration;
 }
@@ -284,8 +285,8 @@ Vector3 VehicleData::getAcceleration() {
 Vector3 VehicleData::getAccelerationWithCentripetal() {
     Vector3 worldVelDelta = (mWorldVelocity - mPrevWorldVelocity);
 
-    Vector3 fwdVec = ENTITY::GET_ENTITY_FORWARD_VECTOR(mVehicle);
-    Vector3 upVec = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(mVehicle, { 0.0f, 0.0f, 1.0f }) - ENTITY::GET_ENTITY_COORDS(mVehicle, true);
+    Vector3 fwdVec = NativeCache::GetEntityForwardVector(mVehicle);
+    Vector3 upVec = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(mVehicle, { 0.0f, 0.0f, 1.0f }) - NativeCache::GetEntityCoords(mVehicle);
     Vector3 rightVec = Cross(fwdVec, upVec);
 
     Vector3 relVelDelta{
@@ -294,30 +295,15 @@ Vector3 VehicleData::getAccelerationWithCentripetal() {
         Dot(worldVelDelta, upVec),
     };
 
-    return relVelDelta * (1.0f / MISC::GET_FRAME_TIME());
+    return relVelDelta * (1.0f / NativeCache::GetFrameTime());
 }
 
-VehicleClass VehicleData::findClass(Hash model) {
-    if (VEHICLE::IS_THIS_MODEL_A_CAR(model))        return VehicleClass::Car;
-    if (VEHICLE::IS_THIS_MODEL_A_BICYCLE(model))    return VehicleClass::Bicycle;
-    if (VEHICLE::IS_THIS_MODEL_A_BIKE(model))       return VehicleClass::Bike;
-    if (VEHICLE::IS_THIS_MODEL_A_BOAT(model))       return VehicleClass::Boat;
-    if (VEHICLE::IS_THIS_MODEL_A_PLANE(model))      return VehicleClass::Plane;
-    if (VEHICLE::IS_THIS_MODEL_A_HELI(model))       return VehicleClass::Heli;
-    if (VEHICLE::IS_THIS_MODEL_A_QUADBIKE(model))   return VehicleClass::Quad;
-    return VehicleClass::Unknown;
+std::vector<Vector3> VehicleData::getWheelCoords() {
+    return TransformPoints(NativeCache::GetEntityMatrix(mVehicle), VExt::GetWheelOffsets(mVehicle));
 }
 
-VehicleDomain VehicleData::findDomain(VehicleClass vehicleClass) {
-    switch (vehicleClass) {
-    case VehicleClass::Bicycle: return VehicleDomain::Bicycle;
-    case VehicleClass::Boat:    return VehicleDomain::Water;
-    case VehicleClass::Heli:
-    case VehicleClass::Plane:   return VehicleDomain::Air;
-    case VehicleClass::Train:   return VehicleDomain::Rail;
-    case VehicleClass::Unknown: return VehicleDomain::Unknown;
-    default: return VehicleDomain::Road;
-    }
+NativeMatrix4x4 VehicleData::getWorldToLocal() {
+    return InvertAffine(NativeCache::GetEntityMatrix(mVehicle));
 }
 
 ABSType VehicleData::getABSType(uint32_t handlingFlags) {
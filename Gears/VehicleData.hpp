@@ -4,8 +4,12 @@
 
 #include <vector>
 #include <chrono>
+#include <memory>
 #include "Memory/VehicleExtensions.hpp"
+#include "Memory/NativeMatrix.h"
+#include "Util/LazyValue.h"
 #include "AtcuGearbox.h"
+#include "GearboxDescriptor.h"
 
 enum class VehicleClass {
     Car,
@@ -105,6 +109,10 @@ struct WheelPatchStates {
 };
 
 
+namespace ModelCache {
+    struct ModelInfo;
+}
+
 // Contains all data of a vehicle, gets updated on tick.
 // Prefer to use this class over reading ext and calculating stuff
 // all the damn time.
@@ -115,6 +123,11 @@ public:
     void SetVehicle(Vehicle v);
     void Update();
 
+    // World position of each wheel, resolved on first use each tick.
+    const std::vector<Vector3>& GetWheelCoords();
+    // World to vehicle-local transform, use with TransformPoint(s)/TransformDirection(s).
+    const NativeMatrix4x4& GetWorldToLocal();
+
     // These should be read-only, but I cba to write getters for all of these.    
     // Vehicle this data is valid for
     Vehicle mVehicle{};
@@ -140,6 +153,8 @@ public:
     uint8_t mGearNext{};
     uint8_t mGearTop{};
     std::vector<float> mGearRatios;
+    // Speed bands and such, derived from the above on change.
+    GearboxDescriptor mGearbox;
 
     float mDriveMaxFlatVel{};
     float mInitialDriveMaxFlatVel{};
@@ -194,6 +209,8 @@ public:
     Hash mModel{};
     Vector3 mDimMax{};
     Vector3 mDimMin{};
+    // Shared with the model cache, set while the vehicle exists.
+    std::shared_ptr<const ModelCache::ModelInfo> mModelInfo;
 private:
     std::vector<bool> getDrivenWheels();
     float getAverageDrivenWheelTyreSpeeds();
@@ -203,9 +220,9 @@ private:
     std::vector<float> getSuspensionTravelSpeeds();
     Vector3 getAcceleration();
     Vector3 getAccelerationWithCentripetal();
+    std::vector<Vector3> getWheelCoords();
+    NativeMatrix4x4 getWorldToLocal();
 
-    VehicleClass findClass(Hash model);
-    VehicleDomain findDomain(VehicleClass vehicleClass);
     ABSType getABSType(uint32_t handlingFlags);
 
     std::vector<float> mPrevSuspensionTravel;
@@ -213,4 +230,7 @@ private:
 
     Vector3 mPrevVelocity{};
     Vector3 mPrevWorldVelocity{};
+
+    LazyValue<std::vector<Vector3>> mWheelCoords{ "WheelCoords", [this] { return getWheelCoords(); } };
+    LazyValue<NativeMatrix4x4> mWorldToLocal{ "WorldToLocal", [this] { return getWorldToLocal(); } };
 };
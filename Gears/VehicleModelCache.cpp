@@ -0,0 +1,141 @@
+#include "VehicleModelCache.h"
+
+#include "Memory/VehicleBone.h"
+#include "Memory/VehicleExtensions.hpp"
+#include "Util/LruCache.h"
+#include "Util/MathExt.h"
+
+#include <inc/natives.h>
+#include <unordered_map>
+
+using VExt = VehicleExtensions;
+
+namespace {
+    LruCache<Hash, std::shared_ptr<const ModelCache::ModelInfo>> cache(ModelCache::Capacity);
+
+    // Bone matrices of the first vehicle of each model, before the script rotated
+    // anything. Kept out of the LRU and never evicted or cleared: a model that's
+    // refilled later may come from a vehicle whose bones are already rotated.
+    struct BoneOriginals {
+        NativeMatrix4x4 SteeringWheel{};
+        NativeMatrix4x4 NeedleSpeedo{};
+        NativeMatrix4x4 NeedleTorque{};
+    };
+    std::unordered_map<Hash, BoneOriginals> boneOriginals;
+
+    // https://forums.gta5-mods.com/topic/14244/how-to-get-a-wheel-address-from-wheel-id
+    // Trailer mid wheels (45 and 46) share ids 11 and 13 with the front and rear
+    // wheels in memory, so those resolve to the front and rear tyres.
+    uint8_t tyreIndexFromWheelId(uint8_t wheelIdMem) {
+        switch (wheelIdMem) {
+            case 11: return 0; // wheel_lf / bike, plane or jet front
+            case 12: return 1; // wheel_rf
+            case 15: return 2; // wheel_lm / in 6 wheels trailer, plane or jet is first one on left
+            case 16: return 3; // wheel_rm / in 6 wheels trailer, plane or jet is first one on right
+            case 13: return 4; // wheel_lr / bike rear / in 6 wheels trailer, plane or jet is last one on left
+            case 14: return 5; // wheel_rr / in 6 wheels trailer, plane or jet is last one on right
+            default: return ModelCache::NoTyre;
+        }
+    }
+
+    VehicleClass findClass(Hash model) {
+        if (VEHICLE::IS_THIS_MODEL_A_CAR(model))        return VehicleClass::Car;
+        if (VEHICLE::IS_THIS_MODEL_A_BICYCLE(model))    return VehicleClass::Bicycle;
+        if (VEHICLE::IS_THIS_MODEL_A_BIKE(model))       return VehicleClass::Bike;
+        if (VEHICLE::IS_THIS_MODEL_A_BOAT(model))       return VehicleClass::Boat;
+        if (VEHICLE::IS_THIS_MODEL_A_PLANE(model))      return VehicleClass::Plane;
+        if (VEHICLE::IS_THIS_MODEL_A_HELI(model))       return VehicleClass::Heli;
+        if (VEHICLE::IS_THIS_MODEL_A_QUADBIKE(model))   return VehicleClass::Quad;
+        return VehicleClass::Unknown;
+    }
+
+    VehicleDomain findDomain(VehicleClass vehicleClass) {
+        switch (vehicleClass) {
+        case VehicleClass::Bicycle: return VehicleDomain::Bicycle;
+        case VehicleClass::Boat:    return VehicleDomain::Water;
+        case VehicleClass::Heli:
+        case VehicleClass::Plane:   return VehicleDomain::Air;
+        case VehicleClass::Train:   return VehicleDomain::Rail;
+        case VehicleClass::Unknown: return VehicleDomain::Unknown;
+        default: return VehicleDomain::Road;
+        }
+    }
+
+    bool hasBone(Vehicle vehicle, const char* name) {
+        return ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(vehicle, name) != -1;
+    }
+
+    bool getIsRhd(Vehicle vehicle) {
+        Vector3 driverSeatPos =
+            ENTITY::GET_WORLD_POSITION_OF_ENTITY_BONE(vehicle, ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(vehicle, "seat_dside_f"));
+        Vector3 driverSeatPosRel = ENTITY::GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS(vehicle, driverSeatPos);
+
+        return driverSeatPosRel.x > 0.01f &&
+            sgn(driverSeatPosRel.x) == sgn(1.0f);
+    }
+
+    // original is filled in from the vehicle the first time the model is seen.
+    ModelCache::BoneInfo getBone(Vehicle vehicle, const char* name, NativeMatrix4x4& original, bool captured) {
+        ModelCache::BoneInfo bone;
+        bone.Index = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(vehicle, name);
+        if (bone.Valid() && !captured)
+            original = VehicleBones::GetObjectMatrix(vehicle, bone.Index);
+        bone.Original = original;
+        return bone;
+    }
+
+    std::shared_ptr<const ModelCache::ModelInfo> create(Vehicle vehicle, Hash model) {
+        auto info = std::make_shared<ModelCache::ModelInfo>();
+        info->Model = model;
+        info->Class = findClass(model);
+        info->Domain = findDomain(info->Class);
+
+        auto type = VExt::GetModelType(vehicle);
+        info->IsAmphibious = type == 6 || type == 7;
+        info->IsRhd = getIsRhd(vehicle);
+        MISC::GET_MODEL_DIMENSIONS(model, &info->DimMin, &info->DimMax);
+
+        auto [originals, firstSeen] = boneOriginals.try_emplace(model);
+        bool captured = !firstSeen;
+        info->SteeringWheel = getBone(vehicle, "steeringwheel", originals->second.SteeringWheel, captured);
+        info->NeedleSpeedo = getBone(vehicle, "needle_speedo", originals->second.NeedleSpeedo, captured);
+        info->NeedleTorque = getBone(vehicle, "needle_torque", originals->second.NeedleTorque, captured);
+
+        info->HasEquipment =
+            hasBone(vehicle, "forks") ||
+            hasBone(vehicle, "tow_arm") ||
+            hasBone(vehicle, "scoop") ||
+            (hasBone(vehicle, "frame_1") && hasBone(vehicle, "frame_2"));
+
+        auto numWheels = VExt::GetNumWheels(vehicle);
+        info->TyreIndices.resize(numWheels);
+        for (uint8_t i = 0; i < numWheels; ++i) {
+            info->TyreIndices[i] = tyreIndexFromWheelId(VExt::GetWheelIdMem(vehicle, i));
+        }
+
+        return info;
+    }
+}
+
+std::shared_ptr<const ModelCache::ModelInfo> ModelCache::Get(Vehicle vehicle) {
+    if (!ENTITY::DOES_ENTITY_EXIST(vehicle))
+        return nullptr;
+
+    Hash model = ENTITY::GET_ENTITY_MODEL(vehicle);
+    return cache.GetOrAdd(model, [vehicle, model] {
+        return create(vehicle, model);
+    });
+}
+
+void ModelCache::Clear() {
+    cache.Clear();
+}
+
+ModelCache::Stats ModelCache::GetStats() {
+    Stats stats;
+    stats.Hits = cache.Hits();
+    stats.Misses = cache.Misses();
+    stats.Evictions = cache.Evictions();
+    stats.Size = cache.Size();
+    return stats;
+}
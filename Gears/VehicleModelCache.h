@@ -0,0 +1,65 @@
+#pragma once
+#include "VehicleData.hpp"
+#include "Memory/NativeMatrix.h"
+
+#include <inc/types.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/*
+ * Per-model vehicle metadata that doesn't change between instances of a model:
+ * class, seat side, dimensions, bone indices and the wheel to tyre index mapping.
+ * Gathered from the first vehicle of a model that gets queried, then kept in a
+ * bounded least recently used cache. Bone originals are captured only once per
+ * model and survive eviction. Only use from the main script thread.
+ */
+namespace ModelCache {
+    constexpr size_t Capacity = 64;
+
+    // Tyre index for a wheel that doesn't map to any tyre.
+    constexpr uint8_t NoTyre = 0xFF;
+
+    struct BoneInfo {
+        int Index = -1;
+        // Object matrix before any rotation, for VehicleBones::RotateAxisAbsolute.
+        // From the first vehicle of the model seen, even after the entry was evicted.
+        NativeMatrix4x4 Original{};
+
+        bool Valid() const { return Index != -1; }
+    };
+
+    struct ModelInfo {
+        Hash Model = 0;
+        VehicleClass Class = VehicleClass::Unknown;
+        VehicleDomain Domain = VehicleDomain::Unknown;
+        bool IsAmphibious = false;
+        bool IsRhd = false;
+        Vector3 DimMin{};
+        Vector3 DimMax{};
+
+        BoneInfo SteeringWheel;
+        BoneInfo NeedleSpeedo;
+        BoneInfo NeedleTorque;
+
+        // Forks, tow arm, scoop or a frame, which use the up/down controls.
+        bool HasEquipment = false;
+
+        // IS_VEHICLE_TYRE_BURST index per wheel, or NoTyre.
+        std::vector<uint8_t> TyreIndices;
+    };
+
+    struct Stats {
+        uint64_t Hits = 0;
+        uint64_t Misses = 0;
+        uint64_t Evictions = 0;
+        size_t Size = 0;
+    };
+
+    // Metadata of the vehicle's model. nullptr if the vehicle doesn't exist.
+    // Entries are shared, so holders keep them alive past eviction.
+    std::shared_ptr<const ModelInfo> Get(Vehicle vehicle);
+
+    void Clear();
+    Stats GetStats();
+}
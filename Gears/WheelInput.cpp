@@ -5,12 +5,19 @@
 #include "SteeringAnim.h"
 #include "ScriptSettings.hpp"
 #include "VehicleData.hpp"
+#include "VehicleModelCache.h"
+#include "WheelStatus.h"
 #include "Input/CarControls.hpp"
 
 #include "Util/ScriptUtils.h"
 #include "Util/MathExt.h"
 #include "Util/MiscEnums.h"
 #include "Util/UIUtils.h"
+#include "Util/Profiler.h"
+#include "Util/NativeCache.h"
+#include "Util/LazyValue.h"
+#include "Util/Materials.h"
+#include "Util/SurfaceTexture.h"
 
 #include "Memory/VehicleExtensions.hpp"
 #include "Memory/Offsets.hpp"
@@ -40,19 +47,11 @@ extern WheelPatchStates g_wheelPatchStates;
 namespace {
     MiniPID pid(1.0, 0.0, 0.0);
 
-    // https://forums.gta5-mods.com/topic/14244/how-to-get-a-wheel-address-from-wheel-id
-    std::unordered_map<uint8_t, uint8_t> wheelIdReverseLookupMap {
-        { 11, 0 }, // 0 - wheel_lf / bike, plane or jet front
-        { 12, 1 }, // 1 - wheel_rf
-        { 15, 2 }, // 2 - wheel_lm / in 6 wheels trailer, plane or jet is first one on left
-        { 16, 3 }, // 3 - wheel_rm / in 6 wheels trailer, plane or jet is first one on right
-        { 13, 4 }, // 4 - wheel_lr / bike rear / in 6 wheels trailer, plane or jet is last one on left
-        { 14, 5 }, // 5 - wheel_rr / in 6 wheels trailer, plane or jet is last one on right
-        { 11, 6 }, // 45 - 6 wheels trailer mid wheel left
-        { 13, 7 }, // 45 - 6 wheels trailer mid wheel right
-    };
-
     float lastLongSlip = 0.0f;
+
+    SurfaceTexture::Generator surfaceTexture;
+    // Oscillators are per wheel, so a different wheel count starts over.
+    size_t textureWheels = 0;
 }
 
 namespace WheelInput {
@@ -550,13 +549,13 @@ void WheelInput::DoSteering() {
     if (g_vehData.mClass == VehicleClass::Car) {
         VExt::SetSteeringInputAngle(g_playerVehicle, -std::clamp(effSteer, -1.0f, 1.0f));
 
-        if (!VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+        if (!NativeCache::GetIsVehicleEngineRunning(g_playerVehicle)) {
             float angleOff = -std::clamp(effSteer, -1.0f, 1.0f) * VExt::GetMaxSteeringAngle(g_playerVehicle);
             VExt::SetSteeringAngle(g_playerVehicle, angleOff);
         }
 
-        auto boneIdx = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "steeringwheel");
-        if (boneIdx != -1) {
+        if (g_vehData.mModelInfo && g_vehData.mModelInfo->SteeringWheel.Valid()) {
+            const auto& steeringWheel = g_vehData.mModelInfo->SteeringWheel;
             Vector3 rotAxis{};
             rotAxis.y = 1.0f;
             float rotRad = deg2rad(g_settings.Wheel.Steering.AngleMax) / 2.0f * steerValGamma;
@@ -573,8 +572,8 @@ void WheelInput::DoSteering() {
                 scale.z = 0.0f;
             }
 
-            VehicleBones::RotateAxisAbsolute(g_playerVehicle, boneIdx, rotAxis, rotRad);
-            VehicleBones::Scale(g_playerVehicle, boneIdx, scale);
+            VehicleBones::RotateAxisAbsolute(g_playerVehicle, steeringWheel.Index, steeringWheel.Original, rotAxis, rotRad);
+            VehicleBones::Scale(g_playerVehicle, steeringWheel.Index, scale);
             SteeringAnimation::SetRotation(rotRad);
         }
     }
@@ -589,7 +588,7 @@ int calculateDamper(float gain, float wheelsOffGroundRatio) {
     float damperMin = static_cast<float>(g_settings.Wheel.FFB.DamperMin);
     float damperMinSpeed = static_cast<float>(g_settings.Wheel.FFB.DamperMinSpeed);
 
-    float absVehicleSpeed = abs(ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y);
+    float absVehicleSpeed = abs(NativeCache::GetEntitySpeedVector(g_playerVehicle, true).y);
     float damperFactorSpeed = map(absVehicleSpeed, 0.0f, damperMinSpeed, damperMax, damperMin);
     damperFactorSpeed = fmaxf(damperFactorSpeed, damperMin);
     // already clamped on the upper bound by abs(vel) in map()
@@ -598,33 +597,24 @@ int calculateDamper(float gain, float wheelsOffGroundRatio) {
 
     damperForce = damperForce * (1.0f - wheelsOffGroundRatio);
 
-    auto tyreGrips = VExt::GetTyreGrips(g_playerVehicle);
-    auto wetGrips = VExt::GetWetGrips(g_playerVehicle);
-
-    for (uint32_t i = 0; i < VExt::GetNumWheels(g_playerVehicle); ++i) {
+    for (uint8_t i = 0; i < WheelStatus::NumWheels(); ++i) {
         if (VExt::IsWheelSteered(g_playerVehicle, i)) {
-            auto wheelIdMem = VExt::GetWheelIdMem(g_playerVehicle, i);
-            auto wheelId = wheelIdReverseLookupMap.find(wheelIdMem);
-            if (wheelId != wheelIdReverseLookupMap.end()) {
-                bool deflated = VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, wheelId->second, false);
-                bool completely = VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, wheelId->second, true);
-
-                if (deflated) {
-                    damperForce *= 0.75f;
-                }
-                else if (completely) {
-                    damperForce *= 0.50f;
-                }
+            const auto& wheel = WheelStatus::Get(i);
+            if (wheel.Deflated) {
+                damperForce *= 0.75f;
+            }
+            else if (wheel.BurstCompletely) {
+                damperForce *= 0.50f;
             }
 
-            damperForce *= tyreGrips[i];
-            damperForce *= wetGrips[i];
+            damperForce *= wheel.TyreGrip;
+            damperForce *= wheel.WetGrip;
         }
     }
 
     damperForce = std::clamp(damperForce, damperMin, damperMax * 2.0f);
 
-    if (!VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+    if (!NativeCache::GetIsVehicleEngineRunning(g_playerVehicle)) {
         damperForce *= 2.0f;
     }
 
@@ -646,6 +636,32 @@ int calculateDetail() {
     return static_cast<int>(1000.0f * g_settings.Wheel.FFB.DetailMult * compSpeedTotal);
 }
 
+int calculateTexture() {
+    std::array<SurfaceTexture::WheelSample, SurfaceTexture::MaxWheels> samples{};
+    size_t numWheels = std::min<size_t>(WheelStatus::NumWheels(), samples.size());
+    numWheels = std::min({ numWheels, g_vehData.mWheelTyreSpeeds.size(), g_vehData.mWheelsOnGround.size() });
+    if (numWheels != textureWheels) {
+        surfaceTexture.Reset();
+        textureWheels = numWheels;
+    }
+
+    for (uint8_t i = 0; i < numWheels; ++i) {
+        auto& sample = samples[i];
+        sample.Material = WheelStatus::Get(i).Material;
+        sample.Speed = g_vehData.mWheelTyreSpeeds[i];
+        sample.OnGround = g_vehData.mWheelsOnGround[i];
+        // Same side convention as the detail effect: even indices are on the left.
+        // Bikes get the bumps of both wheels in one direction.
+        sample.Side = numWheels > 2 && i % 2 == 0 ? -1.0f : 1.0f;
+        sample.Weight = VExt::IsWheelSteered(g_playerVehicle, i) ? 1.0f : 0.5f;
+    }
+
+    float texture = surfaceTexture.Step(samples.data(), numWheels, NativeCache::GetFrameTime());
+    int textureLim = g_settings.Wheel.FFB.TextureLim;
+    return std::clamp(static_cast<int>(texture * g_settings.Wheel.FFB.TextureMult * static_cast<float>(textureLim)),
+        -textureLim, textureLim);
+}
+
 void calculateSoftLock(int& totalForce, int& damperForce) {
     float steerMult;
 
@@ -687,33 +703,31 @@ std::vector<WheelInput::SSlipInfo> WheelInput::CalculateSlipInfo() {
     auto tracVels = VExt::GetWheelTractionVector(g_playerVehicle);
 
     auto velWorld = ENTITY::GET_ENTITY_VELOCITY(g_playerVehicle);
-    auto posWorld = ENTITY::GET_ENTITY_COORDS(g_playerVehicle, 0);
+
+    // Velocities are directions, so only the rotation of the inverse applies.
+    const auto& worldToLocal = g_vehData.GetWorldToLocal();
+    auto boneVelsRel = TransformDirections(worldToLocal, boneVels);
+    auto tracVelsRel = TransformDirections(worldToLocal, tracVels);
 
     std::vector<SSlipInfo> slipAngles;
 
-    auto numWheels = VExt::GetNumWheels(g_playerVehicle);
+    auto numWheels = NativeCache::GetNumWheels(g_playerVehicle);
 
-    auto wheelCoords = Util::GetWheelCoords(g_playerVehicle);
+    const auto& wheelCoords = g_vehData.GetWheelCoords();
     auto wheelOffs = VExt::GetWheelOffsets(g_playerVehicle);
 
     // Only used for when locked up
     auto wheelAngles = VExt::GetWheelSteeringAngles(g_playerVehicle);
-    auto worldVelAbs = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, false);
-    auto vehForwardVec = ENTITY::GET_ENTITY_FORWARD_VECTOR(g_playerVehicle);
+    auto worldVelAbs = NativeCache::GetEntitySpeedVector(g_playerVehicle, false);
+    auto vehForwardVec = NativeCache::GetEntityForwardVector(g_playerVehicle);
     float slideAngle = GetAngleBetween(vehForwardVec, worldVelAbs);
 
     for (uint32_t i = 0; i < numWheels; ++i) {
         Vector3 boneVel = boneVels[i];
         Vector3 tracVel = tracVels[i] * -1.0f;
 
-        // Translate absolute bone velocity to relative velocity
-        auto boneVelProjection = posWorld + boneVel;
-        auto boneVelRel = ENTITY::GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS(
-            g_playerVehicle, boneVelProjection);
-
-        auto tracVelProjection = posWorld + tracVel;
-        auto tracVelRel = ENTITY::GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS(
-            g_playerVehicle, tracVelProjection);
+        Vector3 boneVelRel = boneVelsRel[i];
+        Vector3 tracVelRel = tracVelsRel[i] * -1.0f;
 
         auto tracVelRelIgnoreZ = tracVelRel;
         tracVelRelIgnoreZ.z = boneVelRel.z;
@@ -756,14 +770,14 @@ std::vector<WheelInput::SSlipInfo> WheelInput::CalculateSlipInfo() {
                 alpha = 63;
             }
 
-            Vector3 boneVelProjection2 = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle,
-                { wheelOffs[i].x + boneVelRel.x, wheelOffs[i].y + boneVelRel.y, wheelOffs[i].z + boneVelRel.z });
+            Vector3 boneVelProjection2 = TransformPoint(NativeCache::GetEntityMatrix(g_playerVehicle),
+                wheelOffs[i] + boneVelRel);
             UI::DrawSphere(boneVelProjection2, 0.05f, Util::ColorI{ 255, 255, 255, alpha });
             GRAPHICS::DRAW_LINE(wheelCoords[i],
                 boneVelProjection2, 255, 255, 255, alpha);
 
-            Vector3 tracVelProjection2 = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle,
-                { wheelOffs[i].x + tracVelRelIgnoreZ.x, wheelOffs[i].y + tracVelRelIgnoreZ.y, wheelOffs[i].z + tracVelRelIgnoreZ.z });
+            Vector3 tracVelProjection2 = TransformPoint(NativeCache::GetEntityMatrix(g_playerVehicle),
+                wheelOffs[i] + tracVelRelIgnoreZ);
             UI::DrawSphere(tracVelProjection2, 0.05f, Util::ColorI{ 255, 0, 0, alpha });
             GRAPHICS::DRAW_LINE(wheelCoords[i],
                 tracVelProjection2, 255, 0, 0, alpha);
@@ -773,6 +787,11 @@ std::vector<WheelInput::SSlipInfo> WheelInput::CalculateSlipInfo() {
     return slipAngles;
 }
 
+const std::vector<WheelInput::SSlipInfo>& WheelInput::GetSlipInfo() {
+    static LazyValue<std::vector<SSlipInfo>> slipInfo("SlipInfo", CalculateSlipInfo);
+    return slipInfo.Get();
+}
+
 // The downside of this method based on slip angle, is that high-slip-ratio
 // handlings are very weak and need a low FFB.Gamma to ramp up the "early" force with
 // "low" steering angles.
@@ -811,7 +830,7 @@ float calcSlipRatio(float slip, float slipOpt,
 }
 
 int calculateSat() {
-    auto numWheels = VExt::GetNumWheels(g_playerVehicle);
+    auto numWheels = NativeCache::GetNumWheels(g_playerVehicle);
     if (numWheels < 1)
         return 0;
 
@@ -828,7 +847,7 @@ int calculateSat() {
     auto wheelVels = VExt::GetTyreSpeeds(g_playerVehicle);
     auto wheelSteeringMults = VExt::GetWheelSteeringMultipliers(g_playerVehicle);
 
-    auto satValues = WheelInput::CalculateSlipInfo();
+    const auto& satValues = WheelInput::GetSlipInfo();
     const float weightWheelAvg = mass / (float)satValues.size();
 
     uint32_t numSteeredWheelsTotal = 0;
@@ -844,28 +863,21 @@ int calculateSat() {
     float steeredAxleWeight = 0.0f;
     float maxSteeredWheelWeight = 0.0f;
 
-    auto tyreGrips = VExt::GetTyreGrips(g_playerVehicle);
-    auto wetGrips = VExt::GetWetGrips(g_playerVehicle);
-
-    auto calculateSlip = [&](uint32_t i) {
+    auto calculateSlip = [&](uint8_t i) {
         float thisSlipRatio = calcSlipRatio(satValues[i].Angle, latSlipOpt, postOptSlipRatio, postOptSlipMin);
 
-        auto wheelIdMem = VExt::GetWheelIdMem(g_playerVehicle, i);
-        auto wheelId = wheelIdReverseLookupMap.find(wheelIdMem);
-        if (wheelId != wheelIdReverseLookupMap.end()) {
-            bool deflated = VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, wheelId->second, false);
-            bool completely = VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, wheelId->second, true);
-
-            if (deflated) {
-                thisSlipRatio *= 0.25f;
-            }
-            else if (completely) {
-                thisSlipRatio *= 0.10f;
-            }
+        const auto& wheel = WheelStatus::Get(i);
+        if (wheel.Deflated) {
+            thisSlipRatio *= 0.25f;
+        }
+        else if (wheel.BurstCompletely) {
+            thisSlipRatio *= 0.10f;
         }
 
-        thisSlipRatio *= tyreGrips[i];
-        thisSlipRatio *= wetGrips[i];
+        thisSlipRatio *= wheel.TyreGrip;
+        thisSlipRatio *= wheel.WetGrip;
+        if (g_settings.Wheel.FFB.SurfaceGripFeel)
+            thisSlipRatio *= Materials::GetProperties(wheel.Material).GripFeel;
 
         slipRatio += thisSlipRatio;
 
@@ -890,8 +902,8 @@ int calculateSat() {
                     i, rad2deg(satValues[i].Angle),
                     thisSlipRatio,
                     thisLongSlip,
-                    wheelIdMem, wheelId != wheelIdReverseLookupMap.end() ?
-                                    fmt::format("{}", wheelId->second) : "N/A"));
+                    VExt::GetWheelIdMem(g_playerVehicle, i), wheel.Tyre != WheelStatus::NoTyre ?
+                                    fmt::format("{}", wheel.Tyre) : "N/A"));
         }
     };
 
@@ -919,7 +931,7 @@ int calculateSat() {
         // Drop rate 1.0 responds quickly but smoothens GTA's ABS jerks
         // 10.0 is too fast
         // 0.1 is too slow, feel nearly nothing and takes too long to respond to lockups.
-        longSlip = lerp(lastLongSlip, longSlip, 1.0f * MISC::GET_FRAME_TIME());
+        longSlip = lerp(lastLongSlip, longSlip, 1.0f * NativeCache::GetFrameTime());
     }
 
     lastLongSlip = longSlip;
@@ -989,7 +1001,7 @@ int calculateSatNonWheel(int defaultGain, float steeringAngle) {
     if (speed == 0.0f)
         spdRatio = 1.0f;
 
-    Vector3 speedVector = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
+    Vector3 speedVector = NativeCache::GetEntitySpeedVector(g_playerVehicle, true);
     Vector3 speedVectorMapped = speedVector;
     speedVectorMapped.x = speedVector.x * (spdRatio);
     Vector3 rotVector = ENTITY::GET_ENTITY_ROTATION_VELOCITY(g_playerVehicle);
@@ -1055,6 +1067,7 @@ float getFloatingSteeredWheelsRatio(Vehicle v) {
 }
 
 void WheelInput::PlayFFBGround() {
+    PROFILE_SCOPE("PlayFFBGround");
     if (!g_settings.Wheel.FFB.Enable ||
         g_controls.PrevInput != CarControls::Wheel) {
         return;
@@ -1069,6 +1082,7 @@ void WheelInput::PlayFFBGround() {
     int detailForce = std::clamp(calculateDetail(), -g_settings.Wheel.FFB.DetailLim, g_settings.Wheel.FFB.DetailLim);
     int satForce = calculateSat();
     int damperForce = calculateDamper(50.0f, wheelsOffGroundRatio);
+    int textureForce = calculateTexture();
 
     // Decrease damper if sat rises, so constantForce doesn't fight against damper
     //float damperMult = 1.0f - std::min(fabs((float)satForce), 10000.0f) / 10000.0f;
@@ -1077,11 +1091,12 @@ void WheelInput::PlayFFBGround() {
     // Dampen suspension, minimize damper, minimize SAT
     if (hasAltInputs(g_playerVehicle)) {
         detailForce /= 10;
+        textureForce /= 10;
         satForce /= 5;
         damperForce = g_settings.Wheel.FFB.DamperMin;
     }
 
-    int totalForce = satForce + detailForce;
+    int totalForce = satForce + detailForce + textureForce;
     calculateSoftLock(totalForce, damperForce);
 
     lastConstantForce = static_cast<float>(totalForce);
@@ -1109,6 +1124,7 @@ void WheelInput::PlayFFBGround() {
         UI::ShowText(0.85, 0.300, 0.4, fmt::format("{}FFBFin:\t\t{}~w~", abs(totalForce) > 10000 ? "~r~" : "~w~", totalForce), 4);
         UI::ShowText(0.85, 0.325, 0.4, fmt::format("Damper:\t\t{}", damperForce), 4);
         UI::ShowText(0.85, 0.350, 0.4, fmt::format("Detail:\t\t{}", detailForce), 4);
+        UI::ShowText(0.85, 0.375, 0.4, fmt::format("Texture:\t\t{}", textureForce), 4);
     }
 }
 
@@ -1153,6 +1169,11 @@ void WheelInput::PlayFFBWater() {
     }
 }
 
+void WheelInput::ResetVehicle() {
+    surfaceTexture.Reset();
+    textureWheels = 0;
+}
+
 float WheelInput::GetProfiledFFBValue(float x, float gamma, int profileMode) {
     if (profileMode == 0) {
         // Increase the force quick, then rise towards 1.
@@ -23,6 +23,8 @@ void CheckButtons();
 void PlayFFBGround();
 void PlayFFBWater();
 void DoSteering();
+// Drops force feedback state that belongs to the previous vehicle.
+void ResetVehicle();
 
 ///////////////////////////////////////////////////////////////////////////////
 //                        Script-specific utils ????
@@ -37,4 +39,6 @@ struct SSlipInfo {
     float VelocityAmplitude; // Relative, m/s
 };
 std::vector<SSlipInfo> CalculateSlipInfo();
+// CalculateSlipInfo, once per tick.
+const std::vector<SSlipInfo>& GetSlipInfo();
 }
@@ -0,0 +1,125 @@
+#include "WheelStatus.h"
+
+#include "ScriptSettings.hpp"
+#include "VehicleData.hpp"
+#include "VehicleModelCache.h"
+
+#include "Memory/VehicleExtensions.hpp"
+#include "Util/NativeCache.h"
+#include "Util/Scheduler.h"
+
+#include <inc/natives.h>
+#include <vector>
+
+using VExt = VehicleExtensions;
+
+extern ScriptSettings g_settings;
+extern VehicleData g_vehData;
+
+namespace {
+    // IS_VEHICLE_TYRE_BURST, deflated and completely burst
+    constexpr uint32_t burstNativesPerTyre = 2;
+
+    const WheelStatus::Wheel noWheel{};
+
+    Vehicle currentVehicle = 0;
+    // Only resized on a vehicle change
+    std::vector<WheelStatus::Wheel> wheels;
+
+    WheelStatus::Stats tickStats{};
+    WheelStatus::Stats lastTickStats{};
+
+    Scheduler::Task statusTask("Wheel status", 5.0f);
+
+    uint8_t tyreIndex(uint8_t wheel) {
+        const auto& info = g_vehData.mModelInfo;
+        if (!info || wheel >= info->TyreIndices.size())
+            return WheelStatus::NoTyre;
+        return info->TyreIndices[wheel];
+    }
+
+    // Health, tyre health and contact material are plain memory reads, cheap enough
+    // to watch every tick. Tyre health drops on a burst, so bursts don't wait for the rate.
+    bool changed(Vehicle vehicle) {
+        for (uint8_t i = 0; i < static_cast<uint8_t>(wheels.size()); ++i) {
+            if (VExt::GetWheelHealth(vehicle, i) != wheels[i].Health ||
+                VExt::GetTyreHealth(vehicle, i) != wheels[i].TyreHealth ||
+                VExt::GetTireContactMaterial(vehicle, i) != wheels[i].Material)
+                return true;
+        }
+        return false;
+    }
+
+    void refresh(Vehicle vehicle) {
+        auto tyreGrips = VExt::GetTyreGrips(vehicle);
+        auto wetGrips = VExt::GetWetGrips(vehicle);
+
+        for (uint8_t i = 0; i < static_cast<uint8_t>(wheels.size()); ++i) {
+            auto& wheel = wheels[i];
+            wheel.Tyre = tyreIndex(i);
+            if (wheel.Tyre != WheelStatus::NoTyre) {
+                wheel.Deflated = VEHICLE::IS_VEHICLE_TYRE_BURST(vehicle, wheel.Tyre, false);
+                wheel.BurstCompletely = VEHICLE::IS_VEHICLE_TYRE_BURST(vehicle, wheel.Tyre, true);
+                tickStats.NativesMade += burstNativesPerTyre;
+            }
+            else {
+                wheel.Deflated = false;
+                wheel.BurstCompletely = false;
+            }
+            wheel.Health = VExt::GetWheelHealth(vehicle, i);
+            wheel.TyreHealth = VExt::GetTyreHealth(vehicle, i);
+            wheel.TyreGrip = i < tyreGrips.size() ? tyreGrips[i] : 1.0f;
+            wheel.WetGrip = i < wetGrips.size() ? wetGrips[i] : 1.0f;
+            wheel.Material = VExt::GetTireContactMaterial(vehicle, i);
+        }
+        ++tickStats.Refreshes;
+    }
+}
+
+void WheelStatus::Update(Vehicle vehicle) {
+    lastTickStats = tickStats;
+    tickStats = {};
+
+    if (vehicle == 0) {
+        Reset();
+        return;
+    }
+
+    statusTask.SetRate(g_settings.Misc.WheelStatusRate);
+    bool due = statusTask.Advance(NativeCache::GetFrameTime()) > 0;
+
+    if (vehicle != currentVehicle) {
+        currentVehicle = vehicle;
+        wheels.assign(NativeCache::GetNumWheels(vehicle), Wheel{});
+        statusTask.Reset();
+        due = true;
+    }
+
+    if (due || changed(vehicle))
+        refresh(vehicle);
+}
+
+void WheelStatus::Reset() {
+    currentVehicle = 0;
+    wheels.clear();
+    statusTask.Reset();
+    lastTickStats = {};
+    tickStats = {};
+}
+
+uint8_t WheelStatus::NumWheels() {
+    return static_cast<uint8_t>(wheels.size());
+}
+
+const WheelStatus::Wheel& WheelStatus::Get(uint8_t index) {
+    if (index >= wheels.size())
+        return noWheel;
+
+    if (wheels[index].Tyre != NoTyre)
+        tickStats.NativesRequested += burstNativesPerTyre;
+    return wheels[index];
+}
+
+const WheelStatus::Stats& WheelStatus::GetLastTickStats() {
+    return lastTickStats;
+}
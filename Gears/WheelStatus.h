@@ -0,0 +1,51 @@
+#pragma once
+#include "VehicleModelCache.h"
+
+#include <inc/types.h>
+#include <cstdint>
+
+/*
+ * Per-wheel tyre state for the player vehicle: burst state, health, grip multipliers
+ * and contact material. FFB and the assists read this instead of querying the
+ * natives and wheel memory themselves.
+ * Refreshed at the rate in the settings ([MISC] WheelStatusRate), and right away when
+ * a wheel's health, tyre health or contact material changes, so bursts and surface
+ * changes are picked up on the tick they happen.
+ * Only use from the main script thread.
+ */
+namespace WheelStatus {
+    constexpr uint8_t NoTyre = ModelCache::NoTyre;
+
+    struct Wheel {
+        // IS_VEHICLE_TYRE_BURST index, or NoTyre.
+        uint8_t Tyre = NoTyre;
+        bool Deflated = false;
+        bool BurstCompletely = false;
+        float Health = 0.0f;
+        float TyreHealth = 0.0f;
+        float TyreGrip = 1.0f;
+        float WetGrip = 1.0f;
+        uint16_t Material = 0;
+    };
+
+    struct Stats {
+        uint32_t Refreshes = 0;
+        // Burst natives the readers would have called themselves
+        uint32_t NativesRequested = 0;
+        uint32_t NativesMade = 0;
+    };
+
+    // Call once per tick after VehicleData::Update(), with the available player vehicle.
+    // A different handle than last tick starts over.
+    void Update(Vehicle vehicle);
+
+    // Call when there's no available player vehicle, so a stale one isn't read.
+    void Reset();
+
+    uint8_t NumWheels();
+    // Wheels past NumWheels() read as an intact tyre with neutral grip.
+    const Wheel& Get(uint8_t index);
+
+    // Counters of the previous, completed tick
+    const Stats& GetLastTickStats();
+}
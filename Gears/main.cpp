@@ -10,9 +10,12 @@
 #include "Memory/MemoryPatcher.hpp"
 #include "Memory/VehicleExtensions.hpp"
 #include "Memory/Versions.h"
+#include "UDPTelemetry/SharedTelemetry.h"
+#include "UDPTelemetry/TelemetryArchive.h"
 #include "Util/FileVersion.h"
 #include "Util/Logger.hpp"
 #include "Util/Paths.h"
+#include "Util/TaskPool.h"
 
 #include <inc/main.h>
 #include <fmt/format.h>
@@ -176,6 +179,21 @@ BOOL APIENTRY DllMain(HMODULE hInstance, DWORD reason, LPVOID lpReserved) {
             // but due to GTA5.exe hanging, it's just left as-is.
             extern CarControls g_controls;
             g_controls.GetWheel().FreeDirectInput();
+
+            // Normally closed when recording is turned off. A chunk still being written
+            // on the pool gets a short wait, we're under the loader lock.
+            extern TelemetryArchive::Writer g_telemetryArchive;
+            g_telemetryArchive.Close(std::chrono::milliseconds(250));
+
+            // Tells readers we're gone, and unmaps before the logger stops.
+            extern SharedTelemetry::Publisher g_telemetryPublisher;
+            g_telemetryPublisher.Close();
+
+            // Cancel background jobs first, they may still log.
+            TaskPool::Shutdown();
+
+            // Drain queued log lines and stop the writer thread before we're unloaded.
+            logger.Shutdown();
             break;
         }
         default:
@@ -23,13 +23,15 @@
 #include "Dashboard.h"
 #include "GearRattle.h"
 #include "Textures.h"
+#include "WheelStatus.h"
 
 #include "UDPTelemetry/Socket.h"
 #include "UDPTelemetry/UDPTelemetry.h"
+#include "UDPTelemetry/SharedTelemetry.h"
+#include "UDPTelemetry/TelemetryChannels.h"
 
 #include "Memory/MemoryPatcher.hpp"
 #include "Memory/Offsets.hpp"
-#include "Memory/VehicleBone.h"
 #include "Memory/VehicleFlags.h"
 
 #include "Input/CarControls.hpp"
@@ -40,11 +42,16 @@
 #include "Util/MathExt.h"
 #include "Util/UIUtils.h"
 #include "Util/Timer.h"
-#include "Util/ValueTimer.h"
+#include "Util/SpeedTimers.h"
 #include "Util/GameSound.h"
 #include "Util/SysUtils.h"
 #include "Util/Strings.hpp"
 #include "Util/MiscEnums.h"
+#include "Util/Profiler.h"
+#include "Util/NativeCache.h"
+#include "Util/LazyValue.h"
+#include "Util/Scheduler.h"
+#include "Util/TaskPool.h"
 
 #include <menu.h>
 
@@ -61,6 +68,7 @@
 #include <filesystem>
 #include <numeric>
 #include <fstream>
+#include <ctime>
 
 namespace fs = std::filesystem;
 using VExt = VehicleExtensions;
@@ -74,7 +82,13 @@ std::mutex g_notifyUpdateMutex;
 bool g_checkUpdateDone;
 std::mutex g_checkUpdateDoneMutex;
 
+// The check is submitted once the delay has passed, instead of a worker sleeping on it.
+Timer g_updateCheckTimer(0);
+bool g_updateCheckScheduled = false;
+
 Socket g_socket;
+TelemetryArchive::Writer g_telemetryArchive;
+SharedTelemetry::Publisher g_telemetryPublisher;
 
 NativeMenu::Menu g_menu;
 CarControls g_controls;
@@ -97,7 +111,11 @@ bool g_focused;
 Timer g_wheelInitDelayTimer(0);
 Timer g_lastUpdateTimer(0);
 
-std::vector<ValueTimer<float>> g_speedTimers;
+SpeedTimers::Engine g_speedTimers;
+double g_speedTimersClock = 0.0;
+
+// Stall buildup and throttle hang decay progress in fixed steps.
+Scheduler::Task g_drivetrainTask("Drivetrain", 120.0f);
 
 GameSound g_downshiftProtectSfx("CONFIRM_BEEP", "HUD_MINI_GAME_SOUNDSET", "");
 
@@ -244,24 +262,25 @@ void update_vehicle() {
         setVehicleConfig(g_playerVehicle);
         GearRattle::Stop();
         updateActiveSteeringAnim(g_playerVehicle);
+        // Stepped before this, still holding the last vehicle's state
+        g_drivetrainTask.Reset();
+        DrivingAssists::Reset();
         
         g_controls.PlayFFBDynamics(0, 0);
         g_controls.PlayFFBCollision(0);
+        WheelInput::ResetVehicle();
 
         if (g_playerVehicle != 0) {
             VExt::SetSteeringAngle(g_playerVehicle, 0.0f);
             VExt::SetSteeringInputAngle(g_playerVehicle, 0.0f);
-
-            VehicleBones::RegisterMatrix(g_playerVehicle, "needle_speedo");
-            VehicleBones::RegisterMatrix(g_playerVehicle, "needle_torque");
-            VehicleBones::RegisterMatrix(g_playerVehicle, "steeringwheel");
         }
     }
 
     if (vehAvail) {
         g_vehData.Update(); // Update before doing anything else
+        WheelStatus::Update(g_playerVehicle);
 
-        if (VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+        if (NativeCache::GetIsVehicleEngineRunning(g_playerVehicle)) {
             g_peripherals.IgnitionState = IgnitionState::On;
         }
         else if (!(g_peripherals.IgnitionState == IgnitionState::Stall)) {
@@ -269,6 +288,9 @@ void update_vehicle() {
             g_peripherals.IgnitionState = IgnitionState::Off;
         }
     }
+    else {
+        WheelStatus::Reset();
+    }
     if (g_playerVehicle != g_lastPlayerVehicle && vehAvail) {
         if (g_vehData.mIsCVT)
             g_gearStates.FakeNeutral = false;
@@ -276,20 +298,29 @@ void update_vehicle() {
             g_gearStates.FakeNeutral = g_settings.GameAssists.DefaultNeutral;
     }
 
-    if (g_settings.Debug.Metrics.EnableTimers && vehAvail) {
-        for(auto& valueTimer : g_speedTimers) {
-            float speed;
-            switch(joaat(valueTimer.mUnit.c_str())) {
-                case joaat("kph"):
-                    speed = Length(g_vehData.mVelocity) * 3.6f;
-                    break;
-                case joaat("mph"):
-                    speed = Length(g_vehData.mVelocity) / 0.44704f;
-                    break;
-                default:
-                    speed = Length(g_vehData.mVelocity);
+    if (g_settings.Debug.Metrics.EnableTimers && vehAvail && !g_speedTimers.Empty()) {
+        if (g_playerVehicle != g_lastPlayerVehicle)
+            g_speedTimers.Reset();
+
+        g_speedTimersClock += NativeCache::GetFrameTime();
+        g_speedTimers.Update(g_speedTimersClock, Length(g_vehData.mVelocity));
+
+        if (g_speedTimers.NumResults() > 0) {
+            const std::string resultsFile = Paths::GetModPath() + "\\SpeedTimers.csv";
+            const std::string vehicleName = VEHICLE::GET_DISPLAY_NAME_FROM_VEHICLE_MODEL(g_vehData.mModel);
+            for (size_t i = 0; i < g_speedTimers.NumResults(); ++i) {
+                const auto& result = g_speedTimers.GetResult(i);
+                if (result.Kind == SpeedTimers::EKind::Distance) {
+                    UI::Notify(INFO, fmt::format("Timer: \n{}: {:.3f} s @ {:.0f} kph",
+                        result.Label, result.Time, result.EndSpeed * 3.6f), false);
+                }
+                else {
+                    UI::Notify(INFO, fmt::format("Timer: \n{}: {:.3f} s", result.Label, result.Time), false);
+                }
+                if (!SpeedTimers::AppendResult(resultsFile, vehicleName, result))
+                    logger.Write(ERROR, "[Timers] Failed to write to %s", resultsFile.c_str());
             }
-            valueTimer.Update(speed);
+            g_speedTimers.ClearResults();
         }
     }
     
@@ -306,7 +337,10 @@ void update_inputs() {
     }
     g_lastUpdateTimer.Reset();
 
-    if (g_focused != SysUtil::IsWindowFocused()) {
+    g_controls.UpdateKeyboardSnapshot();
+    bool focused = g_controls.GetKeyboardSnapshot().Focused();
+
+    if (g_focused != focused) {
         // no focus -> focus
         if (!g_focused) {
             logger.Write(DEBUG, "[Wheel] Window focus gained: re-initializing FFB");
@@ -316,7 +350,7 @@ void update_inputs() {
             logger.Write(DEBUG, "[Wheel] Window focus lost");
         }
     }
-    g_focused = SysUtil::IsWindowFocused();
+    g_focused = focused;
 
     if (g_wheelInitDelayTimer.Expired() && g_wheelInitDelayTimer.Period() > 0) {
         g_controls.GetWheel().Acquire();
@@ -468,7 +502,7 @@ void update_manual_features() {
 
         // Simulate "catch point"
         // When the clutch "grabs" and the car starts moving without input
-        if (g_settings().MTOptions.ClutchCreep && VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+        if (g_settings().MTOptions.ClutchCreep && NativeCache::GetIsVehicleEngineRunning(g_playerVehicle)) {
             functionClutchCatch();
         }
     }
@@ -990,7 +1024,7 @@ void functionHShiftTo(int i) {
     bool checkShift = g_settings().MTOptions.ClutchShiftH && g_vehData.mHasClutch;
 
     // shifting from neutral into gear is OK when rev matched
-    float expectedRPM = g_vehData.mDiffSpeed / (g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[i]);
+    float expectedRPM = g_vehData.mDiffSpeed / g_vehData.mGearbox.TopSpeeds[i];
     float rpmTol = g_settings().ShiftOptions.RPMTolerance;
     bool rpmInRange = Math::Near(g_vehData.mRPM, expectedRPM, rpmTol);
 
@@ -1212,7 +1246,7 @@ void functionSShift() {
             return;
         }
 
-        float expectedRPM = g_vehData.mEstimatedSpeed / (g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_gearStates.LockGear - 1]);
+        float expectedRPM = g_vehData.mEstimatedSpeed / g_vehData.mGearbox.TopSpeeds[g_gearStates.LockGear - 1];
         if (g_settings().ShiftOptions.DownshiftProtect &&
             expectedRPM > 1.0f) {
             g_gearStates.DownshiftProtection = true;
@@ -1409,7 +1443,7 @@ void functionAShift() {
     if (g_controls.ThrottleVal >= g_gearStates.ThrottleHang)
         g_gearStates.ThrottleHang = g_controls.ThrottleVal;
     else if (g_gearStates.ThrottleHang > 0.0f)
-        g_gearStates.ThrottleHang -= MISC::GET_FRAME_TIME() * g_settings().AutoParams.EcoRate;
+        g_gearStates.ThrottleHang -= g_drivetrainTask.Elapsed() * g_settings().AutoParams.EcoRate;
 
     if (g_gearStates.ThrottleHang < 0.0f)
         g_gearStates.ThrottleHang = 0.0f;
@@ -1425,9 +1459,9 @@ void functionAShift() {
 
         float nextGearMinSpeed = 0.0f; // don't care about top gear
         if (currGear < g_vehData.mGearTop) {
-            nextGearMinSpeed = g_settings().AutoParams.NextGearMinRPM * g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[currGear + 1];
+            nextGearMinSpeed = g_settings().AutoParams.NextGearMinRPM * g_vehData.mGearbox.TopSpeeds[currGear + 1];
         }
-        float currGearMinSpeed = g_settings().AutoParams.CurrGearMinRPM * g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[currGear];
+        float currGearMinSpeed = g_settings().AutoParams.CurrGearMinRPM * g_vehData.mGearbox.TopSpeeds[currGear];
         float engineLoad = g_gearStates.ThrottleHang - map(g_vehData.mRPM, 0.2f, 1.0f, 0.0f, 1.0f);
         g_gearStates.EngineLoad = engineLoad;
         g_gearStates.UpshiftLoad = g_settings().AutoParams.UpshiftLoad;
@@ -1438,12 +1472,25 @@ void functionAShift() {
         bool tpPassedUp = MISC::GET_GAME_TIMER() > g_gearStates.LastUpshiftTime + static_cast<int>(1000.0f * upshiftDuration * g_settings().AutoParams.UpshiftTimeoutMult);
         bool tpPassedDn = MISC::GET_GAME_TIMER() > g_gearStates.LastUpshiftTime + static_cast<int>(1000.0f * upshiftDuration * g_settings().AutoParams.DownshiftTimeoutMult);
 
+        // User-defined shift schedule, per direction. A direction without a line
+        // for this gear keeps using the load-based logic.
+        const auto& schedule = g_settings().AutoParams.Schedule;
+        float scheduleUpSpeed = schedule.UpshiftSpeed(currGear, g_gearStates.ThrottleHang);
+        float scheduleDnSpeed = schedule.DownshiftSpeed(currGear, g_gearStates.ThrottleHang);
+
         // Shift up.
         if (currGear < g_vehData.mGearTop) {
-            // Clutch still slipping
-            float expectedRPM = g_vehData.mDiffSpeed / (g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[currGear]);
-            if (tpPassedUp && engineLoad < g_gearStates.UpshiftLoad && currSpeed > nextGearMinSpeed && !skidding
-                && g_vehData.mRPM < expectedRPM + 0.05) {
+            bool upshift;
+            if (scheduleUpSpeed >= 0.0f) {
+                upshift = tpPassedUp && !skidding && currSpeed > scheduleUpSpeed;
+            }
+            else {
+                // Clutch still slipping
+                float expectedRPM = g_vehData.mDiffSpeed / g_vehData.mGearbox.TopSpeeds[currGear];
+                upshift = tpPassedUp && engineLoad < g_gearStates.UpshiftLoad && currSpeed > nextGearMinSpeed && !skidding
+                    && g_vehData.mRPM < expectedRPM + 0.05;
+            }
+            if (upshift) {
                 shiftTo(g_vehData.mGearCurr + 1, true);
                 g_gearStates.FakeNeutral = false;
                 g_gearStates.LastUpshiftTime = MISC::GET_GAME_TIMER();
@@ -1460,13 +1507,20 @@ void functionAShift() {
         g_gearStates.DownshiftLoad = g_settings().AutoParams.DownshiftLoad * gearRatioRatio;
 
         // Shift down
-        if (currGear > 1) {
+        if (currGear > 1 && scheduleDnSpeed >= 0.0f) {
+            // Still drop a gear below the minimum speed, whatever the schedule says.
+            if (tpPassedDn && currSpeed < scheduleDnSpeed || currSpeed < currGearMinSpeed) {
+                shiftTo(currGear - 1, true);
+                g_gearStates.FakeNeutral = false;
+            }
+        }
+        else if (currGear > 1) {
             if (tpPassedDn && engineLoad > g_gearStates.DownshiftLoad || currSpeed < currGearMinSpeed) {
                 // TargetGear: Find the lowest gear where engineLoad(gear) < downshiftLoad(gear)
                 int targetGear = currGear - 1;
 
                 for (auto gear = 1; gear < currGear - 1; ++gear) {
-                    float expectedRPM = g_vehData.mDiffSpeed / (g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[gear]);
+                    float expectedRPM = g_vehData.mDiffSpeed / g_vehData.mGearbox.TopSpeeds[gear];
                     float engineLoadForGear = g_gearStates.ThrottleHang - map(expectedRPM, 0.2f, 1.0f, 0.0f, 1.0f);
 
                     if (engineLoadForGear < g_gearStates.UpshiftLoad * 0.9f || expectedRPM > 0.9f)
@@ -1518,8 +1572,8 @@ void functionClutchCatch() {
         clutchEngaged = !g_gearStates.FakeNeutral;
     }
 
-    float minSpeed = idleRPM * (g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_vehData.mGearCurr]);
-    float expectedSpeed = g_vehData.mRPM * (g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_vehData.mGearCurr]) * clutchRatio;
+    float minSpeed = idleRPM * g_vehData.mGearbox.TopSpeeds[g_vehData.mGearCurr];
+    float expectedSpeed = g_vehData.mRPM * g_vehData.mGearbox.TopSpeeds[g_vehData.mGearCurr] * clutchRatio;
     float actualSpeed = g_vehData.mDiffSpeed;
 
     if (abs(actualSpeed) < abs(minSpeed) &&
@@ -1560,10 +1614,10 @@ void functionClutchCatch() {
 }
 
 void functionEngStall() {
-    const float stallRate = MISC::GET_FRAME_TIME() * g_settings().MTParams.StallingRate;
+    const float stallRate = g_drivetrainTask.Elapsed() * g_settings().MTParams.StallingRate;
     const float stallSlip = g_settings().MTParams.StallingSlip;
 
-    float minSpeed = g_settings().MTParams.StallingRPM * abs(g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_vehData.mGearCurr]);
+    float minSpeed = g_settings().MTParams.StallingRPM * abs(g_vehData.mGearbox.TopSpeeds[g_vehData.mGearCurr]);
     float actualSpeed = g_vehData.mDiffSpeed;
 
     // Closer to idle speed = less buildup for stalling
@@ -1577,7 +1631,7 @@ void functionEngStall() {
     if (clutchEngaged &&
         g_vehData.mRPM <= 0.201f && //engine actually has to idle
         abs(actualSpeed) < abs(minSpeed) &&
-        VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+        NativeCache::GetIsVehicleEngineRunning(g_playerVehicle)) {
         float finalClutchRatio = map(clutchRatio, stallSlip, 1.0f, 0.0f, 1.0f);
         float change = finalClutchRatio * speedDiffRatio * stallRate;
         g_gearStates.StallProgress += change;
@@ -1588,8 +1642,9 @@ void functionEngStall() {
     }
 
     if (g_gearStates.StallProgress > 1.0f) {
-        if (VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+        if (NativeCache::GetIsVehicleEngineRunning(g_playerVehicle)) {
             VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, false, true, true);
+            NativeCache::Invalidate(g_playerVehicle);
             g_peripherals.IgnitionState = IgnitionState::Stall;
 
             if (g_controls.PrevInput == CarControls::Wheel)
@@ -1605,9 +1660,10 @@ void functionEngStall() {
 
     // Simulate push-start
     // We'll just assume the ignition thing is in the "on" position.
-    if (actualSpeed > minSpeed && !VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle) &&
+    if (actualSpeed > minSpeed && !NativeCache::GetIsVehicleEngineRunning(g_playerVehicle) &&
         clutchEngaged) {
         VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, true, true, true);
+        NativeCache::Invalidate(g_playerVehicle);
     }
 
     //UI::ShowText(0.1, 0.00, 0.4, fmt::format("Stall progress: {:.2f}", g_gearStates.StallProgress));
@@ -1633,7 +1689,7 @@ void functionEngDamage() {
 void functionEngLock() {
     // Checks enough suspension compression and sensible speeds
     bool use = true;
-    float minSpeed = g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_vehData.mGearCurr];
+    float minSpeed = g_vehData.mGearbox.TopSpeeds[g_vehData.mGearCurr];
 
     for (uint32_t i = 0; i < g_vehData.mWheelCount; ++i) {
         if (g_vehData.mSuspensionTravel[i] == 0.0f &&
@@ -1668,7 +1724,7 @@ void functionEngLock() {
     auto wheelsSpeed      = g_vehData.mDiffSpeed;
 
     bool wrongDirection = false;
-    if (VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+    if (NativeCache::GetIsVehicleEngineRunning(g_playerVehicle)) {
         if (g_vehData.mGearCurr == 0) {
             if (g_vehData.mVelocity.y > reverseThreshold && wheelsSpeed > reverseThreshold) {
                 wrongDirection = true;
@@ -1715,6 +1771,7 @@ void functionEngLock() {
             }
             else {
                 VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, false, true, true);
+                NativeCache::Invalidate(g_playerVehicle);
             }
         }
         if (g_settings.Debug.DisplayInfo) {
@@ -1732,7 +1789,7 @@ void functionEngBrake() {
 
     // Checks enough suspension compression and sensible speeds
     bool use = true;
-    float minSpeed = g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_vehData.mGearCurr] * activeBrakeThreshold;
+    float minSpeed = g_vehData.mGearbox.TopSpeeds[g_vehData.mGearCurr] * activeBrakeThreshold;
 
     for (uint32_t i = 0; i < g_vehData.mWheelCount; ++i) {
         if (g_vehData.mSuspensionTravel[i] == 0.0f &&
@@ -1785,53 +1842,11 @@ void functionEngBrake() {
 //                       Mod functions: Gearbox control
 ///////////////////////////////////////////////////////////////////////////////
 
-// TODO: Move somewhere else, some day...
-std::vector<float> GetHandBrakeVals(float handbrakeValInput){
-    std::vector<float> brakeVals(g_vehData.mWheelCount);
-    const auto offsets = VExt::GetWheelOffsets(g_playerVehicle);
-
-    const float handlingHandbrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fHandBrakeForce);
-
-    float inpBrakeForce = handlingHandbrakeForce * handbrakeValInput;
-
-    for (uint8_t i = 0; i < g_vehData.mWheelCount; i++) {
-        if (offsets[i].y > 0.0f) {
-            // front
-            brakeVals[i] = 0.0f;
-        }
-        else {
-            // rear
-            brakeVals[i] = inpBrakeForce;
-        }
-    }
-    return brakeVals;
-}
-
-// TODO: I should really rework how brake values are mixed with the assists...
-// This just gets the correct value for all wheels during normal braking
-// TODO: Also probably refactor so NPC vehicles use this
-std::vector<float> GetInputBrakes() {
-    std::vector<float> brakeVals(g_vehData.mWheelCount);
-    const auto offsets = VExt::GetWheelOffsets(g_playerVehicle);
-
-    const float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-    const float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
-    const float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
-
-    float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
-
-    for (int i = 0; i < g_vehData.mWheelCount; i++) {
-        float bbal = offsets[i].y > 0.0f ? bbalF : bbalR;
-        brakeVals[i] = inpBrakeForce * bbal;
-    }
-
-    return brakeVals;
-}
-
 void handleBrakePatch() {
-    auto absData = DrivingAssists::GetABS();
+    PROFILE_SCOPE("handleBrakePatch");
+    const auto& absData = DrivingAssists::GetABS();
     auto tcsData = DrivingAssists::GetTCS();
-    auto espData = DrivingAssists::GetESP();
+    const auto& espData = DrivingAssists::GetESP();
     auto lsdData = DrivingAssists::GetLSD();
 
     // tcs & lc
@@ -1961,7 +1976,7 @@ void handleBrakePatch() {
                 fakeRev(true, g_controls.ThrottleVal);
             }
 
-            float expectedRPM = g_vehData.mDiffSpeed / (g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_gearStates.NextGear]);
+            float expectedRPM = g_vehData.mDiffSpeed / g_vehData.mGearbox.TopSpeeds[g_gearStates.NextGear];
             if (g_gearStates.ShiftDirection == ShiftDirection::Down &&
                 g_settings().ShiftOptions.DownshiftBlip) {
                 bool clutchOK = g_gearStates.ShiftState == ShiftState::FullClutch || g_gearStates.ShiftState == ShiftState::ReleasingClutch;
@@ -2013,11 +2028,7 @@ void handleBrakePatch() {
     // LSD actively conflicts with brakes (applies negative brake)
     // So override LSD with the assist.
     if (patchBrake) {
-        lsdData.Use = false;
-        lsdData.BrakeLR = 0.0f;
-        lsdData.BrakeRR = 0.0f;
-        lsdData.BrakeLF = 0.0f;
-        lsdData.BrakeRF = 0.0f;
+        lsdData = {};
     }
     else if (lsdData.Use) {
         patchBrake = true;
@@ -2054,48 +2065,13 @@ void handleBrakePatch() {
             }
         }
 
-        // Only use LSD if no other assists are working, as LSD would just reduce brake force.
-        if (lsdData.Use && !espData.Use && !tcsData.Use && !absData.Use) {
-            auto brakeVals = DrivingAssists::GetLSDBrakes(lsdData);
-            for (int i = 0; i < g_vehData.mWheelCount; i++) {
-                VExt::SetWheelBrakePressure(g_playerVehicle, i, brakeVals[i]);
-            }
-        }
-
-        if (g_controls.UseAnalogHandbrake && g_controls.HandbrakeVal > 0.01f || 
-            espData.Use ||
-            tcsData.Use && g_settings().DriveAssists.TCS.Mode == 0 ||
-            absData.Use) {
-            auto hbVals = GetHandBrakeVals(g_controls.HandbrakeVal);
-            auto espBrakeVals = DrivingAssists::GetESPBrakes(espData);
-            auto tcsBrakeVals = DrivingAssists::GetTCSBrakes(tcsData);
-            auto absBrakeVals = DrivingAssists::GetABSBrakes(absData);
-
-            auto normalBrakeVals = GetInputBrakes();
-
-            for (int i = 0; i < g_vehData.mWheelCount; i++) {
-                float brakeVal = 0.0f;
-                if (espData.Use) {
-                    brakeVal = espBrakeVals[i];
-                }
-                if (tcsData.Use && g_settings().DriveAssists.TCS.Mode == 0) {
-                    brakeVal = std::max(brakeVal, tcsBrakeVals[i]);
-                }
-                if (absData.Use && g_vehData.mWheelsAbs[i]) {
-                    brakeVal = std::min(brakeVal, absBrakeVals[i]);
-                }
-                if (hbVals[i] > 0.0f) {
-                    brakeVal = brakeVal + hbVals[i];
+        DrivingAssists::BrakeOutput brakes;
+        if (DrivingAssists::GetBrakes(absData, tcsData, espData, lsdData, brakes)) {
+            for (uint8_t i = 0; i < brakes.NumWheels; i++) {
+                if (brakes.Handbrake[i]) {
                     VExt::SetIsABSActive(g_playerVehicle, i, false);
                 }
-                // aka only use analog handbrake
-                if (!espData.Use &&
-                    !(tcsData.Use && g_settings().DriveAssists.TCS.Mode == 0) &&
-                    !(absData.Use && g_vehData.mWheelsAbs[i])) {
-                    brakeVal += normalBrakeVals[i];
-                }
-
-                VExt::SetWheelBrakePressure(g_playerVehicle, i, brakeVal);
+                VExt::SetWheelBrakePressure(g_playerVehicle, i, brakes.Pressure[i]);
             }
         }
     }
@@ -2163,7 +2139,7 @@ void handleBrakePatch() {
 void fakeRev(bool customThrottle, float customThrottleVal) {
     const float driveInertia = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fDriveInertia);
     float throttleVal = customThrottle ? customThrottleVal : g_controls.ThrottleVal;
-    float timeStep = MISC::GET_FRAME_TIME();
+    float timeStep = NativeCache::GetFrameTime();
     float accelRatio = 2.0f * driveInertia * timeStep;
     float rpmValTemp = g_vehData.mRPMPrev > g_vehData.mRPM ? g_vehData.mRPMPrev - g_vehData.mRPM : 0.0f;
     if (g_vehData.mGearCurr == 1) {			// For some reason, first gear revs slower
@@ -2298,7 +2274,7 @@ void functionLimiter() {
 
     g_gearStates.HitRPMLimiter = g_vehData.mRPM > 1.0f;
 
-    float maxSpeed = g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_vehData.mGearCurr];
+    float maxSpeed = g_vehData.mGearbox.TopSpeeds[g_vehData.mGearCurr];
 
     if (g_vehData.mEstimatedSpeed > maxSpeed && g_vehData.mRPM >= 1.0f) {
         g_gearStates.HitRPMSpeedLimiter = true;
@@ -2505,14 +2481,16 @@ void startStopEngine() {
         g_controls.ThrottleVal > 0.90f &&
         g_controls.ClutchVal > 1.0f - g_settings().MTParams.ClutchThreshold;
 
-    if (!VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle) &&
+    if (!NativeCache::GetIsVehicleEngineRunning(g_playerVehicle) &&
         (controllerActive || keyboardActive || wheelActive || throttleStart)) {
         VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, true, false, true);
+        NativeCache::Invalidate(g_playerVehicle);
     }
 
-    if (VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle) &&
+    if (NativeCache::GetIsVehicleEngineRunning(g_playerVehicle) &&
         (controllerActive && g_settings.Controller.ToggleEngine || keyboardActive || wheelActive)) {
         VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, false, true, true);
+        NativeCache::Invalidate(g_playerVehicle);
         StartingAnimation::PlayManual();
     }
 }
@@ -2604,9 +2582,60 @@ void StartUDPTelemetry() {
             g_socket.Start(g_settings.Misc.UDPAddress, g_settings.Misc.UDPPort);
 }
 
+void openTelemetryArchive() {
+    const std::string archiveDir = Paths::GetModPath() + "\\Telemetry";
+    std::error_code error;
+    fs::create_directories(archiveDir, error);
+
+    auto now = std::chrono::system_clock::now();
+    std::time_t nowTime = std::chrono::system_clock::to_time_t(now);
+    std::tm localTime{};
+    localtime_s(&localTime, &nowTime);
+    char fileName[32];
+    strftime(fileName, sizeof(fileName), "%Y%m%d_%H%M%S.tla", &localTime);
+
+    const std::string archiveFile = archiveDir + "\\" + fileName;
+    auto unixMs = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+    if (g_telemetryArchive.Open(archiveFile, TelemetryChannels::Table, unixMs)) {
+        logger.Write(INFO, "[Telemetry] Recording to [%s]", archiveFile.c_str());
+    }
+    else {
+        // Don't retry every tick.
+        g_settings.Misc.TelemetryArchive = false;
+        UI::Notify(ERROR, "Failed to create telemetry archive, recording disabled.", false);
+    }
+}
+
 void update_UDPTelemetry() {
-    if (Util::VehicleAvailable(g_playerVehicle, g_playerPed) && g_settings.Misc.UDPTelemetry) {
-        UDPTelemetry::UpdatePacket(g_socket, g_playerVehicle, g_vehData, g_controls);
+    if (!g_settings.Misc.TelemetryArchive && g_telemetryArchive.IsOpen())
+        g_telemetryArchive.Close();
+    if (!g_settings.Misc.SharedTelemetry && g_telemetryPublisher.IsOpen())
+        g_telemetryPublisher.Close();
+
+    bool send = g_settings.Misc.UDPTelemetry;
+    bool record = g_settings.Misc.TelemetryArchive;
+    bool publish = g_settings.Misc.SharedTelemetry;
+    if (!(send || record || publish) || !Util::VehicleAvailable(g_playerVehicle, g_playerPed))
+        return;
+
+    auto packet = UDPTelemetry::BuildPacket(g_playerVehicle, g_vehData, g_controls);
+    if (send)
+        UDPTelemetry::SendPacket(g_socket, packet);
+
+    if (record) {
+        if (!g_telemetryArchive.IsOpen())
+            openTelemetryArchive();
+        UDPTelemetry::RecordPacket(g_telemetryArchive, packet, g_vehData);
+    }
+
+    if (publish) {
+        if (!g_telemetryPublisher.IsOpen() && !g_telemetryPublisher.Open()) {
+            // Don't retry every tick.
+            g_settings.Misc.SharedTelemetry = false;
+            UI::Notify(ERROR, "Failed to create shared memory telemetry, disabled.", false);
+            return;
+        }
+        UDPTelemetry::PublishPacket(g_telemetryPublisher, packet, g_vehData);
     }
 }
 
@@ -2626,6 +2655,10 @@ void loadConfigs() {
         return;
     }
 
+    // Files parse independently, the results are collected in directory order.
+    // The base config is only read meanwhile.
+    VehicleConfig* baseConfig = g_settings.BaseConfig();
+    std::vector<std::pair<std::string, TaskPool::Handle<VehicleConfig>>> loads;
     for (auto& file : fs::directory_iterator(vehConfigsPath)) {
         if (StrUtil::toLower(fs::path(file).extension().string()) != ".ini")
             continue;
@@ -2633,17 +2666,33 @@ void loadConfigs() {
         if (StrUtil::toLower(fs::path(file).stem().string()) == "basevehicleconfig")
             continue;
 
+        std::string path = file.path().string();
+        auto load = TaskPool::Submit([baseConfig, path] {
+            VehicleConfig config;
+            config.SetFiles(baseConfig, path);
+            config.LoadSettings();
+            return config;
+        });
+        loads.emplace_back(std::move(path), std::move(load));
+    }
+
+    for (auto& [path, load] : loads) {
         VehicleConfig config;
-        config.SetFiles(g_settings.BaseConfig(), file.path().string());
-        config.LoadSettings();
+        try {
+            config = load.Get();
+        }
+        catch (const TaskPool::Cancelled&) {
+            continue;
+        }
+
         if (config.ModelNames.empty() && config.Plates.empty()) {
             logger.Write(WARN,
                 "Vehicle settings file [%s] contained no model names or plates, skipping...",
-                file.path().string().c_str());
+                path.c_str());
             continue;
         }
-        g_vehConfigs.push_back(config);
-        logger.Write(DEBUG, "Loaded vehicle config [%s]", config.Name.c_str());
+        g_vehConfigs.push_back(std::move(config));
+        logger.Write(DEBUG, "Loaded vehicle config [%s]", g_vehConfigs.back().Name.c_str());
     }
     logger.Write(INFO, "Configs loaded: %d", g_vehConfigs.size());
     setVehicleConfig(g_playerVehicle);
@@ -2651,14 +2700,15 @@ void loadConfigs() {
 
 // Always call *after* settings have been (re)loaded
 void initTimers() {
-    g_speedTimers.clear();
+    std::vector<SpeedTimers::Window> windows;
     if (g_settings.Debug.Metrics.EnableTimers) {
         for (const auto& params : g_settings.Debug.Metrics.Timers) {
-            g_speedTimers.emplace_back(params.Unit,
-                [](const std::string& msg) { UI::Notify(INFO, msg, false); },
-                params.LimA, params.LimB, params.Tolerance);
+            SpeedTimers::Window window;
+            if (SpeedTimers::MakeWindow(params.Unit, params.LimA, params.LimB, params.Tolerance, window))
+                windows.push_back(std::move(window));
         }
     }
+    g_speedTimers.Configure(std::move(windows));
 }
 
 void loadLut(const std::string& lutPath) {
@@ -2700,6 +2750,7 @@ void readSettings() {
     g_gearStates.FakeNeutral = g_settings.GameAssists.DefaultNeutral;
     g_menu.ReadSettings();
     initTimers();
+    Profiler::SetEnabled(g_settings.Debug.Metrics.Profiler.Enable);
 
     SteeringAnimation::Load();
 
@@ -2715,24 +2766,32 @@ void readSettings() {
     logger.Write(INFO, "Settings read");
 }
 
-void threadCheckUpdate(unsigned milliseconds) {
-    std::thread([milliseconds]() {
+void scheduleUpdateCheck(unsigned milliseconds) {
+    g_updateCheckTimer.Reset(milliseconds);
+    g_updateCheckScheduled = true;
+}
+
+void submitUpdateCheck() {
+    TaskPool::Submit(TaskPool::Priority::Low, [] {
         std::lock_guard releaseInfoLock(g_releaseInfoMutex);
         std::lock_guard checkUpdateLock(g_checkUpdateDoneMutex);
         std::lock_guard notifyUpdateLock(g_notifyUpdateMutex);
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
-
         bool newAvailable = CheckUpdate(g_releaseInfo);
 
         if (newAvailable && g_settings.Update.IgnoredVersion != g_releaseInfo.Version) {
             g_notifyUpdate = true;
         }
         g_checkUpdateDone = true;
-    }).detach();
+    });
 }
 
 void update_update_notification() {
+    if (g_updateCheckScheduled && g_updateCheckTimer.Expired()) {
+        g_updateCheckScheduled = false;
+        submitUpdateCheck();
+    }
+
     std::unique_lock releaseInfoLock(g_releaseInfoMutex, std::try_to_lock);
     std::unique_lock checkUpdateLock(g_checkUpdateDoneMutex, std::try_to_lock);
     std::unique_lock notifyUpdateLock(g_notifyUpdateMutex, std::try_to_lock);
@@ -2771,14 +2830,17 @@ void ScriptInit() {
 
     SteeringAnimation::SetFile(animationsFile);
 
+    // The offset scans don't need the settings, so they run while those load.
+    auto vextInit = TaskPool::Submit(TaskPool::Priority::High, [] { VExt::Init(); });
+
     readSettings();
     loadConfigs();
 
     if (g_settings.Update.EnableUpdate) {
-        threadCheckUpdate(10000);
+        scheduleUpdateCheck(10000);
     }
 
-    VExt::Init();
+    vextInit.Wait();
     if (!MemoryPatcher::Test()) {
         logger.Write(ERROR, "Patchability test failed!");
         MemoryPatcher::Error = true;
@@ -2798,23 +2860,37 @@ void ScriptInit() {
 
 void ScriptTick() {
     while (true) {
-        update_player();
-        update_vehicle();
-        Dashboard::Update();
-        Misc::UpdateEngineOnOff();
-        update_inputs();
-        update_steering();
-        MTHUD::UpdateHUD();
-        update_input_controls();
-        update_manual_transmission();
-        update_misc_features();
-        GearRattle::Update();
-        update_menu();
-        update_update_notification();
-        update_UDPTelemetry();
-        SteeringAnimation::Update();
-        StartingAnimation::Update();
-        UpdatePause();
+        NativeCache::NewTick();
+        LazyGraph::NewTick();
+        g_drivetrainTask.Advance(NativeCache::GetFrameTime());
+        DrivingAssists::Update();
+        {
+            PROFILE_SCOPE("Tick");
+            // Vehicle control stages. Later stages may WAIT, so close the memory view first.
+            VExt::BeginTick();
+            PROFILE_CALL(update_player());
+            PROFILE_CALL(update_vehicle());
+            PROFILE_CALL(Dashboard::Update());
+            PROFILE_CALL(Misc::UpdateEngineOnOff());
+            PROFILE_CALL(update_inputs());
+            PROFILE_CALL(update_steering());
+            PROFILE_CALL(MTHUD::UpdateHUD());
+            PROFILE_CALL(update_input_controls());
+            PROFILE_CALL(update_manual_transmission());
+            PROFILE_CALL(update_misc_features());
+            PROFILE_CALL(GearRattle::Update());
+            VExt::EndTick();
+
+            PROFILE_CALL(update_menu());
+            // The menu may WAIT, after which the cached natives are a frame old.
+            NativeCache::InvalidateAll();
+            PROFILE_CALL(update_update_notification());
+            PROFILE_CALL(update_UDPTelemetry());
+            PROFILE_CALL(SteeringAnimation::Update());
+            PROFILE_CALL(StartingAnimation::Update());
+            PROFILE_CALL(UpdatePause());
+        }
+        Profiler::EndTick();
         WAIT(0);
     }
 }
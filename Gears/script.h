@@ -1,7 +1,7 @@
 #pragma once
 #include "ScriptSettings.hpp"
 
-void threadCheckUpdate(unsigned milliseconds);
+void scheduleUpdateCheck(unsigned milliseconds);
 
 ///////////////////////////////////////////////////////////////////////////////
 //                           Mod functions: Mod control
@@ -0,0 +1,669 @@
+// Reads telemetry archives recorded by the script (settings_general.ini [MISC] TelemetryArchive)
+// and shared memory telemetry ([MISC] SharedTelemetry).
+// Portable, see README.md for building.
+#include "../Gears/UDPTelemetry/SharedTelemetry.h"
+#include "../Gears/UDPTelemetry/TelemetryArchive.h"
+#include "../Gears/UDPTelemetry/TelemetryChannels.h"
+#include "../Gears/Util/Logger.hpp"
+#include "../Gears/Util/TaskPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    double mib(uint64_t bytes) {
+        return static_cast<double>(bytes) / (1024.0 * 1024.0);
+    }
+
+    int usage() {
+        fprintf(stderr,
+            "Usage:\n"
+            "  TelemetryTool info <archive>\n"
+            "  TelemetryTool csv <archive> [--from <s>] [--to <s>] [--out <file>]\n"
+            "      Time range in seconds since the first record. Writes to stdout without --out.\n"
+            "  TelemetryTool bench [<archive>] [--seconds <s>]\n"
+            "      Encode/decode speed and compression ratio, of the archive or of\n"
+            "      <s> seconds (default 3600) of generated 60 Hz driving.\n"
+            "  TelemetryTool shm-read [--count <n>] [--interval <ms>]\n"
+            "      Prints the shared memory telemetry of the running game every <ms> (default 100).\n"
+            "  TelemetryTool shm-bench [--seconds <s>] [--readers <n>] [--rate <hz>]\n"
+            "      Shared memory publish cost and reader staleness, publishing at <hz>\n"
+            "      (default 1000) for <s> seconds (default 5) to <n> spinning readers (default 2).\n");
+        return 2;
+    }
+
+    const char* option(int argc, char** argv, const char* name) {
+        for (int i = 0; i < argc - 1; ++i) {
+            if (strcmp(argv[i], name) == 0)
+                return argv[i + 1];
+        }
+        return nullptr;
+    }
+
+    bool openArchive(TelemetryArchive::Reader& reader, const char* file) {
+        if (!reader.Open(file)) {
+            fprintf(stderr, "%s: %s\n", file, reader.Error().c_str());
+            return false;
+        }
+        if (reader.Recovered())
+            fprintf(stderr, "%s: not closed properly, index rebuilt from %zu chunks\n", file, reader.Index().size());
+        return true;
+    }
+
+    int info(const char* file) {
+        TelemetryArchive::Reader reader;
+        if (!openArchive(reader, file))
+            return 1;
+
+        const auto& index = reader.Index();
+        uint64_t records = 0;
+        for (const auto& entry : index)
+            records += entry.Records;
+
+        size_t channels = reader.Channels().size();
+        uint64_t rawBytes = records * (sizeof(int64_t) + channels * sizeof(float));
+        uint64_t fileBytes = std::filesystem::file_size(file);
+        double duration = index.empty() ? 0.0 : (index.back().LastTimeMs - index.front().FirstTimeMs) / 1000.0;
+
+        printf("Channels: %zu\n", channels);
+        for (const auto& channel : reader.Channels())
+            printf("  %-16s step %g\n", channel.Name.c_str(), channel.Step);
+        printf("Chunks:   %zu\n", index.size());
+        printf("Records:  %llu\n", static_cast<unsigned long long>(records));
+        printf("Duration: %.1f s\n", duration);
+        printf("Size:     %.2f MiB, raw %.2f MiB, %.1fx\n", mib(fileBytes), mib(rawBytes),
+            fileBytes > 0 ? static_cast<double>(rawBytes) / static_cast<double>(fileBytes) : 0.0);
+        return 0;
+    }
+
+    int csv(int argc, char** argv, const char* file) {
+        TelemetryArchive::Reader reader;
+        if (!openArchive(reader, file))
+            return 1;
+        if (reader.Index().empty())
+            return 0;
+
+        const char* fromArg = option(argc, argv, "--from");
+        const char* toArg = option(argc, argv, "--to");
+        const char* outArg = option(argc, argv, "--out");
+
+        int64_t startMs = reader.Index().front().FirstTimeMs;
+        int64_t fromMs = fromArg ? startMs + static_cast<int64_t>(atof(fromArg) * 1000.0) : startMs;
+        int64_t toMs = toArg ? startMs + static_cast<int64_t>(atof(toArg) * 1000.0) : std::numeric_limits<int64_t>::max();
+
+        FILE* out = outArg ? fopen(outArg, "w") : stdout;
+        if (!out) {
+            fprintf(stderr, "Can't create %s\n", outArg);
+            return 1;
+        }
+
+        fputs("Time", out);
+        for (const auto& channel : reader.Channels())
+            fprintf(out, ",%s", channel.Name.c_str());
+        fputc('\n', out);
+
+        // Decimals down to the stored step, %g would cut off positions at 6 digits.
+        const size_t channels = reader.Channels().size();
+        std::vector<int> decimals;
+        for (const auto& channel : reader.Channels()) {
+            double step = channel.Step > 0.0f ? channel.Step : 1.0;
+            decimals.push_back(std::clamp(static_cast<int>(std::ceil(-std::log10(step) - 1e-6)), 0, 9));
+        }
+
+        std::vector<int64_t> times;
+        std::vector<float> values;
+        for (size_t chunk = reader.FindChunk(fromMs); chunk < reader.Index().size(); ++chunk) {
+            if (reader.Index()[chunk].FirstTimeMs > toMs)
+                break;
+            if (!reader.ReadChunk(chunk, times, values)) {
+                fprintf(stderr, "Chunk %zu: %s\n", chunk, reader.Error().c_str());
+                break;
+            }
+
+            for (size_t r = 0; r < times.size(); ++r) {
+                if (times[r] < fromMs || times[r] > toMs)
+                    continue;
+                fprintf(out, "%.3f", (times[r] - startMs) / 1000.0);
+                for (size_t c = 0; c < channels; ++c)
+                    fprintf(out, ",%.*f", decimals[c], values[r * channels + c]);
+                fputc('\n', out);
+            }
+        }
+
+        if (out != stdout)
+            fclose(out);
+        return 0;
+    }
+
+    struct Recording {
+        std::vector<std::string> Names;
+        std::vector<float> Steps;
+        std::vector<int64_t> Times;
+        std::vector<float> Values;
+
+        std::vector<TelemetryArchive::Channel> Channels() const {
+            std::vector<TelemetryArchive::Channel> channels;
+            for (size_t i = 0; i < Names.size(); ++i)
+                channels.push_back({ Names[i].c_str(), Steps[i] });
+            return channels;
+        }
+    };
+
+    // Laps of a 1.5 km loop with braking zones, gear changes and road noise.
+    Recording generate(double seconds) {
+        using namespace TelemetryChannels;
+        Recording rec;
+        for (const auto& channel : Table) {
+            rec.Names.push_back(channel.Name);
+            rec.Steps.push_back(channel.Step);
+        }
+
+        uint32_t state = 0x9E3779B9u;
+        auto noise = [&state] {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return static_cast<float>(state >> 8) / static_cast<float>(1u << 24) - 0.5f;
+        };
+
+        const size_t records = static_cast<size_t>(seconds * 60.0);
+        rec.Times.reserve(records);
+        rec.Values.reserve(records * Count);
+        std::vector<float> v(Count);
+        double t = 0.0, distance = 0.0, fuel = 65.0;
+        int64_t timeMs = 123456;
+        for (size_t i = 0; i < records; ++i) {
+            double dt = 1.0 / 60.0 + noise() * 0.002;
+            t += dt;
+            timeMs += static_cast<int64_t>(std::lround(dt * 1000.0));
+
+            double lap = std::fmod(t, 90.0) / 90.0;
+            double speed = 25.0 + 20.0 * std::sin(lap * 2.0 * 3.14159265 * 4.0);
+            distance += speed * dt;
+            double heading = lap * 2.0 * 3.14159265;
+            float braking = std::cos(lap * 2.0 * 3.14159265 * 4.0) > 0.8 ? 0.8f : 0.0f;
+            fuel -= 0.0005 * dt;
+
+            v[PosX] = static_cast<float>(240.0 * std::cos(heading) + 1200.0);
+            v[PosY] = static_cast<float>(240.0 * std::sin(heading) - 800.0);
+            v[PosZ] = static_cast<float>(30.0 + 2.0 * std::sin(heading * 3.0));
+            v[Speed] = static_cast<float>(speed);
+            v[VelX] = static_cast<float>(-speed * std::sin(heading));
+            v[VelY] = static_cast<float>(speed * std::cos(heading));
+            v[VelZ] = noise() * 0.2f;
+            v[Pitch] = noise() * 0.5f;
+            v[Roll] = static_cast<float>(speed * 0.05) + noise() * 0.3f;
+            v[Yaw] = static_cast<float>(std::fmod(heading * 57.29578 + 180.0, 360.0) - 180.0);
+            for (int w = 0; w < 4; ++w) {
+                v[SuspPosFL + w] = 0.05f + noise() * 0.02f;
+                v[SuspVelFL + w] = noise() * 0.4f;
+                v[WheelSpeedFL + w] = static_cast<float>(speed) + noise() * 0.1f;
+            }
+            v[Throttle] = braking > 0.0f ? 0.0f : 0.7f + noise() * 0.05f;
+            v[Steer] = 0.15f + noise() * 0.02f;
+            v[Brake] = braking;
+            v[Clutch] = 0.0f;
+            v[Gear] = static_cast<float>(1 + static_cast<int>(speed / 10.0));
+            v[AccelLat] = static_cast<float>(speed * speed / 240.0) + noise() * 0.3f;
+            v[AccelLong] = (braking > 0.0f ? -8.0f : 2.0f) + noise() * 0.3f;
+            v[EngineRevs] = static_cast<float>(3000.0 + std::fmod(speed * 200.0, 4000.0));
+            v[MaxRpm] = 8000.0f;
+            v[IdleRpm] = 1600.0f;
+            v[MaxGears] = 6.0f;
+            v[Fuel] = static_cast<float>(fuel);
+            v[RPM] = v[EngineRevs] / 8000.0f;
+            v[GameThrottle] = v[Throttle];
+            v[GameClutch] = 1.0f;
+            v[Turbo] = v[Throttle] * 0.9f;
+            v[SteeringAngle] = v[Steer] * 0.6f;
+            v[GearNext] = v[Gear];
+            v[Handbrake] = 0.0f;
+
+            rec.Times.push_back(timeMs);
+            rec.Values.insert(rec.Values.end(), v.begin(), v.end());
+        }
+        return rec;
+    }
+
+    bool load(const char* file, Recording& rec) {
+        TelemetryArchive::Reader reader;
+        if (!openArchive(reader, file))
+            return false;
+
+        for (const auto& channel : reader.Channels()) {
+            rec.Names.push_back(channel.Name);
+            rec.Steps.push_back(channel.Step);
+        }
+
+        std::vector<int64_t> times;
+        std::vector<float> values;
+        for (size_t chunk = 0; chunk < reader.Index().size(); ++chunk) {
+            if (!reader.ReadChunk(chunk, times, values)) {
+                fprintf(stderr, "Chunk %zu: %s\n", chunk, reader.Error().c_str());
+                return false;
+            }
+            rec.Times.insert(rec.Times.end(), times.begin(), times.end());
+            rec.Values.insert(rec.Values.end(), values.begin(), values.end());
+        }
+        return true;
+    }
+
+    int bench(int argc, char** argv) {
+        const char* file = argc > 2 && argv[2][0] != '-' ? argv[2] : nullptr;
+        const char* secondsArg = option(argc, argv, "--seconds");
+
+        Recording rec;
+        if (file) {
+            if (!load(file, rec))
+                return 1;
+        }
+        else {
+            rec = generate(secondsArg ? atof(secondsArg) : 3600.0);
+        }
+
+        const size_t channels = rec.Names.size();
+        const size_t records = rec.Times.size();
+        if (records == 0) {
+            fprintf(stderr, "No records\n");
+            return 1;
+        }
+        const uint64_t rawBytes = records * (sizeof(int64_t) + channels * sizeof(float));
+
+        std::vector<float> inverseSteps;
+        for (float step : rec.Steps)
+            inverseSteps.push_back(step > 0.0f ? 1.0f / step : 1.0f);
+
+        // Encode, repeated for a stable number
+        std::vector<std::vector<uint8_t>> bodies;
+        std::vector<size_t> counts;
+        double encodeSeconds = 0.0;
+        int passes = 0;
+        do {
+            bodies.clear();
+            counts.clear();
+            auto start = Clock::now();
+            for (size_t first = 0; first < records; first += TelemetryArchive::RecordsPerChunk) {
+                size_t count = std::min<size_t>(TelemetryArchive::RecordsPerChunk, records - first);
+                bodies.emplace_back();
+                TelemetryArchive::EncodeChunk(&rec.Times[first], &rec.Values[first * channels], count,
+                    inverseSteps, bodies.back());
+                counts.push_back(count);
+            }
+            encodeSeconds += secondsSince(start);
+            ++passes;
+        } while (encodeSeconds < 0.5);
+
+        uint64_t encodedBytes = 0;
+        for (const auto& body : bodies)
+            encodedBytes += body.size() + sizeof(TelemetryArchive::ChunkHeader) + sizeof(TelemetryArchive::IndexEntry);
+
+        // Decode and check the round trip
+        std::vector<int64_t> times;
+        std::vector<float> values;
+        double decodeSeconds = 0.0;
+        double worstError = 0.0;
+        for (int pass = 0; pass < passes; ++pass) {
+            size_t first = 0;
+            auto start = Clock::now();
+            for (size_t chunk = 0; chunk < bodies.size(); ++chunk) {
+                if (!TelemetryArchive::DecodeChunk(bodies[chunk].data(), bodies[chunk].size(), counts[chunk],
+                    rec.Steps, times, values)) {
+                    fprintf(stderr, "Decode failed\n");
+                    return 1;
+                }
+                if (pass == 0) {
+                    for (size_t i = 0; i < values.size(); ++i) {
+                        size_t c = i % channels;
+                        float original = rec.Values[first * channels + i];
+                        // Half a step, plus the float rounding of large values
+                        double rounding = std::abs(original) * std::numeric_limits<float>::epsilon();
+                        double error = (std::abs(values[i] - original) - rounding) / rec.Steps[c];
+                        worstError = std::max(worstError, error);
+                    }
+                }
+                first += counts[chunk];
+            }
+            decodeSeconds += secondsSince(start);
+        }
+
+        // Through the Writer: background encoding and file I/O
+        std::string tempFile = (std::filesystem::temp_directory_path() / "TelemetryToolBench.tla").string();
+        TelemetryArchive::Writer writer;
+        auto writeStart = Clock::now();
+        if (!writer.Open(tempFile, rec.Channels(), 0)) {
+            fprintf(stderr, "Can't create %s\n", tempFile.c_str());
+            return 1;
+        }
+        double addSeconds = 0.0;
+        for (size_t r = 0; r < records; ++r) {
+            auto addStart = Clock::now();
+            writer.Add(rec.Times[r], &rec.Values[r * channels]);
+            addSeconds += secondsSince(addStart);
+        }
+        writer.Close();
+        double writeSeconds = secondsSince(writeStart);
+        uint64_t fileBytes = std::filesystem::file_size(tempFile);
+        std::filesystem::remove(tempFile);
+
+        printf("Records:   %zu x %zu channels, %.1f s\n", records, channels,
+            (rec.Times.back() - rec.Times.front()) / 1000.0);
+        printf("Raw:       %.2f MiB (%.1f MiB/hour at 60 Hz)\n", mib(rawBytes),
+            mib(rawBytes) / static_cast<double>(records) * 60.0 * 3600.0);
+        printf("Encoded:   %.2f MiB, %.1fx smaller (%.1f MiB/hour at 60 Hz)\n", mib(encodedBytes),
+            static_cast<double>(rawBytes) / static_cast<double>(encodedBytes),
+            mib(encodedBytes) / static_cast<double>(records) * 60.0 * 3600.0);
+        printf("Encode:    %.0f MiB/s of raw input\n", mib(rawBytes) * passes / encodeSeconds);
+        printf("Decode:    %.0f MiB/s of raw output\n", mib(rawBytes) * passes / decodeSeconds);
+        printf("Max error: %.3f steps\n", worstError);
+        printf("Writer:    %.2f MiB file, %.3f s total, %.2f us per Add on the recording thread\n",
+            mib(fileBytes), writeSeconds, addSeconds * 1e6 / static_cast<double>(records));
+        return worstError <= 0.5 ? 0 : 1;
+    }
+
+    // Every float of a bench sample is derived from its index, so a torn read
+    // (half old, half new sample) shows up as a mismatch.
+    float benchValue(uint64_t index) {
+        return static_cast<float>(index & 0xFFFFF);
+    }
+
+    void fillBenchSample(SharedTelemetry::Sample& sample, uint64_t index) {
+        float value = benchValue(index);
+        float* begin = reinterpret_cast<float*>(&sample.Packet);
+        std::fill(begin, begin + sizeof(TelemetryPacket) / sizeof(float), value);
+        sample.RPM = sample.GameThrottle = sample.GameClutch = sample.Turbo = value;
+        sample.SteeringAngle = sample.GearNext = sample.Handbrake = value;
+    }
+
+    bool benchSampleIntact(const SharedTelemetry::Sample& sample) {
+        float value = benchValue(sample.Index);
+        const float* begin = reinterpret_cast<const float*>(&sample.Packet);
+        const float* end = begin + sizeof(TelemetryPacket) / sizeof(float);
+        return std::all_of(begin, end, [value](float f) { return f == value; }) &&
+            sample.RPM == value && sample.Handbrake == value;
+    }
+
+    struct Latencies {
+        std::vector<int64_t> Ns;
+
+        void Print(const char* name) {
+            if (Ns.empty()) {
+                printf("%s no samples\n", name);
+                return;
+            }
+            std::sort(Ns.begin(), Ns.end());
+            auto at = [this](double p) {
+                return static_cast<double>(Ns[std::min(Ns.size() - 1, static_cast<size_t>(p * Ns.size()))]) / 1000.0;
+            };
+            printf("%s p50 %.1f us, p99 %.1f us, max %.1f us (%zu samples)\n",
+                name, at(0.5), at(0.99), static_cast<double>(Ns.back()) / 1000.0, Ns.size());
+        }
+    };
+
+    int shmRead(int argc, char** argv) {
+        const char* countArg = option(argc, argv, "--count");
+        const char* intervalArg = option(argc, argv, "--interval");
+        int count = countArg ? atoi(countArg) : -1;
+        auto interval = std::chrono::milliseconds(intervalArg ? atoi(intervalArg) : 100);
+
+        SharedTelemetry::Subscriber subscriber;
+        if (!subscriber.Open()) {
+            fprintf(stderr, "No shared memory telemetry, is [MISC] SharedTelemetry enabled and a vehicle driven?\n");
+            return 1;
+        }
+
+        std::vector<SharedTelemetry::Sample> samples(SharedTelemetry::RingSize);
+        uint64_t lastIndex = 0;
+        SharedTelemetry::Sample latest{};
+        if (subscriber.ReadLatest(latest))
+            lastIndex = latest.Index;
+
+        printf("%10s %10s %8s %8s %5s %6s %9s %7s %7s\n",
+            "Index", "GameTime", "Speed", "RPM", "Gear", "Steer", "Age(ms)", "Samples", "Missed");
+        for (int line = 0; count < 0 || line < count; ++line) {
+            std::this_thread::sleep_for(interval);
+            if (!subscriber.Active()) {
+                fprintf(stderr, "Script closed the shared memory\n");
+                return 0;
+            }
+
+            uint64_t missed = 0;
+            size_t received = subscriber.ReadSince(lastIndex, samples.data(), samples.size(), &missed);
+            if (!subscriber.ReadLatest(latest))
+                continue;
+
+            double age = static_cast<double>(SharedTelemetry::NowNs() - latest.PublishTimeNs) / 1e6;
+            printf("%10llu %10lld %8.2f %8.0f %5.0f %6.2f %9.1f %7zu %7llu\n",
+                static_cast<unsigned long long>(latest.Index), static_cast<long long>(latest.GameTimeMs),
+                latest.Packet.Speed, latest.Packet.EngineRevs, latest.Packet.Gear, latest.Packet.Steer,
+                age, received, static_cast<unsigned long long>(missed));
+        }
+        return 0;
+    }
+
+#ifndef _WIN32
+    // sendto per sample to a loopback socket, and how old samples are when a
+    // reader thread gets them: what UDP telemetry costs for the same data.
+    void udpBench(size_t samples, Latencies& staleness, double& sendNs) {
+        int receiver = socket(AF_INET, SOCK_DGRAM, 0);
+        int sender = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t addressLength = sizeof(address);
+        int bufferSize = 4 * 1024 * 1024;
+        setsockopt(receiver, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize));
+        if (receiver < 0 || sender < 0 ||
+            bind(receiver, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+            getsockname(receiver, reinterpret_cast<sockaddr*>(&address), &addressLength) != 0) {
+            fprintf(stderr, "UDP setup failed\n");
+            sendNs = 0.0;
+            return;
+        }
+
+        std::thread reader([&] {
+            SharedTelemetry::Sample sample{};
+            for (size_t i = 0; i < samples; ++i) {
+                if (recv(receiver, &sample, sizeof(sample), 0) != static_cast<ssize_t>(sizeof(sample)))
+                    break;
+                staleness.Ns.push_back(SharedTelemetry::NowNs() - sample.PublishTimeNs);
+            }
+        });
+
+        SharedTelemetry::Sample sample{};
+        double seconds = 0.0;
+        for (size_t i = 1; i <= samples; ++i) {
+            auto start = Clock::now();
+            sample.Index = i;
+            sample.PublishTimeNs = SharedTelemetry::NowNs();
+            sendto(sender, &sample, sizeof(sample), 0, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+            seconds += secondsSince(start);
+            // Paced like the shared memory run, so the reader keeps up.
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        sendNs = seconds * 1e9 / static_cast<double>(samples);
+
+        // Unblocks the reader if packets were dropped.
+        shutdown(receiver, SHUT_RDWR);
+        reader.join();
+        close(sender);
+        close(receiver);
+    }
+#endif
+
+    int shmBench(int argc, char** argv) {
+        const char* secondsArg = option(argc, argv, "--seconds");
+        const char* readersArg = option(argc, argv, "--readers");
+        const char* rateArg = option(argc, argv, "--rate");
+        double seconds = secondsArg ? atof(secondsArg) : 5.0;
+        int readerCount = std::max(1, readersArg ? atoi(readersArg) : 2);
+        double rate = rateArg ? atof(rateArg) : 1000.0;
+
+        // Own name, so a running game isn't disturbed.
+        const char* name = "TelemetryToolBench";
+        SharedTelemetry::Publisher publisher;
+        if (!publisher.Open(name)) {
+            fprintf(stderr, "Can't create shared memory\n");
+            return 1;
+        }
+
+        // Publish cost, no readers and flat out
+        SharedTelemetry::Sample sample{};
+        const size_t publishCount = 1000000;
+        auto start = Clock::now();
+        for (size_t i = 0; i < publishCount; ++i) {
+            sample.GameTimeMs = static_cast<int64_t>(i);
+            publisher.Publish(sample);
+        }
+        double publishNs = secondsSince(start) * 1e9 / publishCount;
+
+        // Readers in their own threads with their own mappings, as separate
+        // programs would. Spinning readers see a sample as soon as it's out.
+        std::atomic<bool> stop = false;
+        std::atomic<uint64_t> torn = 0;
+        std::vector<Latencies> staleness(readerCount);
+        std::vector<uint64_t> retries(readerCount + 1);
+        std::vector<std::thread> readers;
+        for (int r = 0; r < readerCount; ++r) {
+            readers.emplace_back([&, r] {
+                SharedTelemetry::Subscriber subscriber;
+                if (!subscriber.Open(name))
+                    return;
+                SharedTelemetry::Sample latest{};
+                // Skip what's left of the flat out run
+                uint64_t lastIndex = publishCount;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    if (!subscriber.ReadLatest(latest) || latest.Index <= lastIndex) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    staleness[r].Ns.push_back(SharedTelemetry::NowNs() - latest.PublishTimeNs);
+                    if (!benchSampleIntact(latest))
+                        ++torn;
+                    lastIndex = latest.Index;
+                }
+                retries[r] = subscriber.Retries();
+            });
+        }
+
+        // A ring reader that wants every sample but only wakes up every 20 ms.
+        uint64_t ringReceived = 0, ringMissed = 0;
+        std::thread ringReader([&] {
+            SharedTelemetry::Subscriber subscriber;
+            if (!subscriber.Open(name))
+                return;
+            std::vector<SharedTelemetry::Sample> samples(SharedTelemetry::RingSize);
+            uint64_t lastIndex = publishCount;
+            uint64_t expected = lastIndex + 1;
+            while (!stop.load(std::memory_order_relaxed)) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                uint64_t missed = 0;
+                size_t count = subscriber.ReadSince(lastIndex, samples.data(), samples.size(), &missed);
+                ringMissed += missed;
+                for (size_t i = 0; i < count; ++i) {
+                    if (!benchSampleIntact(samples[i]))
+                        ++torn;
+                    // Missed samples are counted, anything else out of order is a bug.
+                    if (samples[i].Index < expected)
+                        ++torn;
+                    expected = samples[i].Index + 1;
+                }
+                ringReceived += count;
+            }
+            retries[readerCount] = subscriber.Retries();
+        });
+
+        // Paced publishing while they read
+        auto period = std::chrono::duration<double>(1.0 / rate);
+        auto next = Clock::now();
+        auto end = next + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+        double pacedSeconds = 0.0;
+        size_t pacedCount = 0;
+        while (Clock::now() < end) {
+            auto publishStart = Clock::now();
+            fillBenchSample(sample, publishCount + pacedCount + 1);
+            publisher.Publish(sample);
+            pacedSeconds += secondsSince(publishStart);
+            ++pacedCount;
+            next += std::chrono::duration_cast<Clock::duration>(period);
+            std::this_thread::sleep_until(next);
+        }
+        stop = true;
+        for (auto& reader : readers)
+            reader.join();
+        ringReader.join();
+        publisher.Close();
+
+        Latencies allStaleness;
+        uint64_t allRetries = 0;
+        for (int r = 0; r < readerCount; ++r)
+            allStaleness.Ns.insert(allStaleness.Ns.end(), staleness[r].Ns.begin(), staleness[r].Ns.end());
+        for (uint64_t r : retries)
+            allRetries += r;
+
+        printf("Sample:       %zu bytes, mapping %zu bytes\n", sizeof(SharedTelemetry::Sample),
+            sizeof(SharedTelemetry::Layout));
+        printf("Publish:      %.1f ns without readers, %.1f ns with %d spinning readers\n",
+            publishNs, pacedSeconds * 1e9 / static_cast<double>(pacedCount), readerCount + 1);
+        printf("Published:    %zu samples at %.0f Hz\n", pacedCount, rate);
+        allStaleness.Print("Staleness:   ");
+        printf("Ring reader:  %llu samples, %llu missed\n",
+            static_cast<unsigned long long>(ringReceived), static_cast<unsigned long long>(ringMissed));
+        printf("Retries:      %llu, torn reads: %llu\n",
+            static_cast<unsigned long long>(allRetries), static_cast<unsigned long long>(torn.load()));
+
+#ifndef _WIN32
+        Latencies udpStaleness;
+        double sendNs = 0.0;
+        udpBench(std::min<size_t>(pacedCount, 20000), udpStaleness, sendNs);
+        printf("UDP sendto:   %.1f ns\n", sendNs);
+        udpStaleness.Print("UDP recv age:");
+#endif
+        return torn == 0 ? 0 : 1;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2)
+        return usage();
+
+    std::string command = argv[1];
+    int result;
+    if (command == "info" && argc >= 3)
+        result = info(argv[2]);
+    else if (command == "csv" && argc >= 3)
+        result = csv(argc, argv, argv[2]);
+    else if (command == "bench")
+        result = bench(argc, argv);
+    else if (command == "shm-read")
+        result = shmRead(argc, argv);
+    else if (command == "shm-bench")
+        result = shmBench(argc, argv);
+    else
+        return usage();
+
+    TaskPool::Shutdown();
+    return result;
+}
@@ -0,0 +1,111 @@
+// ASCache with a 50000 model hashes.cache: building the index, loading an existing
+// index, and lookups. For comparison, the text parse into an unordered_map that
+// ASCache::Get() did before, and its lookups with and without the map copy it returned.
+#include "../Gears/Util/AddonSpawnerCache.h"
+#include "../Gears/Util/Paths.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Find() without Load() uses these, the benchmark always calls Load() first.
+std::string Paths::GetModuleFolder(HMODULE) { return {}; }
+HMODULE Paths::GetOurModuleHandle() { return nullptr; }
+std::string Paths::GetModPath() { return {}; }
+
+namespace {
+    using namespace std::chrono;
+
+    constexpr size_t models = 50000;
+    constexpr size_t lookups = 1000000;
+
+    volatile size_t sink;
+
+    template <typename Fn>
+    double timeUs(Fn fn) {
+        auto start = steady_clock::now();
+        fn();
+        return duration<double, std::micro>(steady_clock::now() - start).count();
+    }
+
+    std::unordered_map<Hash, std::string> parseText(const std::string& file) {
+        std::unordered_map<Hash, std::string> map;
+        std::ifstream in(file);
+        Hash hash;
+        std::string name;
+        while (in >> hash >> name)
+            map.insert({ hash, name });
+        return map;
+    }
+}
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "AddonSpawnerCacheBench";
+    const std::string sourceFile = (dir / "hashes.cache").string();
+    const std::string indexFile = (dir / "AddonSpawnerHashes.idx").string();
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    std::vector<Hash> hashes;
+    {
+        std::ofstream out(sourceFile, std::ios::binary);
+        for (size_t i = 0; i < models; ++i) {
+            hashes.push_back(static_cast<Hash>((i + 1) * 2654435761u));
+            out << hashes.back() << " addon_model_" << i << "\r\n";
+        }
+    }
+
+    // Half hits, half misses
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<size_t> pick(0, models - 1);
+    std::vector<Hash> queries(lookups);
+    for (size_t i = 0; i < lookups; ++i)
+        queries[i] = i % 2 ? hashes[pick(rng)] : static_cast<Hash>(rng());
+
+    printf("%zu models, %zu lookups\n", models, lookups);
+
+    double build = timeUs([&] { ASCache::Load(sourceFile, indexFile); });
+    double load = 0.0;
+    for (int i = 0; i < 10; ++i)
+        load += timeUs([&] { ASCache::Load(sourceFile, indexFile); }) / 10.0;
+    double find = timeUs([&] {
+        size_t found = 0;
+        for (Hash hash : queries)
+            found += !ASCache::Find(hash).empty();
+        sink = found;
+    });
+    printf("Index: build %8.0f us, load existing %8.0f us, lookup %6.1f ns\n",
+        build, load, find * 1000.0 / lookups);
+
+    std::unordered_map<Hash, std::string> map;
+    double parse = timeUs([&] { map = parseText(sourceFile); });
+    double mapFind = timeUs([&] {
+        size_t found = 0;
+        for (Hash hash : queries)
+            found += map.find(hash) != map.end();
+        sink = found;
+    });
+    // Get() returned the map by value, so every lookup copied it. Fewer rounds of those.
+    constexpr size_t copies = 100;
+    double copyFind = timeUs([&] {
+        size_t found = 0;
+        for (size_t i = 0; i < copies; ++i) {
+            auto copy = map;
+            found += copy.find(queries[i]) != copy.end();
+        }
+        sink = found;
+    });
+    printf("Map:   parse %8.0f us,                          lookup %6.1f ns, with copy %8.0f us\n",
+        parse, mapFind * 1000.0 / lookups, copyFind / copies);
+
+    fs::remove_all(dir);
+    return 0;
+}
@@ -0,0 +1,183 @@
+// ASCache: builds the index from a generated hashes.cache, reuses it while the
+// cache is unchanged, and rebuilds it when the cache changes or the index is
+// truncated or corrupted. Falls back to memory when the index can't be written,
+// and Find() picks up a hashes.cache that appears later.
+#include "Check.h"
+#include "../Gears/Util/AddonSpawnerCache.h"
+#include "../Gears/Util/Paths.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    const fs::path dir = fs::temp_directory_path() / "AddonSpawnerCacheTest";
+    const std::string sourceFile = (dir / "hashes.cache").string();
+    const std::string indexFile = (dir / "AddonSpawnerHashes.idx").string();
+    // Where Find() looks without Load(). Off Windows the backslashes are part of the name.
+    const std::string gameFolder = (dir / "game").string();
+    const std::string defaultSource = gameFolder + "\\AddonSpawner\\hashes.cache";
+}
+
+std::string Paths::GetModuleFolder(HMODULE) { return gameFolder; }
+HMODULE Paths::GetOurModuleHandle() { return nullptr; }
+std::string Paths::GetModPath() { return dir.string(); }
+
+namespace {
+    struct Model {
+        uint32_t Hash;
+        std::string Name;
+    };
+
+    std::vector<Model> makeModels(size_t count) {
+        std::vector<Model> models;
+        for (size_t i = 0; i < count; ++i) {
+            // Unsorted, spread over the whole range
+            uint32_t hash = static_cast<uint32_t>((i + 1) * 2654435761u);
+            models.push_back({ hash, "model" + std::to_string(i) });
+        }
+        return models;
+    }
+
+    void writeSource(const std::vector<Model>& models, const std::string& extra = {},
+        const std::string& file = sourceFile) {
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        for (const auto& model : models)
+            out << model.Hash << " " << model.Name << "\r\n";
+        out << extra;
+    }
+
+    bool allFound(const std::vector<Model>& models) {
+        for (const auto& model : models) {
+            if (ASCache::Find(static_cast<Hash>(model.Hash)) != model.Name)
+                return false;
+        }
+        return true;
+    }
+
+    std::vector<char> readIndex() {
+        std::ifstream in(indexFile, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void writeIndex(const std::vector<char>& data) {
+        std::ofstream out(indexFile, std::ios::binary | std::ios::trunc);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    // Loads over a damaged index: it's rebuilt to the same contents.
+    void checkRebuilt(const char* name, const std::vector<char>& damaged,
+        const std::vector<Model>& models, const std::vector<char>& good) {
+        writeIndex(damaged);
+        size_t count = ASCache::Load(sourceFile, indexFile);
+        bool rebuilt = readIndex() == good;
+        bool found = allFound(models);
+        CHECK(count == models.size());
+        CHECK(rebuilt);
+        CHECK(found);
+        printf("%-32s %s\n", name, count == models.size() && rebuilt && found ? "rebuilt" : "FAILED");
+    }
+}
+
+int main() {
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    // No hashes.cache: nothing found
+    CHECK(ASCache::Load(sourceFile, indexFile) == 0);
+    CHECK(ASCache::Find(0x12345678).empty());
+    CHECK(!fs::exists(indexFile));
+
+    // Duplicates keep the first name, a malformed tail ends the list
+    auto models = makeModels(5000);
+    writeSource(models, std::to_string(models[0].Hash) + " duplicate\n42 truncated_name\n7\n");
+    CHECK(ASCache::Load(sourceFile, indexFile) == models.size() + 1);
+    CHECK(allFound(models));
+    CHECK(ASCache::Find(42) == "truncated_name");
+    CHECK(ASCache::Find(7).empty());
+    CHECK(ASCache::Find(0).empty());
+
+    writeSource(models);
+    CHECK(ASCache::Load(sourceFile, indexFile) == models.size());
+    CHECK(allFound(models));
+    const std::vector<char> good = readIndex();
+    CHECK(!good.empty());
+
+    // Unchanged cache: the index on disk is used as is
+    {
+        auto before = fs::last_write_time(indexFile);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        CHECK(ASCache::Load(sourceFile, indexFile) == models.size());
+        CHECK(fs::last_write_time(indexFile) == before);
+        CHECK(allFound(models));
+    }
+
+    // Damaged indexes are rebuilt instead of mapped
+    {
+        constexpr size_t headerSize = 32;
+        constexpr size_t sourceSizeOffset = 16;
+        const size_t offsetsStart = headerSize + 4 * models.size();
+
+        auto corrupt = [&](size_t offset, uint32_t value) {
+            std::vector<char> data = good;
+            memcpy(data.data() + offset, &value, sizeof(value));
+            return data;
+        };
+
+        checkRebuilt("Empty", {}, models, good);
+        checkRebuilt("Shorter than the header", std::vector<char>(good.begin(), good.begin() + 20), models, good);
+        checkRebuilt("Truncated", std::vector<char>(good.begin(), good.end() - 1), models, good);
+        std::vector<char> longer = good;
+        longer.push_back('x');
+        checkRebuilt("Trailing data", longer, models, good);
+        checkRebuilt("Wrong magic", corrupt(0, 0x12345678), models, good);
+        checkRebuilt("Wrong version", corrupt(4, 99), models, good);
+        checkRebuilt("Count too large", corrupt(8, static_cast<uint32_t>(models.size() + 1)), models, good);
+        checkRebuilt("Count huge", corrupt(8, 0xFFFFFFFF), models, good);
+        checkRebuilt("Pool size wrong", corrupt(12, 1), models, good);
+        checkRebuilt("Stale source size", corrupt(sourceSizeOffset, 1), models, good);
+        checkRebuilt("First offset not 0", corrupt(offsetsStart, 1), models, good);
+        checkRebuilt("Offset out of order", corrupt(offsetsStart + 4 * 100, 0xFFFFFF), models, good);
+    }
+
+    // A changed cache rebuilds the index
+    {
+        auto more = makeModels(6000);
+        writeSource(more);
+        CHECK(ASCache::Load(sourceFile, indexFile) == more.size());
+        CHECK(allFound(more));
+        CHECK(readIndex().size() > good.size());
+    }
+
+    // The index can't be written: the same index is kept in memory
+    {
+        const std::string unwritable = (dir / "missing" / "AddonSpawnerHashes.idx").string();
+        CHECK(ASCache::Load(sourceFile, unwritable) == 6000);
+        CHECK(allFound(makeModels(6000)));
+        CHECK(!fs::exists(unwritable));
+        CHECK(!fs::exists(unwritable + ".tmp"));
+    }
+
+    // No hashes.cache yet: Find() looks again after a while, not on every call
+    {
+        CHECK(ASCache::Load((dir / "missing.cache").string(), indexFile) == 0);
+        CHECK(ASCache::Find(models[0].Hash).empty());
+
+        fs::create_directories(fs::path(defaultSource).parent_path());
+        writeSource(models, {}, defaultSource);
+        CHECK(ASCache::Find(models[0].Hash).empty());
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+        CHECK(allFound(models));
+    }
+
+    fs::remove_all(dir);
+    return Check::Result("AddonSpawnerCacheTest");
+}
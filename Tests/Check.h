@@ -0,0 +1,33 @@
+#pragma once
+// Minimal checks for the standalone tests in this folder, see README.md.
+#include <cmath>
+#include <cstdio>
+
+namespace Check {
+    inline int Failures = 0;
+
+    inline int Result(const char* name) {
+        if (Failures == 0)
+            printf("%s: passed\n", name);
+        else
+            printf("%s: %d check(s) failed\n", name, Failures);
+        return Failures == 0 ? 0 : 1;
+    }
+}
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            ++Check::Failures; \
+        } \
+    } while (0)
+
+#define CHECK_NEAR(a, b, eps) \
+    do { \
+        double check_a_ = (a), check_b_ = (b); \
+        if (!(std::abs(check_a_ - check_b_) <= (eps))) { \
+            printf("%s:%d: CHECK_NEAR(%s, %s) failed: %g vs %g\n", __FILE__, __LINE__, #a, #b, check_a_, check_b_); \
+            ++Check::Failures; \
+        } \
+    } while (0)
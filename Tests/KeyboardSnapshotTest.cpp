@@ -0,0 +1,130 @@
+// KeyboardSnapshot with a fake key source: held keys, focus loss, bindings,
+// and the consume-on-read edges CarControls relies on.
+#include "Check.h"
+#include "../Gears/Input/KeyboardSnapshot.h"
+
+#include <set>
+
+namespace {
+    std::set<int> downKeys;
+    bool focused = true;
+
+    constexpr int KeyW = 0x57;
+    constexpr int KeyS = 0x53;
+    constexpr int KeyUnbound = 0x41;
+
+    enum Slot : size_t { Throttle, Brake, Shift };
+
+    KeyboardSnapshot makeSnapshot() {
+        KeyboardSnapshot snapshot([](int key) { return downKeys.count(key) != 0; },
+                                  [] { return focused; });
+        KeyboardSnapshot::KeySet keys;
+        keys.set(KeyW);
+        keys.set(KeyS);
+        snapshot.SetKeys(keys);
+        return snapshot;
+    }
+
+    void testDown() {
+        downKeys = { KeyW, KeyUnbound };
+        focused = true;
+        auto snapshot = makeSnapshot();
+        snapshot.Update();
+        CHECK(snapshot.Focused());
+        CHECK(snapshot.IsDown(KeyW));
+        CHECK(!snapshot.IsDown(KeyS));
+        // Not in the key set, never read
+        CHECK(!snapshot.IsDown(KeyUnbound));
+        CHECK(!snapshot.IsDown(-1));
+        CHECK(!snapshot.IsDown(256));
+    }
+
+    void testEdgesConsumedOnRead() {
+        downKeys.clear();
+        focused = true;
+        auto snapshot = makeSnapshot();
+        snapshot.Update();
+        CHECK(!snapshot.JustPressed(Throttle, KeyW));
+
+        downKeys = { KeyW };
+        snapshot.Update();
+        CHECK(snapshot.JustPressed(Throttle, KeyW));
+        // Second query in the same tick: already consumed
+        CHECK(!snapshot.JustPressed(Throttle, KeyW));
+        // Other slots keep their own edge
+        CHECK(snapshot.JustPressed(Shift, KeyW));
+
+        // Held
+        snapshot.Update();
+        CHECK(!snapshot.JustPressed(Throttle, KeyW));
+        CHECK(snapshot.IsDown(KeyW));
+
+        // Released, then pressed again
+        downKeys.clear();
+        snapshot.Update();
+        CHECK(!snapshot.JustPressed(Throttle, KeyW));
+        downKeys = { KeyW };
+        snapshot.Update();
+        CHECK(snapshot.JustPressed(Throttle, KeyW));
+    }
+
+    void testEdgeAcrossUnqueriedTicks() {
+        // Like the old per-control state: the edge is relative to the last query,
+        // so a press that started while nobody asked is still reported once.
+        downKeys.clear();
+        focused = true;
+        auto snapshot = makeSnapshot();
+        snapshot.Update();
+        CHECK(!snapshot.JustPressed(Brake, KeyS));
+
+        downKeys = { KeyS };
+        snapshot.Update();
+        snapshot.Update();
+        CHECK(snapshot.JustPressed(Brake, KeyS));
+        CHECK(!snapshot.JustPressed(Brake, KeyS));
+    }
+
+    void testFocusLoss() {
+        downKeys = { KeyW };
+        focused = true;
+        auto snapshot = makeSnapshot();
+        snapshot.Update();
+        CHECK(snapshot.JustPressed(Throttle, KeyW));
+
+        focused = false;
+        snapshot.Update();
+        CHECK(!snapshot.Focused());
+        CHECK(!snapshot.IsDown(KeyW));
+        CHECK(!snapshot.JustPressed(Throttle, KeyW));
+
+        // Key still held when focus comes back: a new press for the game
+        focused = true;
+        snapshot.Update();
+        CHECK(snapshot.JustPressed(Throttle, KeyW));
+    }
+
+    void testRebinding() {
+        downKeys = { KeyW };
+        focused = true;
+        auto snapshot = makeSnapshot();
+        snapshot.Update();
+        CHECK(snapshot.IsDown(KeyW));
+
+        KeyboardSnapshot::KeySet keys;
+        keys.set(KeyS);
+        snapshot.SetKeys(keys);
+        // Unbound keys don't linger until the next update
+        CHECK(!snapshot.IsDown(KeyW));
+        snapshot.Update();
+        CHECK(!snapshot.IsDown(KeyW));
+    }
+}
+
+int main() {
+    testDown();
+    testEdgesConsumedOnRead();
+    testEdgeAcrossUnqueriedTicks();
+    testFocusLoss();
+    testRebinding();
+    return Check::Result("KeyboardSnapshotTest");
+}
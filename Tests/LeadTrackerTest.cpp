@@ -0,0 +1,210 @@
+// ProbeScheduler and LeadTracker with a fake RaySource whose rays take a few
+// frames to complete: round-robin within the per-frame budget, range rate on a
+// closing lead car, the switch margin and dropping a lost target.
+#include "Check.h"
+#include "../Gears/Util/LeadTracker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <vector>
+
+using namespace Cruise;
+
+namespace {
+    // Rays report Pending for PendingPolls polls, then Ready with what the scene
+    // had when they were started, like the game's async shape tests.
+    class FakeRaySource : public RaySource {
+    public:
+        std::function<ProbeResult(uint32_t ray)> Scene = [](uint32_t ray) { return ProbeResult{ ray }; };
+        int PendingPolls = 0;   // 0: ready the next frame
+        bool FailStart = false;
+        bool FailPoll = false;
+
+        std::vector<uint32_t> Started;  // Since ClearStarted()
+        bool StartedInFlight = false;   // A ray was started while still in flight
+
+        int Start(uint32_t ray) override {
+            if (FailStart)
+                return 0;
+            for (const auto& [handle, probe] : mProbes)
+                StartedInFlight = StartedInFlight || probe.Result.Ray == ray;
+            Started.push_back(ray);
+            mProbes[++mLastHandle] = { Scene(ray), PendingPolls };
+            return mLastHandle;
+        }
+
+        EStatus Poll(int handle, ProbeResult& result) override {
+            auto it = mProbes.find(handle);
+            if (it == mProbes.end())
+                return EStatus::Failed;
+            if (it->second.PollsLeft-- > 0)
+                return EStatus::Pending;
+            result = it->second.Result;
+            mProbes.erase(it);
+            return FailPoll ? EStatus::Failed : EStatus::Ready;
+        }
+
+        void ClearStarted() { Started.clear(); }
+
+    private:
+        struct Probe {
+            ProbeResult Result;
+            int PollsLeft;
+        };
+        std::map<int, Probe> mProbes;
+        int mLastHandle = 0;
+    };
+
+    ProbeResult hit(uint32_t ray, int entity, float distance) {
+        return { ray, true, entity, distance };
+    }
+}
+
+int main() {
+    constexpr uint32_t numRays = 9;
+
+    // Budget 3, results the next frame: 3 rays per frame, in order, all collected
+    {
+        FakeRaySource source;
+        ProbeScheduler scheduler(source, numRays);
+        std::vector<ProbeResult> completed;
+        std::vector<uint32_t> collected;
+        for (int frame = 0; frame <= 30; ++frame) {
+            source.ClearStarted();
+            completed.clear();
+            scheduler.Update(3, completed);
+            CHECK(source.Started.size() == 3);
+            for (size_t i = 0; i < source.Started.size(); ++i)
+                CHECK(source.Started[i] == (frame * 3 + i) % numRays);
+            CHECK(completed.size() == (frame == 0 ? 0u : 3u));
+            for (const auto& result : completed)
+                collected.push_back(result.Ray);
+        }
+        // Every ray equally often
+        for (uint32_t ray = 0; ray < numRays; ++ray)
+            CHECK(std::count(collected.begin(), collected.end(), ray) == 30 * 3 / numRays);
+        CHECK(!source.StartedInFlight);
+    }
+
+    // Slow rays: never more in flight than the fan, never a ray twice, never over budget
+    {
+        FakeRaySource source;
+        source.PendingPolls = 3;
+        ProbeScheduler scheduler(source, numRays);
+        std::vector<ProbeResult> completed;
+        size_t collected = 0;
+        for (int frame = 0; frame < 60; ++frame) {
+            source.ClearStarted();
+            completed.clear();
+            scheduler.Update(4, completed);
+            CHECK(source.Started.size() <= 4);
+            CHECK(scheduler.InFlight() <= numRays);
+            collected += completed.size();
+        }
+        CHECK(!source.StartedInFlight);
+        CHECK(collected > 60);
+    }
+
+    // Rays that can't start or that fail aren't kept in flight, Reset forgets the rest
+    {
+        FakeRaySource source;
+        ProbeScheduler scheduler(source, numRays);
+        std::vector<ProbeResult> completed;
+        source.FailStart = true;
+        scheduler.Update(3, completed);
+        CHECK(scheduler.InFlight() == 0);
+
+        source.FailStart = false;
+        source.FailPoll = true;
+        scheduler.Update(3, completed);
+        CHECK(scheduler.InFlight() == 3);
+        scheduler.Update(3, completed);
+        CHECK(completed.empty());
+        CHECK(scheduler.InFlight() == 3);
+
+        scheduler.Reset();
+        CHECK(scheduler.InFlight() == 0);
+        source.ClearStarted();
+        scheduler.Update(3, completed);
+        CHECK(source.Started.size() == 3 && source.Started[0] == 0);
+    }
+
+    // A lead car 10 m/s slower: the rays hit it at different points, the range
+    // rate converges on -10 m/s and the distance follows the gap
+    {
+        constexpr float dt = 1.0f / 60.0f;
+        constexpr float ownSpeed = 30.0f;
+        constexpr float leadSpeed = 20.0f;
+        float gap = 40.0f;
+
+        FakeRaySource source;
+        // Each ray hits a point of the car up to 0.8 m further back than the closest
+        source.Scene = [&](uint32_t ray) { return hit(ray, 7, gap + 0.1f * static_cast<float>(ray)); };
+        ProbeScheduler scheduler(source, numRays);
+        LeadTracker tracker;
+        std::vector<ProbeResult> completed;
+        float maxDistanceError = 0.0f;
+        for (int frame = 0; frame < 180; ++frame) {
+            gap += (leadSpeed - ownSpeed) * dt;
+            completed.clear();
+            scheduler.Update(3, completed);
+            const LeadTarget& target = tracker.Update(dt, ownSpeed, completed);
+            if (frame >= 60)
+                maxDistanceError = std::max(maxDistanceError, std::abs(target.Distance - gap));
+        }
+        const LeadTarget& target = tracker.Target();
+        CHECK(target.Valid && target.Entity == 7);
+        CHECK_NEAR(target.RangeRate, leadSpeed - ownSpeed, 0.1);
+        CHECK_NEAR(target.Speed, leadSpeed, 0.1);
+        // A result is a frame old when it arrives: 10 m/s over one frame
+        CHECK(maxDistanceError < 0.25f);
+        printf("Closing lead: range rate %.3f m/s, speed %.3f m/s, max distance error %.3f m\n",
+            target.RangeRate, target.Speed, maxDistanceError);
+    }
+
+    // Another vehicle takes over only when it's more than 2 m closer
+    {
+        LeadTracker tracker;
+        tracker.Update(0.1f, 20.0f, { hit(0, 7, 30.0f) });
+        CHECK(tracker.Target().Entity == 7);
+
+        tracker.Update(0.1f, 20.0f, { hit(0, 7, 30.0f), hit(1, 8, 28.5f) });
+        CHECK(tracker.Target().Entity == 7);
+        CHECK_NEAR(tracker.Target().Distance, 30.0f, 0.001);
+
+        // Further away: ignored while the target is tracked
+        tracker.Update(0.1f, 20.0f, { hit(1, 9, 50.0f) });
+        CHECK(tracker.Target().Entity == 7);
+
+        tracker.Update(0.1f, 20.0f, { hit(0, 7, 30.0f), hit(1, 8, 27.5f) });
+        CHECK(tracker.Target().Entity == 8);
+        CHECK_NEAR(tracker.Target().Distance, 27.5f, 0.001);
+        // A new target starts without a range rate
+        CHECK(tracker.Target().RangeRate == 0.0f);
+    }
+
+    // Kept through LostTime (0.5 s) of misses, then dropped
+    {
+        LeadTracker tracker;
+        tracker.Update(0.1f, 20.0f, { hit(0, 7, 30.0f) });
+        const std::vector<ProbeResult> misses = { { 0 }, { 1 } };
+        for (int i = 0; i < 4; ++i)
+            tracker.Update(0.1f, 20.0f, misses);
+        CHECK(tracker.Target().Valid);
+        CHECK_NEAR(tracker.Target().SinceHit, 0.4f, 0.001);
+        CHECK_NEAR(tracker.Target().Distance, 30.0f, 0.001);
+
+        tracker.Update(0.1f, 20.0f, {});
+        tracker.Update(0.1f, 20.0f, {});
+        CHECK(!tracker.Target().Valid);
+        CHECK(tracker.Target().Speed == 0.0f);
+
+        // Anything hit afterwards is a new target
+        tracker.Update(0.1f, 20.0f, { hit(2, 9, 50.0f) });
+        CHECK(tracker.Target().Valid && tracker.Target().Entity == 9);
+    }
+
+    return Check::Result("LeadTrackerTest");
+}
@@ -0,0 +1,135 @@
+// Logger against the open/write/close per line it replaced: lines per second
+// to disk from one and four threads, and how long Write() holds up the caller
+// at a script-like rate of a few lines per frame.
+#include "../Gears/Util/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace std::chrono;
+
+namespace {
+    const fs::path dir = fs::temp_directory_path() / "LoggerBench";
+
+    // The previous Logger::Write: a lock, and the file opened, appended and closed per line.
+    class OldLogger {
+    public:
+        explicit OldLogger(std::string file) : mFile(std::move(file)) {}
+
+        void Write(LogLevel level, const char* fmt, ...) {
+            char buff[1024];
+            va_list args;
+            va_start(args, fmt);
+            vsnprintf(buff, sizeof(buff), fmt, args);
+            va_end(args);
+            write(level, std::string(buff));
+        }
+
+    private:
+        void write(LogLevel, const std::string& text) {
+            std::lock_guard lock(mMutex);
+            std::ofstream logFile(mFile, std::ios_base::out | std::ios_base::app);
+            auto now = system_clock::now();
+            std::time_t timeSec = system_clock::to_time_t(now);
+            std::tm localTime{};
+            localtime_r(&timeSec, &localTime);
+            auto ms = duration_cast<milliseconds>(now.time_since_epoch()).count() % 1000;
+            logFile << "[" <<
+                std::setw(2) << std::setfill('0') << localTime.tm_hour << ":" <<
+                std::setw(2) << std::setfill('0') << localTime.tm_min << ":" <<
+                std::setw(2) << std::setfill('0') << localTime.tm_sec << "." <<
+                std::setw(3) << std::setfill('0') << ms << "] " <<
+                "[ INFO  ] " << text << "\n";
+            logFile.close();
+        }
+
+        std::string mFile;
+        std::mutex mMutex;
+    };
+
+    // Lines until on disk. The ring holds 512 lines, so the new logger is flushed
+    // every batch instead of letting it drop lines.
+    template <typename TLogger, typename TFlush>
+    double linesPerSecond(TLogger& log, TFlush flush, int threads, int lines) {
+        constexpr int batch = 32;
+        auto start = steady_clock::now();
+        std::vector<std::thread> writers;
+        for (int t = 0; t < threads; ++t) {
+            writers.emplace_back([&, t] {
+                for (int i = 0; i < lines / threads; ++i) {
+                    log.Write(INFO, "[Bench] Thread %d line %d, value %.3f", t, i, i * 0.5);
+                    if (i % batch == batch - 1)
+                        flush();
+                }
+            });
+        }
+        for (auto& writer : writers)
+            writer.join();
+        flush();
+        return lines / duration<double>(steady_clock::now() - start).count();
+    }
+
+    // Five lines per 16 ms frame would take minutes, so frames are 1 ms here.
+    template <typename TLogger>
+    void callerLatency(const char* name, TLogger& log) {
+        std::vector<double> us;
+        for (int frame = 0; frame < 400; ++frame) {
+            for (int i = 0; i < 5; ++i) {
+                auto start = steady_clock::now();
+                log.Write(INFO, "[Bench] Frame %d line %d, value %.3f", frame, i, frame * 0.5);
+                us.push_back(duration<double, std::micro>(steady_clock::now() - start).count());
+            }
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+        std::sort(us.begin(), us.end());
+        printf("Write() latency, %-10s p50 %7.2f us, p99 %7.2f us, max %8.1f us\n",
+            name, us[us.size() / 2], us[us.size() * 99 / 100], us.back());
+    }
+}
+
+int main() {
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    constexpr int lines = 100000;
+    for (int threads : { 1, 4 }) {
+        auto log = std::make_unique<Logger>();
+        log->SetFile((dir / "new.log").string());
+        double fresh = linesPerSecond(*log, [&] { log->Flush(); }, threads, lines);
+        // A writer preempted between claiming and filling a slot stalls the drain,
+        // the others can fill the ring meanwhile. Only count what was written.
+        uint64_t dropped = log->Dropped();
+        fresh *= static_cast<double>(lines - dropped) / lines;
+        log->Shutdown();
+
+        OldLogger old((dir / "old.log").string());
+        double previous = linesPerSecond(old, [] {}, threads, lines / 10);
+        printf("Lines/s to disk, %d thread(s): ring %10.0f, open/write/close %9.0f (%.0fx), %llu dropped\n",
+            threads, fresh, previous, fresh / previous, static_cast<unsigned long long>(dropped));
+        fs::remove(dir / "new.log");
+        fs::remove(dir / "old.log");
+    }
+
+    {
+        auto log = std::make_unique<Logger>();
+        log->SetFile((dir / "new.log").string());
+        callerLatency("ring", *log);
+        log->Shutdown();
+        OldLogger old((dir / "old.log").string());
+        callerLatency("old", old);
+    }
+
+    fs::remove_all(dir);
+    return 0;
+}
@@ -0,0 +1,177 @@
+// Logger: lines from several threads all reach the file in per-thread order,
+// a full ring drops and counts lines, long lines keep their place, and lines
+// written while another thread calls Shutdown() aren't lost.
+#include "Check.h"
+#include "../Gears/Util/Logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    const fs::path dir = fs::temp_directory_path() / "LoggerTest";
+
+    std::vector<std::string> readLines(const std::string& file) {
+        std::vector<std::string> lines;
+        std::ifstream in(file);
+        for (std::string line; std::getline(in, line);)
+            lines.push_back(line);
+        return lines;
+    }
+
+    // Text after the "[time] [level] " prefix.
+    std::string message(const std::string& line) {
+        size_t end = line.find("] ", line.find("] ") + 2);
+        return end == std::string::npos ? std::string() : line.substr(end + 2);
+    }
+
+    // Lines from writers "t<thread> <index>": every index once, in order.
+    bool inOrder(const std::vector<std::string>& lines, int threads, int perThread) {
+        std::vector<int> next(threads, 0);
+        for (const auto& line : lines) {
+            int thread, index;
+            if (sscanf(message(line).c_str(), "t%d %d", &thread, &index) != 2)
+                continue;
+            if (thread < 0 || thread >= threads || index != next[thread])
+                return false;
+            ++next[thread];
+        }
+        for (int count : next) {
+            if (count != perThread)
+                return false;
+        }
+        return true;
+    }
+}
+
+int main() {
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    // Several threads, fewer lines than the ring holds
+    {
+        const std::string file = (dir / "threads.log").string();
+        auto log = std::make_unique<Logger>();
+        log->SetFile(file);
+        log->SetMinLevel(DEBUG);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < 120; ++i)
+                    log->Write(INFO, "t%d %d", t, i);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        log->Flush();
+        auto lines = readLines(file);
+        CHECK(log->Dropped() == 0);
+        CHECK(lines.size() == 480);
+        CHECK(log->Written() == 480);
+        CHECK(inOrder(lines, 4, 120));
+        CHECK(lines.empty() || lines[0].find("] [ INFO  ] t") != std::string::npos);
+    }
+
+    // Below the minimum level: not written
+    {
+        const std::string file = (dir / "level.log").string();
+        auto log = std::make_unique<Logger>();
+        log->SetFile(file);
+        log->SetMinLevel(WARN);
+        log->Write(INFO, "skipped");
+        log->Write(ERROR, "kept");
+        log->Flush();
+        auto lines = readLines(file);
+        CHECK(lines.size() == 1 && message(lines[0]) == "kept");
+    }
+
+    // Lines longer than a slot bypass the ring, after what's queued
+    {
+        const std::string file = (dir / "long.log").string();
+        auto log = std::make_unique<Logger>();
+        log->SetFile(file);
+        const std::string longLine(Logger::SlotTextSize + 100, 'x');
+        log->Write(INFO, std::string("first"));
+        log->Write(INFO, longLine);
+        log->Write(INFO, std::string("last"));
+        log->Flush();
+        auto lines = readLines(file);
+        CHECK(lines.size() == 3);
+        if (lines.size() == 3) {
+            CHECK(message(lines[0]) == "first");
+            CHECK(message(lines[1]) == longLine);
+            CHECK(message(lines[2]) == "last");
+        }
+    }
+
+    // Faster than the worker writes: what doesn't fit is dropped and counted
+    {
+        const std::string file = (dir / "full.log").string();
+        auto log = std::make_unique<Logger>();
+        log->SetFile(file);
+        constexpr int count = 20000;
+        for (int i = 0; i < count; ++i)
+            log->Write(INFO, "t0 %d", i);
+        log->Flush();
+        auto lines = readLines(file);
+        size_t kept = 0;
+        for (const auto& line : lines)
+            kept += message(line).rfind("t0 ", 0) == 0;
+        CHECK(kept + log->Dropped() == count);
+        CHECK(lines.size() == log->Written());
+        printf("Full ring: %zu of %d written, %llu dropped\n",
+            kept, count, static_cast<unsigned long long>(log->Dropped()));
+    }
+
+    // Writers racing Shutdown(): every line reaches the file, the ones after it
+    // synchronously. Nothing drains the ring after Shutdown() returns here.
+    {
+        std::mt19937 rng(3);
+        int lost = 0;
+        for (int round = 0; round < 2000; ++round) {
+            const std::string file = (dir / "shutdown.log").string();
+            fs::remove(file);
+            constexpr int threads = 3;
+            constexpr int perThread = 40;
+            uint64_t dropped = 0;
+            {
+                auto log = std::make_unique<Logger>();
+                log->SetFile(file);
+                std::atomic<int> ready = 0;
+                std::vector<std::thread> writers;
+                for (int t = 0; t < threads; ++t) {
+                    writers.emplace_back([&, t] {
+                        ++ready;
+                        for (int i = 0; i < perThread; ++i)
+                            log->Write(INFO, "t%d %d", t, i);
+                    });
+                }
+                while (ready < threads)
+                    std::this_thread::yield();
+                std::this_thread::sleep_for(std::chrono::microseconds(rng() % 200));
+                log->Shutdown();
+                for (auto& writer : writers)
+                    writer.join();
+                dropped = log->Dropped();
+            }
+            size_t lines = 0;
+            for (const auto& line : readLines(file))
+                lines += message(line).rfind('t', 0) == 0;
+            lost += lines + dropped != threads * perThread;
+        }
+        CHECK(lost == 0);
+        printf("Shutdown race: %d of 2000 rounds lost lines\n", lost);
+    }
+
+    fs::remove_all(dir);
+    return Check::Result("LoggerTest");
+}
@@ -0,0 +1,111 @@
+// Time per call of the scalar and SSE matrix kernels, and of the bone rotation
+// they replaced (Scaling * RotationAxis * original as two full multiplies).
+#include "../Gears/Memory/MatrixKernels.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    using namespace MatrixKernels;
+    using Clock = std::chrono::steady_clock;
+
+    constexpr size_t count = 1024;
+    constexpr int rounds = 2000;
+
+    // Keeps the results alive so the loops aren't optimised away
+    volatile float sink;
+
+    template <typename Fn>
+    void run(const char* name, Fn fn) {
+        fn(); // warm up
+        auto start = Clock::now();
+        for (int i = 0; i < rounds; ++i)
+            fn();
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        printf("%-32s %6.2f ns\n", name, ns / (static_cast<double>(rounds) * count));
+    }
+
+    void toMatrix(const Rotation3x3& rot, float* m) {
+        for (int i = 0; i < 16; ++i)
+            m[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                m[4 * i + j] = rot.M[i][j];
+    }
+}
+
+int main() {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> in(16 * count), out(16 * count);
+    for (auto& v : in)
+        v = dist(rng);
+
+    Rotation3x3 rot = Rotation(0.0f, 0.6f, 0.8f, 0.3f);
+    float rotation[16];
+    float identity[16];
+    toMatrix(rot, rotation);
+    toMatrix(Rotation(0.0f, 0.0f, 1.0f, 0.0f), identity);
+
+    printf("ns per matrix, %zu matrices x %d rounds\n", count, rounds);
+
+    run("Rotation", [&] {
+        float sum = 0.0f;
+        for (size_t i = 0; i < count; ++i)
+            sum += Rotation(0.0f, 0.6f, 0.8f, in[i]).M[0][1];
+        sink = sum;
+    });
+
+    run("Scalar Multiply", [&] {
+        for (size_t i = 0; i < count; ++i)
+            Scalar::Multiply(&in[16 * i], rotation, &out[16 * i]);
+        sink = out[5];
+    });
+    run("Scalar old bone rotation", [&] {
+        float temp[16];
+        for (size_t i = 0; i < count; ++i) {
+            Scalar::Multiply(identity, rotation, temp);
+            Scalar::Multiply(temp, &in[16 * i], &out[16 * i]);
+        }
+        sink = out[5];
+    });
+    run("Scalar RotateApply", [&] {
+        for (size_t i = 0; i < count; ++i)
+            Scalar::RotateApply(rot, &in[16 * i], &out[16 * i]);
+        sink = out[5];
+    });
+    run("Scalar ScaleApply", [&] {
+        for (size_t i = 0; i < count; ++i)
+            Scalar::ScaleApply(1.1f, 0.9f, 1.0f, &in[16 * i], &out[16 * i]);
+        sink = out[5];
+    });
+
+#if NATIVE_MATRIX_SIMD
+    run("SSE Multiply", [&] {
+        for (size_t i = 0; i < count; ++i)
+            Sse::Multiply(&in[16 * i], rotation, &out[16 * i]);
+        sink = out[5];
+    });
+    run("SSE old bone rotation", [&] {
+        float temp[16];
+        for (size_t i = 0; i < count; ++i) {
+            Sse::Multiply(identity, rotation, temp);
+            Sse::Multiply(temp, &in[16 * i], &out[16 * i]);
+        }
+        sink = out[5];
+    });
+    run("SSE RotateApply", [&] {
+        for (size_t i = 0; i < count; ++i)
+            Sse::RotateApply(rot, &in[16 * i], &out[16 * i]);
+        sink = out[5];
+    });
+    run("SSE ScaleApply", [&] {
+        for (size_t i = 0; i < count; ++i)
+            Sse::ScaleApply(1.1f, 0.9f, 1.0f, &in[16 * i], &out[16 * i]);
+        sink = out[5];
+    });
+#endif
+    return 0;
+}
@@ -0,0 +1,159 @@
+// MatrixKernels: the scalar kernels against a double precision reference, and
+// the SSE kernels against the scalar ones, including aliased calls.
+#include "Check.h"
+#include "../Gears/Memory/MatrixKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace {
+    using namespace MatrixKernels;
+
+    std::mt19937 rng(1234);
+
+    void randomMatrix(float* m) {
+        std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+        for (int i = 0; i < 16; ++i)
+            m[i] = dist(rng);
+    }
+
+    Rotation3x3 randomRotation() {
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        float x = dist(rng), y = dist(rng), z = dist(rng);
+        float length = std::sqrt(x * x + y * y + z * z);
+        if (length < 1e-3f)
+            return Rotation(0.0f, 0.0f, 1.0f, 0.5f);
+        return Rotation(x / length, y / length, z / length, dist(rng) * 3.14159f);
+    }
+
+    // Largest difference, relative to the largest element of the expected result
+    float relativeError(const float* expected, const float* actual) {
+        float scale = 1.0f;
+        float error = 0.0f;
+        for (int i = 0; i < 16; ++i) {
+            scale = std::max(scale, std::abs(expected[i]));
+            error = std::max(error, std::abs(expected[i] - actual[i]));
+        }
+        return error / scale;
+    }
+
+    void referenceMultiply(const float* l, const float* r, float* out) {
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                double sum = 0.0;
+                for (int k = 0; k < 4; ++k)
+                    sum += static_cast<double>(l[4 * i + k]) * r[4 * k + j];
+                out[4 * i + j] = static_cast<float>(sum);
+            }
+        }
+    }
+
+    void rotationMatrix(const Rotation3x3& rot, float* m) {
+        const float identity[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+        memcpy(m, identity, sizeof(identity));
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                m[4 * i + j] = rot.M[i][j];
+    }
+
+    float checkScalar(int cases) {
+        float worst = 0.0f;
+        for (int n = 0; n < cases; ++n) {
+            float l[16], r[16], expected[16], out[16];
+            randomMatrix(l);
+            randomMatrix(r);
+            referenceMultiply(l, r, expected);
+            Scalar::Multiply(l, r, out);
+            worst = std::max(worst, relativeError(expected, out));
+
+            // RotateApply is Multiply with the rotation as a full matrix
+            Rotation3x3 rot = randomRotation();
+            float rotation[16];
+            rotationMatrix(rot, rotation);
+            referenceMultiply(rotation, r, expected);
+            Scalar::RotateApply(rot, r, out);
+            worst = std::max(worst, relativeError(expected, out));
+
+            // ScaleApply is Multiply with a diagonal matrix
+            float scaling[16] = {};
+            scaling[0] = l[0] / 10.0f;
+            scaling[5] = l[1] / 10.0f;
+            scaling[10] = l[2] / 10.0f;
+            scaling[15] = 1.0f;
+            referenceMultiply(scaling, r, expected);
+            Scalar::ScaleApply(scaling[0], scaling[5], scaling[10], r, out);
+            worst = std::max(worst, relativeError(expected, out));
+        }
+        return worst;
+    }
+
+#if NATIVE_MATRIX_SIMD
+    float checkSse(int cases) {
+        float worst = 0.0f;
+        for (int n = 0; n < cases; ++n) {
+            float l[16], r[16], expected[16], out[16];
+            randomMatrix(l);
+            randomMatrix(r);
+            Scalar::Multiply(l, r, expected);
+            Sse::Multiply(l, r, out);
+            worst = std::max(worst, relativeError(expected, out));
+
+            // out aliasing l
+            memcpy(out, l, sizeof(l));
+            Sse::Multiply(out, r, out);
+            worst = std::max(worst, relativeError(expected, out));
+
+            Rotation3x3 rot = randomRotation();
+            Scalar::RotateApply(rot, r, expected);
+            Sse::RotateApply(rot, r, out);
+            worst = std::max(worst, relativeError(expected, out));
+
+            // out aliasing o
+            memcpy(out, r, sizeof(r));
+            Sse::RotateApply(rot, out, out);
+            worst = std::max(worst, relativeError(expected, out));
+
+            Scalar::ScaleApply(l[0], l[1], l[2], r, expected);
+            Sse::ScaleApply(l[0], l[1], l[2], r, out);
+            // Same single multiply per element, so exactly the same
+            CHECK(memcmp(expected, out, sizeof(out)) == 0);
+        }
+        return worst;
+    }
+#endif
+}
+
+int main() {
+    constexpr int cases = 100000;
+
+    // Scalar Multiply aliasing l
+    float l[16], r[16], expected[16];
+    randomMatrix(l);
+    randomMatrix(r);
+    Scalar::Multiply(l, r, expected);
+    Scalar::Multiply(l, r, l);
+    CHECK(memcmp(expected, l, sizeof(l)) == 0);
+
+    // Rotation about z by 90 degrees takes x to y, row-vector convention
+    Rotation3x3 quarter = Rotation(0.0f, 0.0f, 1.0f, 3.14159265f / 2.0f);
+    CHECK_NEAR(quarter.M[0][0], 0.0, 1e-6);
+    CHECK_NEAR(quarter.M[0][1], 1.0, 1e-6);
+    CHECK_NEAR(quarter.M[1][0], -1.0, 1e-6);
+    CHECK_NEAR(quarter.M[2][2], 1.0, 1e-6);
+
+    float scalarError = checkScalar(cases);
+    CHECK(scalarError < 1e-5f);
+    printf("Scalar vs double reference: largest relative error %.2g over %d cases\n", scalarError, cases);
+
+#if NATIVE_MATRIX_SIMD
+    float sseError = checkSse(cases);
+    CHECK(sseError < 1e-5f);
+    printf("SSE vs scalar: largest relative error %.2g over %d cases\n", sseError, cases);
+#else
+    printf("Built without SSE (MT_NO_SIMD or not x86), only the scalar kernels were checked\n");
+#endif
+
+    return Check::Result("MatrixKernelsTest");
+}
@@ -0,0 +1,113 @@
+// Time per vehicle of the wheel transforms done with NativeMatrix, and of the
+// Euler angle math GetWheelCoords used before. Only the math: the natives each
+// version calls run in the game and aren't timed here.
+#include "../Gears/Memory/NativeMatrix.h"
+#include "../Gears/Util/MathExt.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+    // MathExt's Vector3T operators also match time_point, so time in plain numbers.
+    double nowNs() {
+        return std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    constexpr size_t vehicles = 1024;
+    constexpr int rounds = 500;
+
+    volatile float sink;
+
+    template <typename Fn>
+    void run(const char* name, Fn fn) {
+        fn();
+        double start = nowNs();
+        for (int i = 0; i < rounds; ++i)
+            fn();
+        double ns = nowNs() - start;
+        printf("%-40s %7.2f ns\n", name, ns / (static_cast<double>(rounds) * vehicles));
+    }
+
+    struct Pose {
+        Vector3 Position;
+        Vector3 Rotation; // Radians
+        Vector3 Right;
+        Vector3 Forward;
+        Vector3 Up;
+    };
+}
+
+int main() {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> angle(-0.3f, 0.3f);
+    std::uniform_real_distribution<float> heading(-3.1f, 3.1f);
+    std::uniform_real_distribution<float> coord(-4000.0f, 4000.0f);
+
+    std::vector<Pose> poses(vehicles);
+    for (auto& pose : poses) {
+        pose.Position = { coord(rng), coord(rng), coord(rng) / 10.0f };
+        pose.Rotation = { angle(rng), angle(rng), heading(rng) };
+        NativeMatrix4x4 r = RotationAxis({ 0.0f, 1.0f, 0.0f }, pose.Rotation.y) *
+            RotationAxis({ 1.0f, 0.0f, 0.0f }, pose.Rotation.x) *
+            RotationAxis({ 0.0f, 0.0f, 1.0f }, pose.Rotation.z);
+        pose.Right = { r.M11, r.M12, r.M13 };
+        pose.Forward = { r.M21, r.M22, r.M23 };
+        pose.Up = { r.M31, r.M32, r.M33 };
+    }
+    const std::vector<Vector3> wheels = {
+        { -0.8f, 1.4f, -0.3f }, { 0.8f, 1.4f, -0.3f }, { -0.8f, -1.3f, -0.3f }, { 0.8f, -1.3f, -0.3f },
+    };
+
+    printf("ns per vehicle (4 wheels), %zu vehicles x %d rounds\n", vehicles, rounds);
+
+    run("Wheel coords, GetOffsetInWorldCoords", [&] {
+        float sum = 0.0f;
+        for (const auto& pose : poses) {
+            for (const auto& wheel : wheels)
+                sum += GetOffsetInWorldCoords(pose.Position, pose.Rotation, pose.Forward, wheel).x;
+        }
+        sink = sum;
+    });
+
+    run("Wheel coords, TransformPoints", [&] {
+        float sum = 0.0f;
+        for (const auto& pose : poses) {
+            auto world = TransformPoints(EntityMatrix(pose.Right, pose.Forward, pose.Up, pose.Position), wheels);
+            sum += world[0].x;
+        }
+        sink = sum;
+    });
+
+    // Same math without the vector TransformPoints returns
+    run("Wheel coords, TransformPoint per wheel", [&] {
+        float sum = 0.0f;
+        for (const auto& pose : poses) {
+            auto matrix = EntityMatrix(pose.Right, pose.Forward, pose.Up, pose.Position);
+            for (const auto& wheel : wheels)
+                sum += TransformPoint(matrix, wheel).x;
+        }
+        sink = sum;
+    });
+
+    run("InvertAffine", [&] {
+        float sum = 0.0f;
+        for (const auto& pose : poses)
+            sum += InvertAffine(EntityMatrix(pose.Right, pose.Forward, pose.Up, pose.Position)).M41;
+        sink = sum;
+    });
+
+    // What slip and TCS do per tick: two velocities per wheel to local space
+    run("InvertAffine + 2x TransformDirections", [&] {
+        float sum = 0.0f;
+        for (const auto& pose : poses) {
+            auto worldToLocal = InvertAffine(EntityMatrix(pose.Right, pose.Forward, pose.Up, pose.Position));
+            sum += TransformDirections(worldToLocal, wheels)[0].y;
+            sum += TransformDirections(worldToLocal, wheels)[1].y;
+        }
+        sink = sum;
+    });
+    return 0;
+}
@@ -0,0 +1,115 @@
+// NativeMatrix helpers: the entity matrix layout against a known transform,
+// InvertAffine and the point/direction transforms.
+#include "Check.h"
+#include "../Gears/Memory/NativeMatrix.h"
+#include "../Gears/Util/MathExt.h"
+
+#include <random>
+
+namespace {
+    constexpr double eps = 1e-4;
+
+    void checkNear(Vector3 actual, Vector3 expected) {
+        CHECK_NEAR(actual.x, expected.x, eps);
+        CHECK_NEAR(actual.y, expected.y, eps);
+        CHECK_NEAR(actual.z, expected.z, eps);
+    }
+
+    // GET_ENTITY_MATRIX of an entity at position with a heading, level.
+    // Heading 0 faces +y, positive headings turn left. right = forward x up.
+    NativeMatrix4x4 levelEntity(float headingDeg, Vector3 position) {
+        float h = deg2rad(headingDeg);
+        Vector3 forward{ -sinf(h), cosf(h), 0.0f };
+        Vector3 up{ 0.0f, 0.0f, 1.0f };
+        Vector3 right = Cross(forward, up);
+        return EntityMatrix(right, forward, up, position);
+    }
+
+    // Random orientation and position
+    NativeMatrix4x4 randomEntity(std::mt19937& rng) {
+        std::uniform_real_distribution<float> angle(-3.1f, 3.1f);
+        std::uniform_real_distribution<float> coord(-4000.0f, 4000.0f);
+
+        NativeMatrix4x4 rotation = RotationAxis({ 0.0f, 1.0f, 0.0f }, angle(rng)) *
+            RotationAxis({ 1.0f, 0.0f, 0.0f }, angle(rng)) *
+            RotationAxis({ 0.0f, 0.0f, 1.0f }, angle(rng));
+        rotation.M41 = coord(rng);
+        rotation.M42 = coord(rng);
+        rotation.M43 = coord(rng) / 10.0f;
+        return rotation;
+    }
+}
+
+int main() {
+    // Known transform: at (10, 20, 30), heading 90, so facing -x with its right side to +y.
+    Vector3 position{ 10.0f, 20.0f, 30.0f };
+    NativeMatrix4x4 entity = levelEntity(90.0f, position);
+
+    // Rows are right, forward, up, position
+    checkNear({ entity.M11, entity.M12, entity.M13 }, { 0.0f, 1.0f, 0.0f });
+    checkNear({ entity.M21, entity.M22, entity.M23 }, { -1.0f, 0.0f, 0.0f });
+    checkNear({ entity.M31, entity.M32, entity.M33 }, { 0.0f, 0.0f, 1.0f });
+    checkNear({ entity.M41, entity.M42, entity.M43 }, position);
+    CHECK(entity.M14 == 0.0f && entity.M24 == 0.0f && entity.M34 == 0.0f && entity.M44 == 1.0f);
+
+    // A metre right, ahead and up of the entity in world space
+    checkNear(TransformPoint(entity, { 1.0f, 0.0f, 0.0f }), { 10.0f, 21.0f, 30.0f });
+    checkNear(TransformPoint(entity, { 0.0f, 1.0f, 0.0f }), { 9.0f, 20.0f, 30.0f });
+    checkNear(TransformPoint(entity, { 0.0f, 0.0f, 1.0f }), { 10.0f, 20.0f, 31.0f });
+    // Directions aren't translated
+    checkNear(TransformDirection(entity, { 0.0f, 2.0f, 0.0f }), { -2.0f, 0.0f, 0.0f });
+
+    // Same as a rotation about z by the heading, then the translation
+    NativeMatrix4x4 expected = RotationAxis({ 0.0f, 0.0f, 1.0f }, deg2rad(90.0f));
+    for (int i = 0; i < 12; ++i)
+        CHECK_NEAR((&entity.M11)[i], (&expected.M11)[i], eps);
+
+    // The world to local inverse takes the points back
+    NativeMatrix4x4 worldToLocal = InvertAffine(entity);
+    checkNear(TransformPoint(worldToLocal, { 9.0f, 20.0f, 30.0f }), { 0.0f, 1.0f, 0.0f });
+    checkNear(TransformDirection(worldToLocal, { -2.0f, 0.0f, 0.0f }), { 0.0f, 2.0f, 0.0f });
+
+    // Agrees with GetOffsetInWorldCoords, which wheel coords used before
+    for (float heading : { 0.0f, 37.0f, 90.0f, 180.0f, -135.0f }) {
+        NativeMatrix4x4 m = levelEntity(heading, position);
+        Vector3 forward{ m.M21, m.M22, m.M23 };
+        Vector3 rotation{ 0.0f, 0.0f, deg2rad(heading) };
+        Vector3 wheel{ -0.8f, 1.4f, -0.3f };
+        checkNear(TransformPoint(m, wheel), GetOffsetInWorldCoords(position, rotation, forward, wheel));
+    }
+
+    // Any orientation: inverse round trips, and the batch versions match the single ones
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> local(-3.0f, 3.0f);
+    for (int n = 0; n < 10000; ++n) {
+        NativeMatrix4x4 m = randomEntity(rng);
+        NativeMatrix4x4 inverse = InvertAffine(m);
+        NativeMatrix4x4 identity = m * inverse;
+        for (int i = 0; i < 16; ++i)
+            CHECK_NEAR((&identity.M11)[i], (i % 5 == 0) ? 1.0 : 0.0, 1e-3);
+
+        std::vector<Vector3> points(4);
+        for (auto& p : points)
+            p = { local(rng), local(rng), local(rng) };
+        auto world = TransformPoints(m, points);
+        auto back = TransformPoints(inverse, world);
+        auto directions = TransformDirections(m, points);
+        for (size_t i = 0; i < points.size(); ++i) {
+            checkNear(world[i], TransformPoint(m, points[i]));
+            CHECK_NEAR(back[i].x, points[i].x, 2e-3);
+            CHECK_NEAR(back[i].y, points[i].y, 2e-3);
+            CHECK_NEAR(back[i].z, points[i].z, 2e-3);
+            checkNear(directions[i], TransformDirection(m, points[i]));
+            // Rotation only, so lengths stay
+            CHECK_NEAR(Length(directions[i]), Length(points[i]), eps);
+        }
+    }
+
+    // Singular matrices fall back to identity instead of dividing by 0
+    NativeMatrix4x4 flat = Scaling({ 1.0f, 1.0f, 0.0f });
+    NativeMatrix4x4 fallback = InvertAffine(flat);
+    for (int i = 0; i < 16; ++i)
+        CHECK((&fallback.M11)[i] == ((i % 5 == 0) ? 1.0f : 0.0f));
+
+    return Check::Result("NativeMatrixTest");
+}
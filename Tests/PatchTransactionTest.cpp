@@ -0,0 +1,268 @@
+// PatchTransaction against a fake memory with per-page protection and against
+// an mprotect'd buffer: writes, rollback, pages with different protections being
+// restored to their own, and PatchAll's attempt limit.
+#include "Check.h"
+#include "../Gears/Memory/MemoryPatcher.hpp"
+#include "../Gears/Memory/PatchTransaction.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+using namespace MemoryPatcher;
+
+namespace {
+    constexpr uint32_t ReadOnly = 1;
+    constexpr uint32_t ReadWrite = 3;
+    constexpr uint32_t ReadExecute = 5;
+    constexpr uint32_t ReadWriteExecute = 7;
+
+    // Pages of a buffer, each with its own protection. Unprotect and Protect change
+    // every page in the range, and Unprotect reports the first one, like VirtualProtect.
+    class FakeMemory : public MemoryAccess {
+    public:
+        static constexpr size_t Page = 4096;
+
+        explicit FakeMemory(std::vector<uint32_t> protections)
+            : Protections(std::move(protections)), mData(Protections.size() * Page + Page) {
+            mBase = (reinterpret_cast<uintptr_t>(mData.data()) + Page - 1) & ~(Page - 1);
+            for (size_t i = 0; i < Protections.size() * Page; ++i)
+                byteAt(i) = static_cast<uint8_t>(i);
+        }
+
+        size_t PageSize() const override { return Page; }
+
+        bool Query(uintptr_t address, uint32_t& protection, size_t& size) const override {
+            if (FailQuery)
+                return false;
+            size_t page = pageOf(address);
+            size_t last = page;
+            while (last + 1 < Protections.size() && Protections[last + 1] == Protections[page])
+                ++last;
+            protection = Protections[page];
+            size = Base() + (last + 1) * Page - address;
+            return true;
+        }
+
+        bool Unprotect(uintptr_t address, size_t size, uint32_t& oldProtection) override {
+            ++UnprotectCalls;
+            if (FailUnprotect-- == 0)
+                return false;
+            oldProtection = Protections[pageOf(address)];
+            setProtection(address, size, ReadWriteExecute);
+            return true;
+        }
+
+        bool Protect(uintptr_t address, size_t size, uint32_t protection) override {
+            setProtection(address, size, protection);
+            return true;
+        }
+
+        bool Write(uintptr_t address, const uint8_t* data, size_t size) override {
+            if (FailWrite-- == 0)
+                return false;
+            for (size_t i = 0; i < size; ++i) {
+                if (!(Protections[pageOf(address + i)] & 2))
+                    return false;
+            }
+            memcpy(reinterpret_cast<void*>(address), data, size);
+            return true;
+        }
+
+        void Read(uintptr_t address, uint8_t* data, size_t size) const override {
+            memcpy(data, reinterpret_cast<const void*>(address), size);
+        }
+
+        uintptr_t Base() const { return mBase; }
+        uint8_t& byteAt(size_t offset) { return *reinterpret_cast<uint8_t*>(mBase + offset); }
+
+        std::vector<uint32_t> Protections;
+        int FailUnprotect = -1;
+        int FailWrite = -1;
+        bool FailQuery = false;
+        int UnprotectCalls = 0;
+
+    private:
+        size_t pageOf(uintptr_t address) const { return (address - mBase) / Page; }
+
+        void setProtection(uintptr_t address, size_t size, uint32_t protection) {
+            for (size_t page = pageOf(address); page <= pageOf(address + size - 1); ++page)
+                Protections[page] = protection;
+        }
+
+        std::vector<uint8_t> mData;
+        uintptr_t mBase = 0;
+    };
+
+    const std::vector<uint8_t> nops = { 0x90, 0x90, 0x90, 0x90 };
+
+    // One write in each of the pages, and one across the boundary of the last two
+    void addWrites(PatchTransaction& transaction, const FakeMemory& memory, size_t pages) {
+        for (size_t page = 0; page < pages; ++page)
+            transaction.Add(memory.Base() + page * FakeMemory::Page + 100, nops);
+        transaction.Add(memory.Base() + (pages - 1) * FakeMemory::Page - 2, nops);
+    }
+
+    bool written(FakeMemory& memory, size_t offset) {
+        return memcmp(&memory.byteAt(offset), nops.data(), nops.size()) == 0;
+    }
+}
+
+// Util/Strings.cpp needs Windows, and this is only for verbose patcher logs.
+std::string ByteArrayToString(uint8_t*, size_t) { return {}; }
+
+// PatchAll resolves patterns through this. Patterns here are the address as text.
+uintptr_t mem::FindPattern(const char* pattern, const char*) {
+    return static_cast<uintptr_t>(strtoull(pattern, nullptr, 16));
+}
+
+int main() {
+    // Adjacent pages with different protections: one Unprotect per protection,
+    // and every page gets its own protection back
+    {
+        const std::vector<uint32_t> before = { ReadExecute, ReadOnly, ReadOnly, ReadExecute, ReadWrite };
+        FakeMemory memory(before);
+        PatchTransaction transaction(memory);
+        addWrites(transaction, memory, before.size());
+        CHECK(transaction.Commit());
+        CHECK(memory.Protections == before);
+        CHECK(memory.UnprotectCalls == 4);
+        CHECK(transaction.Stats().Pages == 5);
+        CHECK(transaction.Stats().ProtectCalls == 8);
+        for (size_t page = 0; page < before.size(); ++page)
+            CHECK(written(memory, page * FakeMemory::Page + 100));
+        CHECK(written(memory, 4 * FakeMemory::Page - 2));
+        // Originals are the bytes before the write
+        CHECK(transaction.Original(1)[0] == static_cast<uint8_t>(FakeMemory::Page + 100));
+    }
+
+    // Same protection everywhere: one run, one Unprotect
+    {
+        FakeMemory memory({ ReadExecute, ReadExecute, ReadExecute });
+        PatchTransaction transaction(memory);
+        addWrites(transaction, memory, 3);
+        CHECK(transaction.Commit());
+        CHECK(memory.UnprotectCalls == 1);
+        CHECK(memory.Protections == std::vector<uint32_t>(3, ReadExecute));
+    }
+
+    // A page that can't be unprotected: nothing written, earlier pages restored
+    {
+        const std::vector<uint32_t> before = { ReadExecute, ReadOnly, ReadExecute };
+        FakeMemory memory(before);
+        memory.FailUnprotect = 1;
+        PatchTransaction transaction(memory);
+        addWrites(transaction, memory, before.size());
+        CHECK(!transaction.Commit());
+        CHECK(memory.Protections == before);
+        for (size_t page = 0; page < before.size(); ++page)
+            CHECK(!written(memory, page * FakeMemory::Page + 100));
+    }
+
+    // A failed write rolls back the earlier ones
+    {
+        const std::vector<uint32_t> before = { ReadExecute, ReadOnly, ReadExecute };
+        FakeMemory memory(before);
+        memory.FailWrite = 2;
+        PatchTransaction transaction(memory);
+        addWrites(transaction, memory, before.size());
+        CHECK(!transaction.Commit());
+        CHECK(transaction.Stats().RolledBack);
+        CHECK(memory.Protections == before);
+        for (size_t page = 0; page < before.size(); ++page)
+            CHECK(!written(memory, page * FakeMemory::Page + 100));
+    }
+
+    // A page that can't be queried, or overlapping writes: nothing is touched
+    {
+        FakeMemory memory({ ReadExecute, ReadOnly });
+        memory.FailQuery = true;
+        PatchTransaction transaction(memory);
+        addWrites(transaction, memory, 2);
+        CHECK(!transaction.Commit());
+        CHECK(memory.UnprotectCalls == 0);
+
+        PatchTransaction overlapping(memory);
+        overlapping.Add(memory.Base() + 10, nops);
+        overlapping.Add(memory.Base() + 12, nops);
+        CHECK(!overlapping.Commit());
+        CHECK(memory.UnprotectCalls == 0);
+    }
+
+#ifndef _WIN32
+    // The process memory: pages mapped read+exec, read-only and read+exec, patched
+    // in one transaction, keep those protections
+    {
+        MemoryAccess& memory = ProcessMemory();
+        const size_t page = memory.PageSize();
+        auto* buffer = static_cast<uint8_t*>(mmap(nullptr, 3 * page, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        CHECK(buffer != MAP_FAILED);
+        auto base = reinterpret_cast<uintptr_t>(buffer);
+        mprotect(buffer, page, PROT_READ | PROT_EXEC);
+        mprotect(buffer + page, page, PROT_READ);
+        mprotect(buffer + 2 * page, page, PROT_READ | PROT_EXEC);
+
+        PatchTransaction transaction(memory);
+        for (size_t i = 0; i < 3; ++i)
+            transaction.Add(base + i * page + 8, nops);
+        CHECK(transaction.Commit());
+
+        const uint32_t expected[] = { PROT_READ | PROT_EXEC, PROT_READ, PROT_READ | PROT_EXEC };
+        for (size_t i = 0; i < 3; ++i) {
+            uint32_t protection = 0;
+            size_t size = 0;
+            CHECK(memory.Query(base + i * page, protection, size));
+            CHECK(protection == expected[i]);
+            CHECK(size >= page);
+            CHECK(memcmp(buffer + i * page + 8, nops.data(), nops.size()) == 0);
+        }
+        munmap(buffer, 3 * page);
+    }
+#endif
+
+    // PatchAll: a failed batch counts against every patcher in it, and once over
+    // the limit the batch isn't tried again
+    {
+        FakeMemory memory({ ReadExecute, ReadExecute });
+        char addressA[32], addressB[32];
+        snprintf(addressA, sizeof(addressA), "%llx", static_cast<unsigned long long>(memory.Base() + 16));
+        snprintf(addressB, sizeof(addressB), "%llx", static_cast<unsigned long long>(memory.Base() + FakeMemory::Page + 16));
+        PatternInfo patternA(addressA, "", std::vector<uint8_t>(4));
+        PatternInfo patternB(addressB, "", std::vector<uint8_t>(4));
+        Patcher a("A", patternA);
+        Patcher b("B", patternB);
+        const std::vector<Patcher*> batch = { &a, &b };
+
+        int tries = 0;
+        for (; tries < 10; ++tries) {
+            int callsBefore = memory.UnprotectCalls;
+            memory.FailUnprotect = 0;
+            CHECK(!PatchAll(batch, memory));
+            if (memory.UnprotectCalls == callsBefore)
+                break;
+        }
+        CHECK(tries == 5);
+        CHECK(a.AttemptsExceeded() && b.AttemptsExceeded());
+        CHECK(!a.Patched() && !b.Patched());
+
+        // A successful batch resets the count
+        Patcher c("C", patternA);
+        Patcher d("D", patternB);
+        memory.FailUnprotect = 0;
+        CHECK(!PatchAll({ &c, &d }, memory));
+        CHECK(PatchAll({ &c, &d }, memory));
+        CHECK(c.Patched() && d.Patched());
+        CHECK(written(memory, 16) && written(memory, FakeMemory::Page + 16));
+        CHECK(RestoreAll({ &c, &d }, memory));
+        CHECK(!written(memory, 16));
+        CHECK(memory.Protections == std::vector<uint32_t>(2, ReadExecute));
+    }
+
+    return Check::Result("PatchTransactionTest");
+}
@@ -0,0 +1,253 @@
+// Runs Scheduler::Task with simulated frame times: fixed frame rates from 20 to
+// 240 FPS, jittery frames and hitches, at the rates the script uses. Also the CPU
+// time and output of a model stepped by a task against one stepped every frame.
+#include "Check.h"
+#include "../Gears/Util/Scheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <random>
+#include <vector>
+
+namespace {
+    struct Run {
+        uint64_t Steps = 0;
+        double Elapsed = 0.0;
+        uint32_t MaxSteps = 0;
+        float Filter = 0.0f;
+        bool AlphaInRange = true;
+    };
+
+    // A first order filter stepped like the integrators in the script, toward 1.
+    void stepFilter(float& value, float dt) {
+        value += (1.0f - value) * std::min(1.0f, 2.0f * dt);
+    }
+
+    Run simulate(float rateHz, const std::vector<float>& frames) {
+        Scheduler::Task task("Test", rateHz);
+        Run run;
+        for (float frameTime : frames) {
+            uint32_t steps = task.Advance(frameTime);
+            run.Steps += steps;
+            run.Elapsed += task.Elapsed();
+            run.MaxSteps = std::max(run.MaxSteps, steps);
+            for (uint32_t i = 0; i < steps; ++i)
+                stepFilter(run.Filter, task.Dt());
+            float alpha = task.Alpha();
+            run.AlphaInRange = run.AlphaInRange && alpha >= 0.0f && alpha <= 1.0f;
+        }
+        return run;
+    }
+
+    std::vector<float> fixedFrames(float fps, float seconds) {
+        return std::vector<float>(static_cast<size_t>(fps * seconds), 1.0f / fps);
+    }
+
+    std::vector<float> jitteryFrames(float seconds, std::mt19937& rng) {
+        // 4 to 40 ms, like an unlocked frame rate in traffic
+        std::uniform_real_distribution<float> frameTime(0.004f, 0.040f);
+        std::vector<float> frames;
+        float total = 0.0f;
+        while (total < seconds) {
+            frames.push_back(frameTime(rng));
+            total += frames.back();
+        }
+        return frames;
+    }
+
+    double total(const std::vector<float>& frames) {
+        double sum = 0.0;
+        for (float f : frames)
+            sum += f;
+        return sum;
+    }
+
+    // Stand-in for a drivetrain step: RPM chasing a torque curve target, stiff
+    // enough that a 30 FPS frame time is a large step. A few us per step.
+    struct Drivetrain {
+        float Rpm = 800.0f;
+
+        void Step(float throttle, float dt) {
+            float torque = 0.0f;
+            for (int i = 0; i < 64; ++i) {
+                float x = static_cast<float>(i) / 64.0f;
+                torque += std::sin(x * 3.0f + Rpm * 1e-4f) * std::exp(-x);
+            }
+            float target = 800.0f + throttle * 6000.0f * (0.5f + torque / 64.0f);
+            Rpm += (target - Rpm) * std::min(1.0f, 15.0f * dt);
+        }
+    };
+
+    // Throttle changes every 0.5 s, read once per frame like the controls.
+    float throttleAt(double time) {
+        return static_cast<int>(time / 0.5 + 1e-6) % 2 ? 1.0f : 0.2f;
+    }
+
+    // A frame starts on every multiple of this at all the simulated frame rates.
+    constexpr double sampleInterval = 1.0 / 6.0;
+
+    struct ModelRun {
+        double CpuUsPerSecond = 0.0;
+        std::vector<float> Samples; // Rpm every sampleInterval
+    };
+
+    // rateHz 0 steps once per frame with the frame time.
+    ModelRun runModel(float rateHz, float fps, float seconds) {
+        Scheduler::Task task("Model", rateHz);
+        Drivetrain model;
+        ModelRun run;
+        const auto frames = fixedFrames(fps, seconds);
+        const size_t framesPerSample = static_cast<size_t>(std::lround(fps * sampleInterval));
+        std::clock_t start = std::clock();
+        for (size_t frame = 0; frame < frames.size(); ++frame) {
+            float throttle = throttleAt(static_cast<double>(frame) / fps);
+            uint32_t steps = task.Advance(frames[frame]);
+            for (uint32_t i = 0; i < steps; ++i)
+                model.Step(throttle, task.Dt());
+            if ((frame + 1) % framesPerSample == 0)
+                run.Samples.push_back(model.Rpm);
+        }
+        run.CpuUsPerSecond = 1e6 * static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC / seconds;
+        return run;
+    }
+
+    float maxDivergence(const ModelRun& run, const ModelRun& reference) {
+        float divergence = 0.0f;
+        size_t samples = std::min(run.Samples.size(), reference.Samples.size());
+        for (size_t i = 0; i < samples; ++i)
+            divergence = std::max(divergence, std::abs(run.Samples[i] - reference.Samples[i]));
+        return divergence;
+    }
+}
+
+int main() {
+    const float rates[] = { 120.0f, 60.0f, 10.0f, 5.0f };
+    const float fpsList[] = { 30.0f, 60.0f, 144.0f, 240.0f };
+    constexpr float seconds = 60.0f;
+
+    // Fixed frame rates: the task runs at its own rate regardless of FPS
+    for (float rate : rates) {
+        std::vector<float> filters;
+        for (float fps : fpsList) {
+            auto run = simulate(rate, fixedFrames(fps, seconds));
+            double expected = static_cast<double>(rate) * seconds;
+            CHECK_NEAR(static_cast<double>(run.Steps), expected, 2.0);
+            CHECK_NEAR(run.Elapsed, seconds, 2.0 / rate);
+            CHECK(run.AlphaInRange);
+            // Never more steps in a frame than the frame time holds, plus the carried remainder
+            CHECK(run.MaxSteps <= static_cast<uint32_t>(rate / fps) + 1);
+            filters.push_back(run.Filter);
+            printf("%5.0f Hz at %3.0f FPS: %6llu steps (%6.0f expected), max %u per frame\n",
+                rate, fps, static_cast<unsigned long long>(run.Steps), expected, run.MaxSteps);
+        }
+        // Integrators see the same increments at every frame rate
+        for (float filter : filters)
+            CHECK_NEAR(filter, filters.front(), 1e-4);
+    }
+
+    // A model on a 120 Hz task costs the same per simulated second at any frame rate
+    // and follows the 240 FPS run closely. Stepped every frame, it costs more at high
+    // frame rates and diverges at low ones.
+    {
+        constexpr float modelSeconds = 30.0f;
+        const float referenceFps = fpsList[std::size(fpsList) - 1];
+        const ModelRun taskReference = runModel(120.0f, referenceFps, modelSeconds);
+        const ModelRun frameReference = runModel(0.0f, referenceFps, modelSeconds);
+        for (float fps : fpsList) {
+            ModelRun onTask = runModel(120.0f, fps, modelSeconds);
+            ModelRun everyFrame = runModel(0.0f, fps, modelSeconds);
+            float taskDivergence = maxDivergence(onTask, taskReference);
+            float frameDivergence = maxDivergence(everyFrame, frameReference);
+            if (fps < referenceFps)
+                CHECK(taskDivergence < frameDivergence);
+            printf("Model at %3.0f FPS: 120 Hz task %7.1f us CPU/s, %6.1f RPM from %3.0f FPS | "
+                "every frame %7.1f us CPU/s, %6.1f RPM from %3.0f FPS\n",
+                fps, onTask.CpuUsPerSecond, taskDivergence, referenceFps,
+                everyFrame.CpuUsPerSecond, frameDivergence, referenceFps);
+        }
+    }
+
+    // Below rate / MaxStepsPerFrame FPS the task falls behind instead of catching up
+    {
+        auto run = simulate(120.0f, fixedFrames(20.0f, seconds));
+        CHECK(run.MaxSteps == Scheduler::MaxStepsPerFrame);
+        CHECK_NEAR(static_cast<double>(run.Steps), 20.0 * seconds * Scheduler::MaxStepsPerFrame, 1.0);
+    }
+
+    // Jittery frames: no steps lost or gained over a minute
+    std::mt19937 rng(3);
+    for (float rate : rates) {
+        auto frames = jitteryFrames(seconds, rng);
+        auto run = simulate(rate, frames);
+        CHECK_NEAR(static_cast<double>(run.Steps), rate * total(frames), 2.0);
+        CHECK(run.AlphaInRange);
+    }
+
+    // An hour at 144 FPS: the float accumulator doesn't drift
+    {
+        auto frames = fixedFrames(144.0f, 3600.0f);
+        auto run = simulate(120.0f, frames);
+        CHECK_NEAR(static_cast<double>(run.Steps), 120.0 * total(frames), 120.0 * 3600.0 * 1e-4);
+    }
+
+    // A hitch (loading, pause menu) gives MaxStepsPerFrame steps, and carries at most
+    // that many over instead of seconds of them
+    {
+        Scheduler::Task task("Hitch", 60.0f);
+        task.Advance(1.0f / 60.0f);
+        CHECK(task.Advance(2.0f) == Scheduler::MaxStepsPerFrame);
+        uint32_t extra = 0;
+        for (int i = 0; i < 10; ++i)
+            extra += task.Advance(1.0f / 60.0f + 1e-6f) - 1;
+        CHECK(extra <= Scheduler::MaxStepsPerFrame);
+        CHECK(task.Advance(1.0f / 60.0f) == 1);
+        CHECK(task.Alpha() < 1.0f);
+    }
+
+    // Rate 0 steps once per frame with the frame time
+    {
+        Scheduler::Task task("Every frame", 0.0f);
+        for (float frameTime : { 0.004f, 0.033f, 0.5f }) {
+            CHECK(task.Advance(frameTime) == 1);
+            CHECK(task.Dt() == frameTime);
+            CHECK(task.Alpha() == 1.0f);
+        }
+    }
+
+    // SetRate keeps the accumulated time, Reset drops it
+    {
+        Scheduler::Task task("Settings", 10.0f);
+        CHECK(task.Advance(0.06f) == 0);
+        task.SetRate(20.0f);
+        CHECK(task.Advance(0.0f) == 1);
+        CHECK(task.Advance(0.03f) == 0);
+        task.Reset();
+        CHECK(task.Advance(0.04f) == 0);
+        CHECK(task.Steps() == 0);
+        CHECK(task.Advance(0.02f) == 1);
+    }
+
+    // Negative frame times (clock hiccups) don't run time backwards
+    {
+        Scheduler::Task task("Negative", 60.0f);
+        task.Advance(-1.0f);
+        CHECK(task.Steps() == 0);
+        CHECK(task.Advance(1.0f / 60.0f + 1e-5f) == 1);
+    }
+
+    // Tasks register in construction order and leave on destruction
+    {
+        size_t before = Scheduler::GetTasks().size();
+        Scheduler::Task a("A", 1.0f);
+        {
+            Scheduler::Task b("B", 1.0f);
+            CHECK(Scheduler::GetTasks().size() == before + 2);
+            CHECK(Scheduler::GetTasks().back() == &b);
+        }
+        CHECK(Scheduler::GetTasks().size() == before + 1);
+        CHECK(Scheduler::GetTasks().back() == &a);
+    }
+
+    return Check::Result("SchedulerTest");
+}
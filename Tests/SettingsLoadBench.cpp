@@ -0,0 +1,101 @@
+// Time to load the shipped settings files through the schemas: parsing each file,
+// and reading the schema fields from the parsed document. Startup parses the general
+// file once for both the general settings and the base vehicle config.
+// The parse times are those of the SimpleIni this is built with.
+#include "../Gears/ScriptSettings.hpp"
+#include "../Gears/ScriptSettingsSchema.h"
+#include "../Gears/VehicleConfigSchema.h"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace {
+    constexpr int runs = 2000;
+
+    template <typename Fn>
+    void run(const char* name, Fn fn) {
+        fn();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i)
+            fn();
+        std::chrono::duration<double, std::micro> us = std::chrono::steady_clock::now() - start;
+        printf("%-44s %8.1f us\n", name, us.count() / runs);
+    }
+
+    bool load(CSimpleIniA& ini, const std::string& file) {
+        ini.SetUnicode();
+        return ini.LoadFile(file.c_str()) == SI_OK;
+    }
+}
+
+int main() {
+    logger.SetMinLevel(FATAL);
+
+    const std::string stage = "../stage/ManualTransmission/";
+    const std::string general = stage + "settings_general.ini";
+    const std::string controls = stage + "settings_controls.ini";
+    const std::string wheel = stage + "settings_wheel.ini";
+
+    CSimpleIniA check;
+    if (!load(check, general)) {
+        printf("%s not found, run from the Tests folder\n", general.c_str());
+        return 1;
+    }
+
+    printf("us per load, %d runs\n", runs);
+
+    CSimpleIniA generalIni, controlsIni, wheelIni;
+    load(generalIni, general);
+    load(controlsIni, controls);
+    load(wheelIni, wheel);
+
+    run("Parse settings_general.ini", [&] {
+        CSimpleIniA ini;
+        load(ini, general);
+    });
+
+    run("Schema, general settings", [&] {
+        ScriptSettings settings;
+        SettingsSchema::Load(generalIni, ScriptSettingsSchema::General, settings, "General");
+    });
+
+    run("Schema, base vehicle config", [&] {
+        VehicleConfig config;
+        SettingsSchema::Load(generalIni, VehicleConfigSchema::Config, config, "Base");
+    });
+
+    run("Schema, controls", [&] {
+        ScriptSettings settings;
+        SettingsSchema::Load(controlsIni, ScriptSettingsSchema::Controls, settings, "Controls");
+    });
+
+    run("Schema, wheel", [&] {
+        ScriptSettings settings;
+        SettingsSchema::Load(wheelIni, ScriptSettingsSchema::Wheel, settings, "Wheel");
+    });
+
+    // What startup does for the general file
+    run("Parse + general settings + base config", [&] {
+        CSimpleIniA ini;
+        load(ini, general);
+        ScriptSettings settings;
+        VehicleConfig config;
+        SettingsSchema::Load(ini, ScriptSettingsSchema::General, settings, "General");
+        SettingsSchema::Load(ini, VehicleConfigSchema::Config, config, "Base");
+    });
+
+    run("Parse + schema, all three files", [&] {
+        CSimpleIniA g, c, w;
+        load(g, general);
+        load(c, controls);
+        load(w, wheel);
+        ScriptSettings settings;
+        VehicleConfig config;
+        SettingsSchema::Load(g, ScriptSettingsSchema::General, settings, "General");
+        SettingsSchema::Load(g, VehicleConfigSchema::Config, config, "Base");
+        SettingsSchema::Load(c, ScriptSettingsSchema::Controls, settings, "Controls");
+        SettingsSchema::Load(w, ScriptSettingsSchema::Wheel, settings, "Wheel");
+    });
+    return 0;
+}
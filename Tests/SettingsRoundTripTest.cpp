@@ -0,0 +1,170 @@
+// The settings schemas: every field is saved and loaded back unchanged, keys are
+// unique per file, the shipped ini files survive a round trip, and vehicle configs
+// fall back to the base config for keys they don't set.
+#include "Check.h"
+#include "../Gears/ScriptSettings.hpp"
+#include "../Gears/ScriptSettingsSchema.h"
+#include "../Gears/VehicleConfigSchema.h"
+
+#include <cmath>
+#include <set>
+#include <string>
+#include <type_traits>
+
+namespace {
+    // A different value that survives being written as text. SimpleIni writes
+    // floats with 6 decimals, so floats move to a multiple of 1/64.
+    template <typename T>
+    T changed(const T& value, int k) {
+        if constexpr (std::is_same_v<T, bool>)
+            return !value;
+        else if constexpr (std::is_enum_v<T>)
+            return static_cast<T>(static_cast<int>(value) + 1);
+        else if constexpr (std::is_integral_v<T>)
+            return value + 1 + k;
+        else if constexpr (std::is_floating_point_v<T>)
+            return std::round(value * 64.0f) / 64.0f + 0.25f * static_cast<float>(1 + k % 7);
+        else
+            return value + "_rt";
+    }
+
+    template <typename TSchema, typename TOwner>
+    void changeAll(const TSchema& schema, TOwner& owner) {
+        int k = 0;
+        SettingsSchema::ForEach(schema, [&](const auto& field) {
+            auto& value = field.Access(owner);
+            if constexpr (SettingsSchema::detail::Tracked<std::remove_reference_t<decltype(value)>>)
+                value.Set(changed(value.Value(), k));
+            else
+                value = changed(value, k);
+            ++k;
+        });
+    }
+
+    template <typename TSchema>
+    bool uniqueKeys(const TSchema& schema) {
+        std::set<std::string> keys;
+        SettingsSchema::ForEach(schema, [&](const auto& field) {
+            keys.insert(std::string(field.Section) + "/" + field.Key);
+        });
+        return keys.size() == SettingsSchema::Size(schema);
+    }
+
+    // Saves with the given predicate, writes the document as text and parses it again.
+    template <typename TSchema, typename TOwner, typename TPredicate>
+    std::string saveText(const TSchema& schema, TOwner& owner, const TOwner& base, TPredicate&& shouldSave) {
+        CSimpleIniA ini;
+        SettingsSchema::Save(ini, schema, owner, base, shouldSave);
+        std::string text;
+        ini.Save(text);
+        return text;
+    }
+
+    template <typename TSchema, typename TOwner>
+    std::string saveText(const TSchema& schema, TOwner& owner) {
+        return saveText(schema, owner, owner, [](const auto&, const auto&) { return true; });
+    }
+
+    template <typename TSchema, typename TOwner>
+    void loadText(const std::string& text, const TSchema& schema, TOwner& owner, const TOwner& fallback) {
+        CSimpleIniA ini;
+        CHECK(ini.LoadData(text) == SI_OK);
+        SettingsSchema::Load(ini, schema, owner, fallback, "RoundTrip");
+    }
+
+    template <typename TSchema, typename TOwner>
+    void checkRoundTrip(const char* name, const TSchema& schema) {
+        const TOwner defaults;
+        TOwner changedAll;
+        changeAll(schema, changedAll);
+        size_t size = SettingsSchema::Size(schema);
+
+        // Every field was changed, so none of them are two entries for one member
+        CHECK(SettingsSchema::Diff(schema, changedAll, defaults) == size);
+        CHECK(uniqueKeys(schema));
+
+        TOwner loaded;
+        loadText(saveText(schema, changedAll), schema, loaded, loaded);
+        size_t diffs = SettingsSchema::Diff(schema, changedAll, loaded,
+            [](const char* section, const char* key, const std::string& a, const std::string& b) {
+                printf("  [%s] %s: saved %s, loaded %s\n", section, key, a.c_str(), b.c_str());
+            });
+        CHECK(diffs == 0);
+        printf("%-16s %3zu fields round trip, %zu differ\n", name, size, diffs);
+    }
+
+    // A shipped file loads, saves and loads to the same values.
+    template <typename TSchema, typename TOwner>
+    void checkStageFile(const char* file, const TSchema& schema) {
+        CSimpleIniA ini;
+        if (ini.LoadFile(file) != SI_OK) {
+            printf("%s not found, run from the Tests folder\n", file);
+            CHECK(false);
+            return;
+        }
+        TOwner stage;
+        SettingsSchema::Load(ini, schema, stage, "Stage");
+
+        TOwner loaded;
+        loadText(saveText(schema, stage), schema, loaded, loaded);
+        CHECK(SettingsSchema::Diff(schema, stage, loaded) == 0);
+    }
+}
+
+int main() {
+    checkRoundTrip<decltype(ScriptSettingsSchema::General), ScriptSettings>("General", ScriptSettingsSchema::General);
+    checkRoundTrip<decltype(ScriptSettingsSchema::Controls), ScriptSettings>("Controls", ScriptSettingsSchema::Controls);
+    checkRoundTrip<decltype(ScriptSettingsSchema::Wheel), ScriptSettings>("Wheel", ScriptSettingsSchema::Wheel);
+    checkRoundTrip<decltype(VehicleConfigSchema::Config), VehicleConfig>("VehicleConfig", VehicleConfigSchema::Config);
+
+    const std::string stage = "../stage/ManualTransmission/";
+    checkStageFile<decltype(ScriptSettingsSchema::General), ScriptSettings>(
+        (stage + "settings_general.ini").c_str(), ScriptSettingsSchema::General);
+    checkStageFile<decltype(ScriptSettingsSchema::Controls), ScriptSettings>(
+        (stage + "settings_controls.ini").c_str(), ScriptSettingsSchema::Controls);
+    checkStageFile<decltype(ScriptSettingsSchema::Wheel), ScriptSettings>(
+        (stage + "settings_wheel.ini").c_str(), ScriptSettingsSchema::Wheel);
+    // The base config is read from the general settings
+    checkStageFile<decltype(VehicleConfigSchema::Config), VehicleConfig>(
+        (stage + "settings_general.ini").c_str(), VehicleConfigSchema::Config);
+
+    // Vehicle configs: save only what differs from the base, as VehicleConfig does,
+    // and load it back on top of the base.
+    {
+        const auto& schema = VehicleConfigSchema::Config;
+        VehicleConfig base;
+        changeAll(schema, base);
+
+        VehicleConfig vehicle = base;
+        int k = 0;
+        size_t overrides = 0;
+        SettingsSchema::ForEach(schema, [&](const auto& field) {
+            if (k++ % 5 == 0) {
+                auto& value = field.Access(vehicle);
+                value.Set(changed(value.Value(), k));
+                ++overrides;
+            }
+        });
+        CHECK(SettingsSchema::Diff(schema, vehicle, base) == overrides);
+
+        std::string text = saveText(schema, vehicle, base,
+            [](const auto& option, const auto& baseOption) {
+                return option.Value() != baseOption.Value() || option.Changed();
+            });
+        CSimpleIniA saved;
+        CHECK(saved.LoadData(text) == SI_OK);
+        size_t keys = 0;
+        SettingsSchema::ForEach(schema, [&](const auto& field) {
+            if (saved.GetValue(field.Section, field.Key))
+                ++keys;
+        });
+        CHECK(keys == overrides);
+
+        VehicleConfig loaded;
+        loadText(text, schema, loaded, base);
+        CHECK(SettingsSchema::Diff(schema, vehicle, loaded) == 0);
+        printf("VehicleConfig    %3zu overrides saved as %zu keys, loaded on top of the base\n", overrides, keys);
+    }
+
+    return Check::Result("SettingsRoundTripTest");
+}
@@ -0,0 +1,212 @@
+// SharedTelemetry: a Subscriber reads what a Publisher writes to the mapping,
+// the ring reports what it overwrote, readers follow a restarted script, an
+// incompatible mapping is reset, and readers racing the writer never keep a
+// torn sample.
+#include "Check.h"
+#include "../Gears/UDPTelemetry/SharedTelemetry.h"
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace SharedTelemetry;
+
+namespace {
+    const std::string name = "MTSharedTelemetryTest" + std::to_string(getpid());
+
+    // Every byte of the packet and the extras follows from the index, so a
+    // sample mixing two writes shows.
+    Sample sampleFor(uint64_t index) {
+        Sample sample{};
+        sample.GameTimeMs = static_cast<int64_t>(index) * 16;
+        memset(&sample.Packet, static_cast<int>(index & 0xFF), sizeof(sample.Packet));
+        sample.RPM = static_cast<float>(index);
+        sample.Handbrake = static_cast<float>(index);
+        return sample;
+    }
+
+    bool consistent(const Sample& sample) {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(&sample.Packet);
+        for (size_t i = 0; i < sizeof(sample.Packet); ++i) {
+            if (bytes[i] != (sample.Index & 0xFF))
+                return false;
+        }
+        return sample.GameTimeMs == static_cast<int64_t>(sample.Index) * 16 &&
+            sample.RPM == static_cast<float>(sample.Index) &&
+            sample.Handbrake == static_cast<float>(sample.Index);
+    }
+
+    // Samples after published, which is advanced.
+    void publish(Publisher& publisher, uint64_t& published, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            Sample sample = sampleFor(++published);
+            publisher.Publish(sample);
+            CHECK(sample.Index == published);
+        }
+    }
+}
+
+int main() {
+    // Nothing to attach to before the script created the mapping
+    {
+        Subscriber subscriber;
+        CHECK(!subscriber.Open(name.c_str()));
+        CHECK(!subscriber.IsOpen());
+        Sample sample;
+        CHECK(!subscriber.ReadLatest(sample));
+    }
+
+    // Latest and every sample in order
+    {
+        Publisher publisher;
+        CHECK(publisher.Open(name.c_str()));
+        Subscriber subscriber;
+        CHECK(subscriber.Open(name.c_str()));
+        CHECK(subscriber.Active());
+
+        Sample sample;
+        CHECK(!subscriber.ReadLatest(sample));
+        uint64_t published = 0;
+        uint64_t lastIndex = 0;
+        std::vector<Sample> samples(RingSize);
+        CHECK(subscriber.ReadSince(lastIndex, samples.data(), samples.size()) == 0);
+
+        publish(publisher, published, 10);
+        CHECK(subscriber.ReadLatest(sample));
+        CHECK(sample.Index == 10 && consistent(sample));
+        CHECK(sample.PublishTimeNs > 0 && sample.PublishTimeNs <= NowNs());
+
+        uint64_t missed = 1;
+        size_t count = subscriber.ReadSince(lastIndex, samples.data(), samples.size(), &missed);
+        CHECK(count == 10 && missed == 0 && lastIndex == 10);
+        for (size_t i = 0; i < count; ++i)
+            CHECK(samples[i].Index == i + 1 && consistent(samples[i]));
+
+        // At most maxSamples, the rest on the next call
+        publish(publisher, published, 5);
+        CHECK(subscriber.ReadSince(lastIndex, samples.data(), 3) == 3);
+        CHECK(samples[0].Index == 11 && lastIndex == 13);
+        CHECK(subscriber.ReadSince(lastIndex, samples.data(), samples.size()) == 2);
+        CHECK(samples[1].Index == 15 && lastIndex == 15);
+
+        // More than the ring holds: the oldest RingSize come back, the rest are missed
+        publish(publisher, published, RingSize + 44);
+        count = subscriber.ReadSince(lastIndex, samples.data(), samples.size(), &missed);
+        CHECK(count == RingSize && missed == 44);
+        CHECK(samples[0].Index == 15 + 45 && samples[RingSize - 1].Index == 15 + RingSize + 44);
+        CHECK(lastIndex == 15 + RingSize + 44);
+
+        // A second script instance continues the count of a mapping still in use
+        {
+            Publisher second;
+            CHECK(second.Open(name.c_str()));
+            publish(second, published, 1);
+        }
+        CHECK(subscriber.ReadSince(lastIndex, samples.data(), samples.size()) == 1);
+        CHECK(samples[0].Index == published);
+
+        publisher.Close();
+        CHECK(!subscriber.Active());
+    }
+
+    // The script started over: reopening attaches to the new mapping, and a
+    // lastIndex past what it published starts from its first sample
+    {
+        Publisher publisher;
+        CHECK(publisher.Open(name.c_str()));
+        uint64_t published = 0;
+        publish(publisher, published, 3);
+
+        Subscriber subscriber;
+        CHECK(subscriber.Open(name.c_str()));
+        uint64_t lastIndex = 1000;
+        std::vector<Sample> samples(RingSize);
+        CHECK(subscriber.ReadSince(lastIndex, samples.data(), samples.size()) == 3);
+        CHECK(samples[0].Index == 1 && lastIndex == 3);
+    }
+
+    // A mapping of another version: readers refuse it, the publisher resets it
+    {
+        SharedMemory memory;
+        CHECK(memory.Create(name, sizeof(Layout)));
+        auto* layout = static_cast<Layout*>(memory.Data());
+        layout->Magic = Magic;
+        layout->Version = Version + 1;
+        layout->Published = 5000;
+
+        Subscriber subscriber;
+        CHECK(!subscriber.Open(name.c_str()));
+
+        Publisher publisher;
+        CHECK(publisher.Open(name.c_str()));
+        CHECK(layout->Version == Version && layout->Published == 0);
+        CHECK(subscriber.Open(name.c_str()));
+        Sample sample = sampleFor(1);
+        publisher.Publish(sample);
+        CHECK(sample.Index == 1);
+        publisher.Close();
+        memory.Close();
+    }
+
+    // Readers spinning on the mapping while the writer publishes as fast as it
+    // can: every sample kept is whole, and the indices only go up
+    {
+        Publisher publisher;
+        CHECK(publisher.Open(name.c_str()));
+        constexpr uint64_t count = 200000;
+        std::atomic<bool> done = false;
+        std::atomic<uint64_t> torn = 0;
+        std::atomic<uint64_t> retries = 0;
+
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 2; ++r) {
+            readers.emplace_back([&, r] {
+                Subscriber subscriber;
+                while (!subscriber.Open(name.c_str()))
+                    std::this_thread::yield();
+                uint64_t lastIndex = 0;
+                uint64_t lastLatest = 0;
+                std::vector<Sample> samples(64);
+                while (!done) {
+                    if (r == 0) {
+                        Sample sample;
+                        if (subscriber.ReadLatest(sample)) {
+                            torn += !consistent(sample) || sample.Index < lastLatest;
+                            lastLatest = sample.Index;
+                        }
+                    }
+                    else {
+                        uint64_t previous = lastIndex;
+                        size_t read = subscriber.ReadSince(lastIndex, samples.data(), samples.size());
+                        for (size_t i = 0; i < read; ++i) {
+                            torn += !consistent(samples[i]) || samples[i].Index <= previous;
+                            previous = samples[i].Index;
+                        }
+                    }
+                    std::this_thread::yield();
+                }
+                retries += subscriber.Retries();
+            });
+        }
+
+        for (uint64_t index = 1; index <= count; ++index) {
+            Sample sample = sampleFor(index);
+            publisher.Publish(sample);
+            if (index % 1000 == 0)
+                std::this_thread::yield();
+        }
+        done = true;
+        for (auto& reader : readers)
+            reader.join();
+        CHECK(torn == 0);
+        printf("Racing readers: %llu samples, %llu torn, %llu retried reads\n",
+            static_cast<unsigned long long>(count), static_cast<unsigned long long>(torn.load()),
+            static_cast<unsigned long long>(retries.load()));
+    }
+
+    return Check::Result("SharedTelemetryTest");
+}
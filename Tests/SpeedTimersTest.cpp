@@ -0,0 +1,179 @@
+// SpeedTimers::Engine fed a launch and a stop at 30 to 240 FPS with +/-20% frame
+// jitter, against the analytic times of the curves: acceleration windows from
+// standstill and rolling, the 100-0 kph stop, and the 0-402 m and 100-400 m
+// distance windows.
+#include "Check.h"
+#include "../Gears/Util/SpeedTimers.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    // Launch: v = top * (1 - exp(-t / tau)) after launchTime, standing before.
+    constexpr double top = 70.0;
+    constexpr double tau = 6.0;
+    constexpr double launchTime = 0.5;
+
+    double launchSpeed(double t) {
+        return t <= launchTime ? 0.0 : top * (1.0 - std::exp(-(t - launchTime) / tau));
+    }
+
+    double launchDistance(double t) {
+        double s = std::max(0.0, t - launchTime);
+        return top * (s - tau * (1.0 - std::exp(-s / tau)));
+    }
+
+    // Time after launch at which speed reaches v.
+    double speedTime(double v) {
+        return -tau * std::log(1.0 - v / top);
+    }
+
+    // Time after launch at which the distance reaches d.
+    double distanceTime(double d) {
+        double lo = 0.0, hi = 100.0;
+        for (int i = 0; i < 100; ++i) {
+            double mid = 0.5 * (lo + hi);
+            (launchDistance(launchTime + mid) < d ? lo : hi) = mid;
+        }
+        return 0.5 * (lo + hi);
+    }
+
+    // Stop: cruising, then a constant deceleration to standstill at brakeTime.
+    constexpr double cruise = 130.0 / 3.6;
+    constexpr double decel = 8.0;
+    constexpr double brakeTime = 1.0;
+
+    double stopSpeed(double t) {
+        return t <= brakeTime ? cruise : std::max(0.0, cruise - decel * (t - brakeTime));
+    }
+
+    using Results = std::map<std::string, double>;
+
+    // Frame times like the script's, float, starting off the launch.
+    Results run(const std::vector<SpeedTimers::Window>& windows, const std::function<double(double)>& speed,
+        double fps, double seconds, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> jitter(0.8, 1.2);
+
+        SpeedTimers::Engine engine;
+        engine.Configure(windows);
+        Results results;
+        double clock = 0.013;
+        while (clock < seconds) {
+            engine.Update(clock, static_cast<float>(speed(clock)));
+            for (size_t i = 0; i < engine.NumResults(); ++i)
+                results[engine.GetResult(i).Label] = engine.GetResult(i).Time;
+            engine.ClearResults();
+            clock += static_cast<float>(jitter(rng) / fps);
+        }
+        return results;
+    }
+
+    SpeedTimers::Window window(const char* unit, float limA, float limB, float tolerance) {
+        SpeedTimers::Window window;
+        CHECK(SpeedTimers::MakeWindow(unit, limA, limB, tolerance, window));
+        return window;
+    }
+}
+
+int main() {
+    const std::vector<SpeedTimers::Window> launchWindows = {
+        window("kph", 0, 100, 1),
+        window("mph", 0, 60, 1),
+        window("kph", 50, 100, 1),
+        window("m", 0, 402, 0.5f),
+        window("m", 100, 400, 0.5f),
+        window("ft", 0, 1320, 0.5f),
+    };
+    const Results launchExpected = {
+        { "0 - 100 kph", speedTime(100.0 / 3.6) },
+        { "0 - 60 mph", speedTime(60.0 * 0.44704) },
+        { "50 - 100 kph", speedTime(100.0 / 3.6) - speedTime(50.0 / 3.6) },
+        { "0 - 402 m", distanceTime(402.0) },
+        { "100 - 400 m", distanceTime(400.0) - distanceTime(100.0) },
+        { "0 - 1320 ft", distanceTime(1320.0 * 0.3048) },
+    };
+    const std::vector<SpeedTimers::Window> stopWindows = {
+        window("kph", 100, 0, 1),
+    };
+    const Results stopExpected = {
+        { "100 - 0 kph", (100.0 / 3.6) / decel },
+    };
+
+    printf("%-14s %9s", "Window", "Expected");
+    for (double fps : { 30.0, 60.0, 144.0, 240.0 })
+        printf(" %7.0f FPS", fps);
+    printf("  Max error\n");
+
+    auto checkAll = [](const std::vector<SpeedTimers::Window>& windows, const Results& expected,
+        const std::function<double(double)>& speed, double seconds) {
+        for (const auto& [label, time] : expected) {
+            printf("%-14s %8.4fs", label.c_str(), time);
+            double maxError = 0.0;
+            double lowest = time, highest = time;
+            for (double fps : { 30.0, 60.0, 144.0, 240.0 }) {
+                // Several jitter patterns per frame rate, the first one is printed
+                for (unsigned seed = 1; seed <= 20; ++seed) {
+                    Results results = run(windows, speed, fps, seconds, seed);
+                    CHECK(results.count(label) == 1);
+                    if (results.count(label) == 0)
+                        continue;
+                    CHECK_NEAR(results[label], time, 0.001);
+                    maxError = std::max(maxError, std::abs(results[label] - time));
+                    lowest = std::min(lowest, results[label]);
+                    highest = std::max(highest, results[label]);
+                    if (seed == 1)
+                        printf(" %10.4fs", results[label]);
+                }
+            }
+            // And with each other, at any frame rate
+            CHECK(highest - lowest <= 0.001);
+            printf("  %6.3f ms\n", maxError * 1000.0);
+        }
+    };
+    checkAll(launchWindows, launchExpected, launchSpeed, 25.0);
+    checkAll(stopWindows, stopExpected, stopSpeed, 8.0);
+
+    // Dropping back below the start re-arms the window instead of finishing it
+    {
+        SpeedTimers::Engine engine;
+        engine.Configure({ window("kph", 0, 100, 1) });
+        double t = 0.0;
+        auto feed = [&](float kph, int frames) {
+            for (int i = 0; i < frames; ++i, t += 1.0 / 60.0)
+                engine.Update(t, kph / 3.6f);
+        };
+        feed(0, 10);
+        for (int i = 0; i < 60; ++i, t += 1.0 / 60.0)
+            engine.Update(t, static_cast<float>(i) / 3.6f);
+        feed(0, 10);
+        CHECK(engine.NumResults() == 0);
+        for (int i = 0; i <= 120; ++i, t += 1.0 / 60.0)
+            engine.Update(t, static_cast<float>(i) / 3.6f);
+        CHECK(engine.NumResults() == 1);
+        if (engine.NumResults() == 1)
+            CHECK_NEAR(engine.GetResult(0).Time, 100.0 / 60.0, 0.001);
+    }
+
+    // Reset drops a run in progress, e.g. on vehicle change
+    {
+        SpeedTimers::Engine engine;
+        engine.Configure({ window("kph", 0, 100, 1) });
+        double t = 0.0;
+        for (int i = 0; i < 10; ++i, t += 1.0 / 60.0)
+            engine.Update(t, 0.0f);
+        for (int i = 0; i < 60; ++i, t += 1.0 / 60.0)
+            engine.Update(t, static_cast<float>(i) / 3.6f);
+        engine.Reset();
+        for (int i = 60; i <= 120; ++i, t += 1.0 / 60.0)
+            engine.Update(t, static_cast<float>(i) / 3.6f);
+        CHECK(engine.NumResults() == 0);
+    }
+
+    return Check::Result("SpeedTimersTest");
+}
@@ -0,0 +1,69 @@
+// TaskPool throughput with empty jobs from one and several producers, and the
+// latency from Submit() to the job starting, with the workers busy and idle.
+#include "../Gears/Util/TaskPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono;
+
+namespace {
+    void throughput(int producers, int jobs) {
+        auto start = steady_clock::now();
+        std::vector<std::vector<TaskPool::Handle<void>>> handles(producers);
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                handles[p].reserve(jobs / producers);
+                for (int i = 0; i < jobs / producers; ++i)
+                    handles[p].push_back(TaskPool::Submit([] {}));
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        for (auto& producer : handles) {
+            for (auto& handle : producer)
+                handle.Wait();
+        }
+        double s = duration<double>(steady_clock::now() - start).count();
+        printf("Throughput, %d producer(s)           %10.0f jobs/s %7.2f us/job\n",
+            producers, jobs / s, s * 1e6 / jobs);
+    }
+
+    // Idle sleeps between jobs so the workers go to sleep, busy submits back to back.
+    void latency(const char* name, microseconds idle) {
+        std::vector<double> us;
+        for (int i = 0; i < 2000; ++i) {
+            auto submitted = steady_clock::now();
+            auto handle = TaskPool::Submit([submitted] {
+                return duration<double, std::micro>(steady_clock::now() - submitted).count();
+            });
+            us.push_back(handle.Get());
+            if (idle.count() > 0)
+                std::this_thread::sleep_for(idle);
+        }
+        std::sort(us.begin(), us.end());
+        printf("Latency to start, %-18s p50 %6.1f us, p99 %6.1f us, max %7.1f us\n",
+            name, us[us.size() / 2], us[us.size() * 99 / 100], us.back());
+    }
+}
+
+int main() {
+    // Start the workers outside the timings
+    TaskPool::Submit([] {}).Wait();
+    printf("%zu workers\n", TaskPool::WorkerCount());
+
+    throughput(1, 200000);
+    throughput(4, 200000);
+    latency("back to back", microseconds(0));
+    latency("idle workers", microseconds(200));
+
+    TaskPool::Shutdown();
+    auto stats = TaskPool::GetStats();
+    printf("%llu submitted, %llu stolen\n",
+        static_cast<unsigned long long>(stats.Submitted), static_cast<unsigned long long>(stats.Stolen));
+    return 0;
+}
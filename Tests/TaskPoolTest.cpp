@@ -0,0 +1,229 @@
+// TaskPool under load: many producers, jobs submitting jobs from the workers,
+// exceptions, cancellation, priorities, interruptible waits and shutdown with
+// jobs still queued and running.
+#include "Check.h"
+#include "../Gears/Util/TaskPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono;
+
+namespace {
+    // Occupies every worker until released, so queued jobs stay queued.
+    class BlockWorkers {
+    public:
+        BlockWorkers() {
+            for (size_t i = 0; i < TaskPool::WorkerCount(); ++i) {
+                mBlockers.push_back(TaskPool::Submit(TaskPool::Priority::High, [this] {
+                    ++mBlocked;
+                    while (!mRelease)
+                        std::this_thread::yield();
+                }));
+            }
+            while (mBlocked < TaskPool::WorkerCount())
+                std::this_thread::yield();
+        }
+
+        ~BlockWorkers() {
+            Release();
+            for (auto& blocker : mBlockers)
+                blocker.Get();
+        }
+
+        void Release() { mRelease = true; }
+
+    private:
+        std::atomic<size_t> mBlocked = 0;
+        std::atomic<bool> mRelease = false;
+        std::vector<TaskPool::Handle<void>> mBlockers;
+    };
+}
+
+int main() {
+    // Workers start on the first submission
+    CHECK(TaskPool::Submit([] { return 1; }).Get() == 1);
+    CHECK(TaskPool::WorkerCount() >= 1 && TaskPool::WorkerCount() <= TaskPool::MaxWorkers);
+
+    // Many producers at all priorities: every job runs once, with its own result
+    {
+        constexpr int producers = 8;
+        constexpr int jobs = 20000;
+        std::atomic<int> runs = 0;
+        std::vector<std::vector<TaskPool::Handle<int>>> handles(producers);
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (int i = 0; i < jobs; ++i) {
+                    auto priority = static_cast<TaskPool::Priority>(i % TaskPool::PriorityCount);
+                    handles[p].push_back(TaskPool::Submit(priority, [i, &runs] { ++runs; return i * 2; }));
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        int wrong = 0;
+        for (auto& producer : handles) {
+            for (size_t i = 0; i < producer.size(); ++i)
+                wrong += producer[i].Get() != static_cast<int>(i) * 2;
+        }
+        CHECK(wrong == 0);
+        CHECK(runs == producers * jobs);
+    }
+
+    // Jobs that submit jobs: these stay on the worker and are stolen by idle ones
+    {
+        std::atomic<int> leaves = 0;
+        std::mutex mutex;
+        std::vector<TaskPool::Handle<void>> inner;
+        std::vector<TaskPool::Handle<void>> outer;
+        for (int i = 0; i < 100; ++i) {
+            outer.push_back(TaskPool::Submit([&] {
+                for (int j = 0; j < 100; ++j) {
+                    auto handle = TaskPool::Submit([&] { ++leaves; });
+                    std::lock_guard lock(mutex);
+                    inner.push_back(std::move(handle));
+                }
+            }));
+        }
+        for (auto& handle : outer)
+            handle.Get();
+        for (auto& handle : inner)
+            handle.Get();
+        CHECK(leaves == 10000);
+    }
+
+    // Exceptions reach Get()
+    {
+        auto handle = TaskPool::Submit([]() -> int { throw std::runtime_error("Job failed"); });
+        bool threw = false;
+        try {
+            handle.Get();
+        }
+        catch (const std::runtime_error&) {
+            threw = true;
+        }
+        CHECK(threw);
+    }
+
+    // Cancelling queued jobs drops them
+    {
+        std::atomic<int> runs = 0;
+        std::vector<TaskPool::Handle<void>> handles;
+        {
+            BlockWorkers block;
+            for (int i = 0; i < 100; ++i)
+                handles.push_back(TaskPool::Submit([&] { ++runs; }));
+            for (int i = 0; i < 100; i += 2)
+                handles[i].Cancel();
+        }
+        int cancelled = 0;
+        for (auto& handle : handles) {
+            try {
+                handle.Get();
+            }
+            catch (const TaskPool::Cancelled&) {
+                ++cancelled;
+            }
+        }
+        CHECK(cancelled == 50);
+        CHECK(runs == 50);
+    }
+
+    // Queued high priority jobs run before low priority ones. Each worker may
+    // already have taken one low priority job when the blockers finish.
+    {
+        std::mutex mutex;
+        std::vector<TaskPool::Priority> order;
+        std::vector<TaskPool::Handle<void>> handles;
+        {
+            BlockWorkers block;
+            for (auto priority : { TaskPool::Priority::Low, TaskPool::Priority::High }) {
+                for (int i = 0; i < 50; ++i) {
+                    handles.push_back(TaskPool::Submit(priority, [&, priority] {
+                        std::lock_guard lock(mutex);
+                        order.push_back(priority);
+                    }));
+                }
+            }
+        }
+        for (auto& handle : handles)
+            handle.Get();
+        auto highFirst = std::count(order.begin(), order.begin() + 50, TaskPool::Priority::High);
+        CHECK(highFirst >= 50 - static_cast<long>(TaskPool::WorkerCount()));
+    }
+
+    // A job waiting on its token stops when cancelled
+    {
+        auto start = steady_clock::now();
+        auto handle = TaskPool::Submit([](const TaskPool::CancelToken& token) {
+            return token.WaitFor(seconds(10));
+        });
+        std::this_thread::sleep_for(milliseconds(10));
+        handle.Cancel();
+        CHECK(handle.Get());
+        CHECK(steady_clock::now() - start < milliseconds(500));
+    }
+
+    // A job is counted after its future is ready, so give the last one a moment
+    auto stats = TaskPool::GetStats();
+    for (int i = 0; i < 1000 && stats.Executed + stats.Cancelled != stats.Submitted; ++i) {
+        std::this_thread::sleep_for(milliseconds(1));
+        stats = TaskPool::GetStats();
+    }
+    CHECK(stats.Executed + stats.Cancelled == stats.Submitted);
+    CHECK(stats.Cancelled == 50);
+
+    // Shutdown with a running job and queued ones: all finish or fail with Cancelled,
+    // and later submissions are cancelled right away
+    {
+        auto sleeper = TaskPool::Submit([](const TaskPool::CancelToken& token) {
+            token.WaitFor(seconds(30));
+        });
+        std::vector<TaskPool::Handle<int>> queued;
+        for (int i = 0; i < 1000; ++i)
+            queued.push_back(TaskPool::Submit(TaskPool::Priority::Low, [i] { return i; }));
+
+        auto start = steady_clock::now();
+        TaskPool::Shutdown();
+        CHECK(steady_clock::now() - start < seconds(1));
+
+        sleeper.Wait();
+        int finished = 0;
+        for (auto& handle : queued) {
+            try {
+                handle.Get();
+                ++finished;
+            }
+            catch (const TaskPool::Cancelled&) {
+                ++finished;
+            }
+        }
+        CHECK(finished == 1000);
+
+        auto late = TaskPool::Submit([] { return 1; });
+        bool cancelled = false;
+        try {
+            late.Get();
+        }
+        catch (const TaskPool::Cancelled&) {
+            cancelled = true;
+        }
+        CHECK(cancelled);
+    }
+
+    stats = TaskPool::GetStats();
+    printf("%llu submitted, %llu executed, %llu stolen, %llu cancelled on %zu workers\n",
+        static_cast<unsigned long long>(stats.Submitted), static_cast<unsigned long long>(stats.Executed),
+        static_cast<unsigned long long>(stats.Stolen), static_cast<unsigned long long>(stats.Cancelled),
+        TaskPool::WorkerCount());
+    CHECK(stats.Executed + stats.Cancelled == stats.Submitted);
+
+    return Check::Result("TaskPoolTest");
+}
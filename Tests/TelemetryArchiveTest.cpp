@@ -0,0 +1,187 @@
+// TelemetryArchive: writes a session through the TaskPool and reads it back,
+// seeks by time, recovers the index of a file that wasn't closed, and closes
+// with a timeout while the pool can't run the drain job.
+#include "Check.h"
+#include "../Gears/UDPTelemetry/TelemetryArchive.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace std::chrono;
+
+namespace {
+    const fs::path dir = fs::temp_directory_path() / "TelemetryArchiveTest";
+
+    const TelemetryArchive::Channel channels[] = {
+        { "Speed", 0.001f },
+        { "RPM", 0.0001f },
+        { "Steering", 0.001f },
+    };
+    constexpr size_t channelCount = std::size(channels);
+
+    // 60 Hz with a gap in the middle, like a menu being open
+    int64_t timeOf(size_t record) {
+        return static_cast<int64_t>(record) * 16 + (record >= 1500 ? 60000 : 0);
+    }
+
+    void valuesOf(size_t record, float* values) {
+        float t = static_cast<float>(record) / 60.0f;
+        values[0] = 30.0f + 10.0f * std::sin(t);
+        values[1] = 0.5f + 0.4f * std::sin(3.0f * t);
+        values[2] = std::cos(t);
+    }
+
+    void record(TelemetryArchive::Writer& writer, size_t records) {
+        float values[channelCount];
+        for (size_t i = 0; i < records; ++i) {
+            valuesOf(i, values);
+            writer.Add(timeOf(i), values);
+        }
+    }
+
+    // Every record is there, in order, within half a step.
+    bool readsBack(TelemetryArchive::Reader& reader, size_t records) {
+        std::vector<int64_t> times;
+        std::vector<float> values;
+        size_t next = 0;
+        for (size_t chunk = 0; chunk < reader.Index().size(); ++chunk) {
+            if (!reader.ReadChunk(chunk, times, values))
+                return false;
+            for (size_t r = 0; r < times.size(); ++r, ++next) {
+                float expected[channelCount];
+                valuesOf(next, expected);
+                if (times[r] != timeOf(next))
+                    return false;
+                for (size_t c = 0; c < channelCount; ++c) {
+                    if (std::abs(values[r * channelCount + c] - expected[c]) > channels[c].Step * 0.51f)
+                        return false;
+                }
+            }
+        }
+        return next == records;
+    }
+
+    // Occupies every worker until released, so the drain job stays queued.
+    class BlockWorkers {
+    public:
+        BlockWorkers() {
+            for (size_t i = 0; i < TaskPool::WorkerCount(); ++i) {
+                mBlockers.push_back(TaskPool::Submit(TaskPool::Priority::High, [this] {
+                    ++mBlocked;
+                    while (!mRelease)
+                        std::this_thread::yield();
+                }));
+            }
+            while (mBlocked < TaskPool::WorkerCount())
+                std::this_thread::yield();
+        }
+
+        ~BlockWorkers() {
+            mRelease = true;
+            for (auto& blocker : mBlockers)
+                blocker.Get();
+        }
+
+    private:
+        std::atomic<size_t> mBlocked = 0;
+        std::atomic<bool> mRelease = false;
+        std::vector<TaskPool::Handle<void>> mBlockers;
+    };
+}
+
+int main() {
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    TaskPool::Submit([] {}).Wait();
+
+    constexpr size_t records = 3000;
+    const std::string file = (dir / "session.tla").string();
+
+    // Written on the pool, closed with an index
+    {
+        TelemetryArchive::Writer writer;
+        CHECK(writer.Open(file, channels, 1234));
+        record(writer, records);
+        writer.Close();
+        CHECK(!writer.IsOpen());
+        auto stats = writer.GetStats();
+        CHECK(stats.Records == records);
+        CHECK(stats.Chunks == (records + TelemetryArchive::RecordsPerChunk - 1) / TelemetryArchive::RecordsPerChunk);
+        CHECK(stats.FileBytes < stats.RawBytes);
+    }
+
+    TelemetryArchive::Reader reader;
+    CHECK(reader.Open(file));
+    CHECK(!reader.Recovered());
+    CHECK(reader.StartUnixMs() == 1234);
+    CHECK(reader.Channels().size() == channelCount);
+    CHECK(reader.Channels()[1].Name == "RPM");
+    CHECK(readsBack(reader, records));
+
+    // Seeks: into a chunk, into the gap, past the end
+    CHECK(reader.FindChunk(0) == 0);
+    CHECK(reader.FindChunk(timeOf(1100)) == 1100 / TelemetryArchive::RecordsPerChunk);
+    CHECK(reader.FindChunk(timeOf(1499) + 1000) == 1500 / TelemetryArchive::RecordsPerChunk);
+    CHECK(reader.FindChunk(timeOf(records - 1) + 1) == reader.Index().size());
+
+    // No index and trailer, e.g. after a crash: rebuilt from the chunk headers
+    {
+        const std::string truncated = (dir / "crashed.tla").string();
+        std::vector<TelemetryArchive::IndexEntry> index = reader.Index();
+        fs::copy_file(file, truncated);
+        fs::resize_file(truncated, fs::file_size(file) -
+            index.size() * sizeof(TelemetryArchive::IndexEntry) - sizeof(TelemetryArchive::Trailer));
+
+        TelemetryArchive::Reader recovered;
+        CHECK(recovered.Open(truncated));
+        CHECK(recovered.Recovered());
+        CHECK(recovered.Index().size() == index.size());
+        CHECK(readsBack(recovered, records));
+    }
+
+    // The pool can't run the drain: a timed close gives up quickly and leaves the
+    // file open, a later close writes everything
+    {
+        const std::string busy = (dir / "busy.tla").string();
+        TelemetryArchive::Writer writer;
+        CHECK(writer.Open(busy, channels, 0));
+        {
+            BlockWorkers block;
+            record(writer, records);
+            auto start = steady_clock::now();
+            CHECK(!writer.Close(milliseconds(20)));
+            CHECK(steady_clock::now() - start < milliseconds(500));
+            CHECK(writer.IsOpen());
+        }
+        CHECK(writer.Close(milliseconds(1000)));
+        CHECK(!writer.IsOpen());
+
+        TelemetryArchive::Reader busyReader;
+        CHECK(busyReader.Open(busy));
+        CHECK(!busyReader.Recovered());
+        CHECK(readsBack(busyReader, records));
+    }
+
+    // Recording after the pool stopped: the chunks are written on close
+    {
+        TaskPool::Shutdown();
+        const std::string late = (dir / "late.tla").string();
+        TelemetryArchive::Writer writer;
+        CHECK(writer.Open(late, channels, 0));
+        record(writer, records);
+        CHECK(writer.Close(milliseconds(20)));
+
+        TelemetryArchive::Reader lateReader;
+        CHECK(lateReader.Open(late));
+        CHECK(readsBack(lateReader, records));
+    }
+
+    fs::remove_all(dir);
+    return Check::Result("TelemetryArchiveTest");
+}
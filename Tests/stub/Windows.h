@@ -0,0 +1,104 @@
+#pragma once
+// Stand-in for the Windows, XInput and DirectInput headers, so the script's
+// input and settings headers parse on other platforms. Declarations only:
+// nothing built by these tests talks to a device.
+#include <algorithm>
+#include <cstdint>
+
+typedef unsigned long DWORD;
+typedef unsigned short WORD;
+typedef unsigned char BYTE;
+typedef int BOOL;
+typedef long LONG;
+typedef short SHORT;
+typedef unsigned int UINT;
+typedef long HRESULT;
+typedef void* HANDLE;
+typedef void* HWND;
+typedef void* HINSTANCE;
+typedef void* HMODULE;
+typedef void* LPVOID;
+#define VOID void
+#define CALLBACK
+#define MAX_PATH 260
+#define __int64 long long
+
+struct _GUID {
+    unsigned long Data1;
+    unsigned short Data2;
+    unsigned short Data3;
+    unsigned char Data4[8];
+};
+typedef _GUID GUID;
+typedef const GUID& REFGUID;
+const GUID GUID_NULL{};
+
+inline bool operator==(const GUID& a, const GUID& b) {
+    return a.Data1 == b.Data1 && a.Data2 == b.Data2 && a.Data3 == b.Data3 &&
+        std::equal(a.Data4, a.Data4 + 8, b.Data4);
+}
+inline bool operator!=(const GUID& a, const GUID& b) { return !(a == b); }
+
+// XInput
+struct XINPUT_GAMEPAD {
+    WORD wButtons;
+    BYTE bLeftTrigger;
+    BYTE bRightTrigger;
+    SHORT sThumbLX;
+    SHORT sThumbLY;
+    SHORT sThumbRX;
+    SHORT sThumbRY;
+};
+struct XINPUT_STATE {
+    DWORD dwPacketNumber;
+    XINPUT_GAMEPAD Gamepad;
+};
+struct XINPUT_VIBRATION {
+    WORD wLeftMotorSpeed;
+    WORD wRightMotorSpeed;
+};
+#define XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE 7849
+#define XINPUT_GAMEPAD_RIGHT_THUMB_DEADZONE 8689
+#define XINPUT_GAMEPAD_DPAD_UP 0x0001
+#define XINPUT_GAMEPAD_DPAD_DOWN 0x0002
+#define XINPUT_GAMEPAD_DPAD_LEFT 0x0004
+#define XINPUT_GAMEPAD_DPAD_RIGHT 0x0008
+#define XINPUT_GAMEPAD_START 0x0010
+#define XINPUT_GAMEPAD_BACK 0x0020
+#define XINPUT_GAMEPAD_LEFT_THUMB 0x0040
+#define XINPUT_GAMEPAD_RIGHT_THUMB 0x0080
+#define XINPUT_GAMEPAD_LEFT_SHOULDER 0x0100
+#define XINPUT_GAMEPAD_RIGHT_SHOULDER 0x0200
+#define XINPUT_GAMEPAD_A 0x1000
+#define XINPUT_GAMEPAD_B 0x2000
+#define XINPUT_GAMEPAD_X 0x4000
+#define XINPUT_GAMEPAD_Y 0x8000
+
+// DirectInput
+struct DIJOYSTATE2 {
+    LONG lX, lY, lZ, lRx, lRy, lRz;
+    LONG rglSlider[2];
+    DWORD rgdwPOV[4];
+    BYTE rgbButtons[128];
+    LONG rest[40];
+};
+struct DIDEVICEINSTANCE {
+    GUID guidInstance;
+    GUID guidProduct;
+    char tszInstanceName[MAX_PATH];
+    char tszProductName[MAX_PATH];
+};
+typedef const DIDEVICEINSTANCE* LPCDIDEVICEINSTANCE;
+struct DIDEVCAPS {
+    DWORD dwSize, dwFlags, dwDevType, dwAxes, dwButtons, dwPOVs;
+};
+struct DIEFFECT {};
+struct DICONSTANTFORCE {
+    LONG lMagnitude;
+};
+struct DIPERIODIC {};
+struct DICONDITION {};
+typedef void* LPDIRECTINPUT;
+typedef void* LPDIRECTINPUT8;
+typedef void* LPDIRECTINPUTDEVICE8;
+typedef void* LPDIRECTINPUTEFFECT;
@@ -0,0 +1,26 @@
+#pragma once
+// Stand-in for the ScriptHook V SDK inc/types.h, on top of stub/Windows.h.
+// Only what the sources built by these tests use, with the SDK's layout.
+#include <Windows.h>
+
+typedef DWORD Hash;
+typedef int Entity;
+typedef int Vehicle;
+
+struct Vector2 {
+    alignas(8) float x;
+    alignas(8) float y;
+};
+
+struct Vector3 {
+    alignas(8) float x;
+    alignas(8) float y;
+    alignas(8) float z;
+};
+
+struct Vector4 {
+    alignas(8) float x;
+    alignas(8) float y;
+    alignas(8) float z;
+    alignas(8) float w;
+};
@@ -6,7 +6,7 @@
 
 #pragma once
 
-#include <windows.h>
+#include <Windows.h>
 
 enum eAudioFlag
 {